@@ -0,0 +1,82 @@
+// Wire size of named vs compact frames (MESSAGE_NAME prefix overhead)
+//
+// Encodes representative messages with realistic field contents and reports
+// the frame size in both forms, then the bandwidth of the remote-controls
+// batch stream at its nominal rate, sparse (one automated knob) vs a batch
+// carrying all 8 slots.
+
+#include <cstdint>
+#include <cstdio>
+
+#include "protocol/Framing.hpp"
+#include "protocol/MessageStructure.hpp"
+
+namespace {
+
+using namespace Protocol;
+
+constexpr double BATCH_RATE_HZ = 50.0;
+
+struct FrameSizes {
+    size_t named;
+    size_t compact;
+};
+
+template <typename T>
+FrameSizes measure(const T& message) {
+    static uint8_t frame[MAX_MESSAGE_SIZE];
+    FrameSizes sizes{};
+    for (bool compact : {false, true}) {
+        size_t offset = bitwig::framing::writeHeader(frame, T::MESSAGE_ID, compact);
+        offset += message.encode(frame + offset, static_cast<uint16_t>(sizeof(frame) - offset));
+        (compact ? sizes.compact : sizes.named) = offset;
+    }
+    return sizes;
+}
+
+template <typename T>
+FrameSizes report(const T& message) {
+    FrameSizes sizes = measure(message);
+    double saved = 100.0 * static_cast<double>(sizes.named - sizes.compact) / static_cast<double>(sizes.named);
+    std::printf("  %-40s named %5zu B   compact %5zu B   (-%4.1f%%)\n",
+                T::MESSAGE_NAME, sizes.named, sizes.compact, saved);
+    return sizes;
+}
+
+// Batch carrying `mask` slots, each with a formatted display value
+DeviceRemoteControlsBatchMessage batchFor(uint8_t mask) {
+    DeviceRemoteControlsBatchMessage msg{};
+    msg.sequenceNumber = 42;
+    msg.dirtyMask = mask;
+    msg.modulatedMask = mask;
+    for (uint8_t bits = mask; bits != 0; bits &= bits - 1) {
+        msg.values.push_back(0.5f);
+        msg.modulatedValues.push_back(0.5f);
+        msg.displayValues.push_back("-6.02 dB");
+    }
+    return msg;
+}
+
+}  // namespace
+
+int main() {
+    std::printf("[bench_FrameSize] frame size per message\n");
+
+    FrameSizes batch = report(batchFor(0x01));  // One knob automated, rest idle
+    FrameSizes fullBatch = report(batchFor(0xFF));
+    report(RemoteControlValueMessage{3, 0.25f});
+    report(TransportPlayingStateMessage{true});
+    report(TrackVolumeStateMessage{2, 0.8f, "-1.9 dB"});
+    report(LastClickedValueStateMessage{0.3f, "440 Hz"});
+
+    double namedBps = static_cast<double>(batch.named) * BATCH_RATE_HZ;
+    double compactBps = static_cast<double>(batch.compact) * BATCH_RATE_HZ;
+    std::printf("[bench_FrameSize] batch stream @ %.0f Hz: named %.0f B/s, compact %.0f B/s (saves %.0f B/s)\n",
+                BATCH_RATE_HZ, namedBps, compactBps, namedBps - compactBps);
+
+    double sparseSaved = 100.0 * static_cast<double>(fullBatch.compact - batch.compact) /
+                         static_cast<double>(fullBatch.compact);
+    std::printf("[bench_FrameSize] sparse batch (1 of 8 dirty): %zu B vs %zu B for all slots (-%.1f%%)\n",
+                batch.compact, fullBatch.compact, sparseSaved);
+    return 0;
+}
@@ -0,0 +1,157 @@
+// Wire size of windowed name lists: whole names vs front coding
+//
+// Encodes page, track and device windows built from realistic name sets and
+// reports the payload size with whole names and front coded (shared prefix
+// length + suffix), then the controller-side cost of decoding a window and
+// rebuilding its names into the selector cache.
+//
+// Front coding is only applied when it saves bytes, as the host does.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include "protocol/FrontCoding.hpp"
+#include "protocol/MessageStructure.hpp"
+
+namespace {
+
+using namespace Protocol;
+
+constexpr int ITERATIONS = 200000;
+
+// Synth remote-control pages (Polymer/Phase-4 style)
+constexpr std::string_view SYNTH_PAGES[] = {
+    "Osc 1 Pitch",  "Osc 1 Shape",  "Osc 1 Unison", "Osc 2 Pitch",  "Osc 2 Shape",  "Osc 2 Unison",
+    "Filter",       "Filter Env",   "Amp Env",      "LFO 1",        "LFO 2",        "Mod Matrix 1",
+    "Mod Matrix 2", "Macro 1-8",    "Macro 9-16",   "Global"};
+
+// Plugin pages generated from parameter groups
+constexpr std::string_view PLUGIN_PAGES[] = {
+    "Oscillator A Tune", "Oscillator A Warp", "Oscillator A Unison", "Oscillator B Tune",
+    "Oscillator B Warp", "Oscillator B Unison", "Envelope 1",       "Envelope 2",
+    "Envelope 3",        "Envelope 4",         "Filter Cutoff",     "Filter Drive",
+    "Effects Chorus",    "Effects Delay",      "Effects Reverb",    "Effects Compressor"};
+
+// Mix project track names
+constexpr std::string_view TRACKS[] = {
+    "Drums Kick",  "Drums Snare",  "Drums Hats",   "Drums Perc",   "Synth Bus 1", "Synth Bus 2",
+    "Synth Bus 3", "Synth Bus 4",  "Bass",         "Bass Sub",     "Vocal Lead",  "Vocal Double",
+    "Vocal Harm 1", "Vocal Harm 2", "FX Riser",    "FX Impact"};
+
+// Device chain (little shared prefix: the host sends it whole)
+constexpr std::string_view DEVICES[] = {
+    "EQ+",      "Compressor", "Compressor+", "Delay+",  "Reverb",   "Tool",           "Polymer",      "Filter+",
+    "Saturator", "Chorus+",   "Phaser+",     "EQ-5",    "Spectrum", "Transient Control", "Peak Limiter", "Tool"};
+
+constexpr size_t WINDOW = 16;
+
+struct Coded {
+    std::string_view suffixes[WINDOW];
+    uint8_t prefixes[WINDOW];
+    bool used;
+};
+
+Coded frontCode(const std::string_view (&names)[WINDOW]) {
+    Coded coded{};
+    coded.used = bitwig::frontcoding::encode(names, WINDOW, coded.suffixes, coded.prefixes) > 1;  // > count byte
+    return coded;
+}
+
+DevicePageNamesWindowMessage pageWindow(const std::string_view (&names)[WINDOW], bool frontCoded) {
+    Coded coded = frontCode(names);
+    DevicePageNamesWindowMessage msg{};
+    msg.devicePageCount = WINDOW;
+    for (size_t i = 0; i < WINDOW; ++i) {
+        bool code = frontCoded && coded.used;
+        msg.pageNames[i] = code ? coded.suffixes[i] : names[i];
+        if (code) msg.pageNamePrefixes.push_back(coded.prefixes[i]);
+    }
+    return msg;
+}
+
+TrackListWindowMessage trackWindow(const std::string_view (&names)[WINDOW], bool frontCoded) {
+    Coded coded = frontCode(names);
+    TrackListWindowMessage msg{};
+    msg.trackCount = WINDOW;
+    for (size_t i = 0; i < WINDOW; ++i) {
+        bool code = frontCoded && coded.used;
+        msg.tracks[i].trackIndex = static_cast<uint8_t>(i);
+        msg.tracks[i].trackName = code ? coded.suffixes[i] : names[i];
+        msg.tracks[i].color = 0x33AAFF;
+        msg.tracks[i].volume = 0.8f;
+        msg.tracks[i].pan = 0.5f;
+        if (code) msg.trackNamePrefixes.push_back(coded.prefixes[i]);
+    }
+    return msg;
+}
+
+DeviceListWindowMessage deviceWindow(const std::string_view (&names)[WINDOW], bool frontCoded) {
+    Coded coded = frontCode(names);
+    DeviceListWindowMessage msg{};
+    msg.deviceCount = WINDOW;
+    for (size_t i = 0; i < WINDOW; ++i) {
+        bool code = frontCoded && coded.used;
+        msg.devices[i].deviceIndex = static_cast<uint8_t>(i);
+        msg.devices[i].deviceName = code ? coded.suffixes[i] : names[i];
+        msg.devices[i].isEnabled = true;
+        if (code) msg.deviceNamePrefixes.push_back(coded.prefixes[i]);
+    }
+    return msg;
+}
+
+template <typename T>
+size_t payloadSize(const T& message) {
+    static uint8_t buffer[MAX_PAYLOAD_SIZE];
+    return message.encode(buffer, sizeof(buffer));
+}
+
+template <typename T>
+void report(const char* label, const T& whole, const T& coded) {
+    size_t wholeSize = payloadSize(whole);
+    size_t codedSize = payloadSize(coded);
+    double saved = 100.0 * static_cast<double>(wholeSize - codedSize) / static_cast<double>(wholeSize);
+    std::printf("  %-24s %-22s whole %4zu B   front coded %4zu B   (-%4zu B, -%4.1f%%)\n", label,
+                T::MESSAGE_NAME, wholeSize, codedSize, wholeSize - codedSize, saved);
+}
+
+// Decode a page window and rebuild its names, as PageHostHandler does
+double decodeNsPerWindow(const DevicePageNamesWindowMessage& message) {
+    uint8_t buffer[DevicePageNamesWindowMessage::MAX_PAYLOAD_SIZE];
+    uint16_t len = message.encode(buffer, sizeof(buffer));
+    std::string cache[WINDOW];
+    size_t checksum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int it = 0; it < ITERATIONS; ++it) {
+        auto msg = DevicePageNamesWindowMessage::decode(buffer, len);
+        bitwig::frontcoding::NameDecoder names(msg->pageNamePrefixes.begin(), msg->pageNamePrefixes.size());
+        for (size_t i = 0; i < WINDOW; ++i) {
+            if (msg->pageNames[i].empty()) break;
+            cache[i].assign(names.next(msg->pageNames[i]));
+        }
+        checksum += cache[it % WINDOW].size();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    if (checksum == 0) std::printf("  (empty cache)\n");
+    return std::chrono::duration<double, std::nano>(elapsed).count() / ITERATIONS;
+}
+
+}  // namespace
+
+int main() {
+    std::printf("[bench_FrontCoding] payload size per 16-item window\n");
+
+    report("synth pages", pageWindow(SYNTH_PAGES, false), pageWindow(SYNTH_PAGES, true));
+    report("plugin pages", pageWindow(PLUGIN_PAGES, false), pageWindow(PLUGIN_PAGES, true));
+    report("mix tracks", trackWindow(TRACKS, false), trackWindow(TRACKS, true));
+    report("device chain", deviceWindow(DEVICES, false), deviceWindow(DEVICES, true));
+
+    std::printf("[bench_FrontCoding] decode + rebuild names x %d\n", ITERATIONS);
+    std::printf("  %-24s %7.1f ns/window\n", "plugin pages whole", decodeNsPerWindow(pageWindow(PLUGIN_PAGES, false)));
+    std::printf("  %-24s %7.1f ns/window\n", "plugin pages coded", decodeNsPerWindow(pageWindow(PLUGIN_PAGES, true)));
+    return 0;
+}
@@ -0,0 +1,230 @@
+// Encode / decode / dispatch cost of every protocol message
+//
+// Each message is decoded from a synthetic worst-case payload (every length
+// and count byte 0x20: 32-char strings, arrays filled to capacity, e.g. full
+// 16-item windows), then round-tripped through encode(), decode() and
+// DecoderRegistry::dispatch(). Reports ns/op, encoded bytes and heap
+// allocations per op (global operator new is counted).
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "protocol/DecoderRegistry.hpp"
+#include "protocol/MessageNames.hpp"
+#include "protocol/MessageStructure.hpp"
+
+namespace {
+
+size_t g_allocations = 0;
+
+}  // namespace
+
+void* operator new(size_t size) {
+    ++g_allocations;
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+using namespace Protocol;
+
+constexpr int ITERATIONS = 20000;
+constexpr uint8_t WORST_CASE_BYTE = 0x20;
+
+volatile uint32_t g_sink = 0;
+
+struct Callbacks : ProtocolCallbacks {};
+
+struct Result {
+    const char* name;
+    bool ok;
+    size_t bytes;
+    double encodeNs;
+    double decodeNs;
+    double dispatchNs;
+    double allocsPerOp;
+};
+
+template <typename Fn>
+double nsPerOp(Fn&& op) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) op();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / ITERATIONS;
+}
+
+template <typename T, InlineCallback<void(const T&)> ProtocolCallbacks::*Callback>
+Result runMessage() {
+    static uint8_t source[T::MAX_PAYLOAD_SIZE + 64];
+    static uint8_t encoded[T::MAX_PAYLOAD_SIZE + 64];
+    std::memset(source, WORST_CASE_BYTE, sizeof(source));
+
+    Result result{T::MESSAGE_NAME, false, 0, 0, 0, 0, 0};
+    auto message = T::decode(source, static_cast<uint16_t>(sizeof(source)));
+    if (!message.has_value()) return result;
+
+    uint16_t len = message->encode(encoded, static_cast<uint16_t>(sizeof(encoded)));
+    result.ok = (len > 0 || T::MAX_PAYLOAD_SIZE == 0) && T::decode(encoded, len).has_value();
+    result.bytes = len;
+
+    Callbacks callbacks;
+    callbacks.*Callback = [](const T&) { g_sink = g_sink + 1; };
+
+    size_t allocationsBefore = g_allocations;
+    result.encodeNs = nsPerOp([&] { g_sink = g_sink + message->encode(encoded, static_cast<uint16_t>(sizeof(encoded))); });
+    result.decodeNs = nsPerOp([&] { g_sink = g_sink + T::decode(encoded, len).has_value(); });
+    result.dispatchNs = nsPerOp([&] {
+        g_sink = g_sink + static_cast<uint32_t>(DecoderRegistry::dispatch(callbacks, T::MESSAGE_ID, encoded, len));
+    });
+    result.allocsPerOp = static_cast<double>(g_allocations - allocationsBefore) / (3.0 * ITERATIONS);
+    return result;
+}
+
+using Runner = Result (*)();
+
+template <typename T, InlineCallback<void(const T&)> ProtocolCallbacks::*Callback>
+constexpr Runner entry() {
+    return &runMessage<T, Callback>;
+}
+
+constexpr Runner RUNNERS[] = {
+        entry<DeviceChainStampMessage, &ProtocolCallbacks::onDeviceChainStamp>(),
+        entry<DeviceChangeMessage, &ProtocolCallbacks::onDeviceChange>(),
+        entry<DeviceChangeHeaderMessage, &ProtocolCallbacks::onDeviceChangeHeader>(),
+        entry<DeviceChildrenMessage, &ProtocolCallbacks::onDeviceChildren>(),
+        entry<DeviceEnabledStateMessage, &ProtocolCallbacks::onDeviceEnabledState>(),
+        entry<DeviceListWindowMessage, &ProtocolCallbacks::onDeviceListWindow>(),
+        entry<DevicePageChangeMessage, &ProtocolCallbacks::onDevicePageChange>(),
+        entry<DevicePageNamesWindowMessage, &ProtocolCallbacks::onDevicePageNamesWindow>(),
+        entry<DevicePageSelectMessage, &ProtocolCallbacks::onDevicePageSelect>(),
+        entry<DeviceRemoteControlsBatchMessage, &ProtocolCallbacks::onDeviceRemoteControlsBatch>(),
+        entry<DeviceRemoteControlDiscreteValuesMessage, &ProtocolCallbacks::onDeviceRemoteControlDiscreteValues>(),
+        entry<DeviceRemoteControlHasAutomationChangeMessage, &ProtocolCallbacks::onDeviceRemoteControlHasAutomationChange>(),
+        entry<DeviceRemoteControlIsModulatedChangeMessage, &ProtocolCallbacks::onDeviceRemoteControlIsModulatedChange>(),
+        entry<DeviceRemoteControlNameChangeMessage, &ProtocolCallbacks::onDeviceRemoteControlNameChange>(),
+        entry<DeviceRemoteControlOriginChangeMessage, &ProtocolCallbacks::onDeviceRemoteControlOriginChange>(),
+        entry<DeviceRemoteControlRestoreAutomationMessage, &ProtocolCallbacks::onDeviceRemoteControlRestoreAutomation>(),
+        entry<DeviceRemoteControlTouchMessage, &ProtocolCallbacks::onDeviceRemoteControlTouch>(),
+        entry<DeviceRemoteControlUpdateMessage, &ProtocolCallbacks::onDeviceRemoteControlUpdate>(),
+        entry<DeviceSelectMessage, &ProtocolCallbacks::onDeviceSelect>(),
+        entry<DeviceStateMessage, &ProtocolCallbacks::onDeviceState>(),
+        entry<EnterDeviceChildMessage, &ProtocolCallbacks::onEnterDeviceChild>(),
+        entry<EnterTrackGroupMessage, &ProtocolCallbacks::onEnterTrackGroup>(),
+        entry<ExitToParentMessage, &ProtocolCallbacks::onExitToParent>(),
+        entry<ExitTrackGroupMessage, &ProtocolCallbacks::onExitTrackGroup>(),
+        entry<FlowCreditMessage, &ProtocolCallbacks::onFlowCredit>(),
+        entry<HostDeactivatedMessage, &ProtocolCallbacks::onHostDeactivated>(),
+        entry<HostInitializedMessage, &ProtocolCallbacks::onHostInitialized>(),
+        entry<LastClickedTouchMessage, &ProtocolCallbacks::onLastClickedTouch>(),
+        entry<LastClickedUpdateMessage, &ProtocolCallbacks::onLastClickedUpdate>(),
+        entry<LastClickedValueMessage, &ProtocolCallbacks::onLastClickedValue>(),
+        entry<LastClickedValueStateMessage, &ProtocolCallbacks::onLastClickedValueState>(),
+        entry<RemoteControlValueMessage, &ProtocolCallbacks::onRemoteControlValue>(),
+        entry<RemoteControlValueStateMessage, &ProtocolCallbacks::onRemoteControlValueState>(),
+        entry<RenderStatsMessage, &ProtocolCallbacks::onRenderStats>(),
+        entry<RequestDeviceChildrenMessage, &ProtocolCallbacks::onRequestDeviceChildren>(),
+        entry<RequestDeviceListWindowMessage, &ProtocolCallbacks::onRequestDeviceListWindow>(),
+        entry<RequestDevicePageNamesWindowMessage, &ProtocolCallbacks::onRequestDevicePageNamesWindow>(),
+        entry<RequestHostStatusMessage, &ProtocolCallbacks::onRequestHostStatus>(),
+        entry<RequestSendDestinationsMessage, &ProtocolCallbacks::onRequestSendDestinations>(),
+        entry<RequestTrackListWindowMessage, &ProtocolCallbacks::onRequestTrackListWindow>(),
+        entry<RequestTrackSendListMessage, &ProtocolCallbacks::onRequestTrackSendList>(),
+        entry<ResetAutomationOverridesMessage, &ProtocolCallbacks::onResetAutomationOverrides>(),
+        entry<SelectMixSendMessage, &ProtocolCallbacks::onSelectMixSend>(),
+        entry<SendDestinationsListMessage, &ProtocolCallbacks::onSendDestinationsList>(),
+        entry<StringDefineMessage, &ProtocolCallbacks::onStringDefine>(),
+        entry<StringMissMessage, &ProtocolCallbacks::onStringMiss>(),
+        entry<TrackActivateMessage, &ProtocolCallbacks::onTrackActivate>(),
+        entry<TrackArmMessage, &ProtocolCallbacks::onTrackArm>(),
+        entry<TrackArmStateMessage, &ProtocolCallbacks::onTrackArmState>(),
+        entry<TrackChangeMessage, &ProtocolCallbacks::onTrackChange>(),
+        entry<TrackListWindowMessage, &ProtocolCallbacks::onTrackListWindow>(),
+        entry<TrackMuteMessage, &ProtocolCallbacks::onTrackMute>(),
+        entry<TrackMutedBySoloStateMessage, &ProtocolCallbacks::onTrackMutedBySoloState>(),
+        entry<TrackMuteStateMessage, &ProtocolCallbacks::onTrackMuteState>(),
+        entry<TrackPanMessage, &ProtocolCallbacks::onTrackPan>(),
+        entry<TrackPanHasAutomationStateMessage, &ProtocolCallbacks::onTrackPanHasAutomationState>(),
+        entry<TrackPanModulatedValueStateMessage, &ProtocolCallbacks::onTrackPanModulatedValueState>(),
+        entry<TrackPanStateMessage, &ProtocolCallbacks::onTrackPanState>(),
+        entry<TrackPanTouchMessage, &ProtocolCallbacks::onTrackPanTouch>(),
+        entry<TrackSelectMessage, &ProtocolCallbacks::onTrackSelect>(),
+        entry<TrackSendEnabledMessage, &ProtocolCallbacks::onTrackSendEnabled>(),
+        entry<TrackSendEnabledStateMessage, &ProtocolCallbacks::onTrackSendEnabledState>(),
+        entry<TrackSendHasAutomationStateMessage, &ProtocolCallbacks::onTrackSendHasAutomationState>(),
+        entry<TrackSendListMessage, &ProtocolCallbacks::onTrackSendList>(),
+        entry<TrackSendModeMessage, &ProtocolCallbacks::onTrackSendMode>(),
+        entry<TrackSendModeStateMessage, &ProtocolCallbacks::onTrackSendModeState>(),
+        entry<TrackSendModulatedValueStateMessage, &ProtocolCallbacks::onTrackSendModulatedValueState>(),
+        entry<TrackSendPreFaderStateMessage, &ProtocolCallbacks::onTrackSendPreFaderState>(),
+        entry<TrackSendTouchMessage, &ProtocolCallbacks::onTrackSendTouch>(),
+        entry<TrackSendValueMessage, &ProtocolCallbacks::onTrackSendValue>(),
+        entry<TrackSendValueStateMessage, &ProtocolCallbacks::onTrackSendValueState>(),
+        entry<TrackSoloMessage, &ProtocolCallbacks::onTrackSolo>(),
+        entry<TrackSoloStateMessage, &ProtocolCallbacks::onTrackSoloState>(),
+        entry<TrackVolumeMessage, &ProtocolCallbacks::onTrackVolume>(),
+        entry<TrackVolumeHasAutomationStateMessage, &ProtocolCallbacks::onTrackVolumeHasAutomationState>(),
+        entry<TrackVolumeModulatedValueStateMessage, &ProtocolCallbacks::onTrackVolumeModulatedValueState>(),
+        entry<TrackVolumeStateMessage, &ProtocolCallbacks::onTrackVolumeState>(),
+        entry<TrackVolumeTouchMessage, &ProtocolCallbacks::onTrackVolumeTouch>(),
+        entry<TransportArrangerAutomationWriteEnabledMessage, &ProtocolCallbacks::onTransportArrangerAutomationWriteEnabled>(),
+        entry<TransportArrangerAutomationWriteEnabledStateMessage, &ProtocolCallbacks::onTransportArrangerAutomationWriteEnabledState>(),
+        entry<TransportArrangerOverdubEnabledMessage, &ProtocolCallbacks::onTransportArrangerOverdubEnabled>(),
+        entry<TransportArrangerOverdubEnabledStateMessage, &ProtocolCallbacks::onTransportArrangerOverdubEnabledState>(),
+        entry<TransportAutomationOverrideActiveStateMessage, &ProtocolCallbacks::onTransportAutomationOverrideActiveState>(),
+        entry<TransportAutomationWriteModeMessage, &ProtocolCallbacks::onTransportAutomationWriteMode>(),
+        entry<TransportAutomationWriteModeStateMessage, &ProtocolCallbacks::onTransportAutomationWriteModeState>(),
+        entry<TransportClipLauncherAutomationWriteEnabledMessage, &ProtocolCallbacks::onTransportClipLauncherAutomationWriteEnabled>(),
+        entry<TransportClipLauncherAutomationWriteEnabledStateMessage, &ProtocolCallbacks::onTransportClipLauncherAutomationWriteEnabledState>(),
+        entry<TransportClipLauncherOverdubEnabledMessage, &ProtocolCallbacks::onTransportClipLauncherOverdubEnabled>(),
+        entry<TransportClipLauncherOverdubEnabledStateMessage, &ProtocolCallbacks::onTransportClipLauncherOverdubEnabledState>(),
+        entry<TransportPlayMessage, &ProtocolCallbacks::onTransportPlay>(),
+        entry<TransportPlayingStateMessage, &ProtocolCallbacks::onTransportPlayingState>(),
+        entry<TransportRecordMessage, &ProtocolCallbacks::onTransportRecord>(),
+        entry<TransportRecordingStateMessage, &ProtocolCallbacks::onTransportRecordingState>(),
+        entry<TransportStopMessage, &ProtocolCallbacks::onTransportStop>(),
+        entry<TransportTempoMessage, &ProtocolCallbacks::onTransportTempo>(),
+        entry<TransportTempoStateMessage, &ProtocolCallbacks::onTransportTempoState>(),
+        entry<ViewStateMessage, &ProtocolCallbacks::onViewState>()
+};
+
+static_assert(sizeof(RUNNERS) / sizeof(RUNNERS[0]) == MESSAGE_COUNT, "Every message should be benchmarked");
+
+}  // namespace
+
+int main() {
+    std::printf("[bench_ProtocolCodec] %d ops per message, worst-case payloads\n", ITERATIONS);
+    std::printf("  %-48s %6s %10s %10s %10s %8s\n", "message", "bytes", "encode ns", "decode ns", "dispatch", "allocs");
+
+    size_t failures = 0;
+    double totalAllocs = 0;
+    const Result* largest = nullptr;
+    static Result results[MESSAGE_COUNT];
+
+    for (size_t i = 0; i < MESSAGE_COUNT; ++i) {
+        Result& r = results[i];
+        r = RUNNERS[i]();
+        if (!r.ok) {
+            ++failures;
+            std::printf("  %-48s round-trip FAILED\n", r.name);
+            continue;
+        }
+        totalAllocs += r.allocsPerOp;
+        if (largest == nullptr || r.bytes > largest->bytes) largest = &r;
+        std::printf("  %-48s %6zu %10.1f %10.1f %10.1f %8.2f\n",
+                    r.name, r.bytes, r.encodeNs, r.decodeNs, r.dispatchNs, r.allocsPerOp);
+    }
+
+    if (largest != nullptr) {
+        std::printf("[bench_ProtocolCodec] largest: %s (%zu B), allocations/op across all messages: %.2f\n",
+                    largest->name, largest->bytes, totalAllocs);
+    }
+    return failures == 0 ? 0 : 1;
+}
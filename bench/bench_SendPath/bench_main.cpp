@@ -0,0 +1,125 @@
+// Cost of BitwigProtocol::send(), from the generated API call to the transport
+//
+// Drives the real BitwigProtocol against a stub transport (bench/oc/ holds
+// native stand-ins for the framework headers it includes):
+//
+// - "value"     remoteControlValue() + flush(): coalesced, one frame per send
+// - "value x8"  8 slots, then one flush(): coalesced into one envelope
+// - "play"      transportPlay() + flush(): envelope record, compact frame
+// - "named"     transportPlay() with compact frames off: own named frame
+//
+// Reports core cycles per send (DWT CYCCNT on Teensy, rdtsc on x86; the
+// generic timer on AArch64 counts ticks, not cycles), time per send, and the
+// stack depth reached when the transport is called (distance from the
+// caller's frame).
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "protocol/BitwigProtocol.hpp"
+
+namespace {
+
+#if defined(ARM_DWT_CYCCNT)
+constexpr int ITERATIONS = 100000;  // 32-bit counter wraps every ~7 s at 600 MHz
+inline uint32_t cycles() { return ARM_DWT_CYCCNT; }
+#elif defined(__x86_64__) || defined(__i386__)
+constexpr int ITERATIONS = 1000000;
+inline uint64_t cycles() { return __rdtsc(); }
+#elif defined(__aarch64__)
+constexpr int ITERATIONS = 1000000;
+inline uint64_t cycles() {
+    uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+}
+#else
+constexpr int ITERATIONS = 1000000;
+inline uint64_t cycles() {
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+#endif
+
+uintptr_t g_stack_base = 0;
+size_t g_peak_stack = 0;
+
+class StubTransport : public oc::interface::ITransport {
+public:
+    void send(const uint8_t* data, size_t len) override {
+        size_t depth = g_stack_base - reinterpret_cast<uintptr_t>(__builtin_frame_address(0));
+        if (depth > g_peak_stack) g_peak_stack = depth;
+        checksum_ = checksum_ + data[0] + data[len - 1] + static_cast<uint32_t>(len);
+        ++frames_;
+    }
+
+    void setOnReceive(std::function<void(const uint8_t*, size_t)>) override {}
+
+    uint32_t checksum() const { return checksum_; }
+    uint32_t frames() const { return frames_; }
+
+private:
+    volatile uint32_t checksum_ = 0;
+    uint32_t frames_ = 0;
+};
+
+float valueOf(int i) { return static_cast<float>(i & 0xFF) / 255.0f; }
+
+template <typename Fn>
+void run(const char* label, StubTransport& transport, int sendsPerCall, Fn&& sendOnce) {
+    g_peak_stack = 0;
+    g_stack_base = reinterpret_cast<uintptr_t>(__builtin_frame_address(0));
+    uint32_t framesBefore = transport.frames();
+
+    int calls = ITERATIONS / sendsPerCall;
+    auto start = std::chrono::steady_clock::now();
+    auto startCycles = cycles();
+    for (int i = 0; i < calls; ++i) {
+        sendOnce(i);
+    }
+    auto elapsedCycles = cycles() - startCycles;
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    double sends = static_cast<double>(calls) * sendsPerCall;
+    double cyclesPerSend = static_cast<double>(elapsedCycles) / sends;
+    double nsPerSend = std::chrono::duration<double, std::nano>(elapsed).count() / sends;
+    double framesPerSend = (transport.frames() - framesBefore) / sends;
+    std::printf("  %-9s %8.1f cycles/send %7.1f ns/send  %4.2f frames/send"
+                "  stack at transport %5zu B\n",
+                label, cyclesPerSend, nsPerSend, framesPerSend, g_peak_stack);
+}
+
+}  // namespace
+
+int main() {
+    StubTransport transport;
+    bitwig::BitwigProtocol protocol(transport);
+    protocol.setCompactFrames(true);
+
+    std::printf("[bench_SendPath] BitwigProtocol::send x %d\n", ITERATIONS);
+
+    run("value", transport, 1, [&](int i) {
+        protocol.remoteControlValue(static_cast<uint8_t>(i & 7), valueOf(i));
+        protocol.flush();
+    });
+    run("value x8", transport, 8, [&](int i) {
+        for (uint8_t slot = 0; slot < 8; ++slot) {
+            protocol.remoteControlValue(slot, valueOf(i + slot));
+        }
+        protocol.flush();
+    });
+    run("play", transport, 1, [&](int i) {
+        protocol.transportPlay((i & 1) != 0);
+        protocol.flush();
+    });
+
+    protocol.setCompactFrames(false);
+    run("named", transport, 1, [&](int i) { protocol.transportPlay((i & 1) != 0); });
+
+    std::printf("[bench_SendPath] checksum %u\n", static_cast<unsigned>(transport.checksum()));
+    return 0;
+}
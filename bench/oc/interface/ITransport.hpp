@@ -0,0 +1,19 @@
+#pragma once
+
+// Native stand-in for the framework transport interface: only what
+// BitwigProtocol uses, so benches can drive the real send path.
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace oc::interface {
+
+class ITransport {
+public:
+    virtual ~ITransport() = default;
+    virtual void send(const uint8_t* data, size_t len) = 0;
+    virtual void setOnReceive(std::function<void(const uint8_t*, size_t)> callback) = 0;
+};
+
+}  // namespace oc::interface
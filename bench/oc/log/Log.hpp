@@ -0,0 +1,8 @@
+#pragma once
+
+// Native stand-in for the framework logger: benches log nothing.
+
+#define OC_LOG_DEBUG(...) ((void)0)
+#define OC_LOG_INFO(...) ((void)0)
+#define OC_LOG_WARN(...) ((void)0)
+#define OC_LOG_ERROR(...) ((void)0)
@@ -0,0 +1,16 @@
+#pragma once
+
+// Native stand-in for the framework clock.
+
+#include <chrono>
+#include <cstdint>
+
+namespace oc::time {
+
+inline uint32_t millis() {
+    using namespace std::chrono;
+    return static_cast<uint32_t>(
+        duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+}  // namespace oc::time
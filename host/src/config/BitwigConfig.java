@@ -112,6 +112,46 @@ public final class BitwigConfig {
      */
     public static final int TOGGLE_CONFIRM_TIMEOUT_MS = STANDARD_DELAY_MS;
 
+    // ═══════════════════════════════════════════════════════════════════
+    // REMOTE CONTROLS BATCH
+    // ═══════════════════════════════════════════════════════════════════
+
+    /**
+     * Minimum interval between two DEVICE_REMOTE_CONTROLS_BATCH messages.
+     * Matches the controller's LVGL refresh period (~60 Hz): batches sent
+     * faster than the screen redraws would only be overwritten.
+     * Batches are event-driven: nothing is scheduled while values are idle.
+     * Also the default until the controller reports RENDER_STATS.
+     */
+    public static final int BATCH_MIN_INTERVAL_MS = 16;
+
+    /**
+     * Upper bound of the adapted batch interval (controller slow or busy).
+     * Keeps automation readable on screen even under heavy load.
+     */
+    public static final int BATCH_MAX_INTERVAL_MS = 100;
+
+    /**
+     * Below this controller headroom (RENDER_STATS), the batch interval is doubled.
+     */
+    public static final int BATCH_HEADROOM_LOW_PERCENT = 20;
+
+    // ═══════════════════════════════════════════════════════════════════
+    // NAMES
+    // ═══════════════════════════════════════════════════════════════════
+
+    /**
+     * Front code page/device/track name windows (shared prefix + suffix).
+     * Only applied to a window when it saves bytes; see FrontCodingUtils.
+     */
+    public static final boolean FRONT_CODE_NAME_WINDOWS = true;
+
+    /**
+     * Send repeated names once (STRING_DEFINE) and reference them afterwards.
+     * See protocol.StringDictionary.
+     */
+    public static final boolean USE_STRING_DICTIONARY = true;
+
     // ═══════════════════════════════════════════════════════════════════
     // BANK SIZES
     // ═══════════════════════════════════════════════════════════════════
@@ -129,6 +169,12 @@ public final class BitwigConfig {
     // WINDOWED LIST LOADING
     // ═══════════════════════════════════════════════════════════════════
 
-    /** Window size for lazy-loading large lists (devices, tracks, pages) */
+    /** Items per window message (devices, tracks, pages), the protocol array size */
     public static final int LIST_WINDOW_SIZE = 16;
+
+    /**
+     * Largest windowSize honoured per request (must match LinkMeter::MAX_WINDOW_ITEMS).
+     * A request is answered with as many LIST_WINDOW_SIZE messages as it spans.
+     */
+    public static final int MAX_LIST_WINDOW_SIZE = 64;
 }
@@ -167,7 +167,7 @@ public class DeviceController {
         // Request windowed page names FROM controller
         protocol.onRequestDevicePageNamesWindow = msg -> {
             if (deviceHost != null) {
-                deviceHost.sendPageNamesWindow(msg.getPageStartIndex());
+                deviceHost.sendPageNamesWindow(msg.getPageStartIndex(), msg.getWindowSize());
             }
         };
 
@@ -189,7 +189,7 @@ public class DeviceController {
         // Request windowed device list FROM controller
         protocol.onRequestDeviceListWindow = msg -> {
             if (deviceHost != null) {
-                deviceHost.sendDeviceListWindow(msg.getDeviceStartIndex());
+                deviceHost.sendDeviceListWindow(msg.getDeviceStartIndex(), msg.getWindowSize());
             }
         };
 
@@ -240,6 +240,20 @@ public class DeviceController {
             }
         };
 
+        // Controller render load (about once per second) - paces batches
+        protocol.onRenderStats = msg -> {
+            if (deviceHost != null) {
+                deviceHost.setControllerRenderStats(msg.getRenderHz(), msg.getHeadroomPercent());
+            }
+        };
+
+        // Controller lost remote control batches (reported with FLOW_CREDIT) - resend every slot
+        protocol.onBatchLoss = () -> {
+            if (deviceHost != null) {
+                deviceHost.resendAllParameters();
+            }
+        };
+
         // ========================================================================
         // Automation Restore Callback
         // ========================================================================
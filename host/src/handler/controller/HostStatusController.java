@@ -36,16 +36,28 @@ public class HostStatusController {
 
     private void setupProtocolCallbacks() {
         protocol.onRequestHostStatus = msg -> {
-            sendFullState();
+            // Controller advertises compact framing support - accept it
+            sendFullState(msg.getCompactFrames());
         };
     }
 
     /**
-     * Send full host state to controller
-     * Called on initial connection and on resync request
+     * Send full host state to controller, keeping the current framing
+     * Called on initial connection and bridge reconnect
      */
     public void sendFullState() {
-        protocol.hostInitialized(true);
+        sendFullState(protocol.isCompactFrames());
+    }
+
+    /**
+     * Send full host state to controller
+     * HOST_INITIALIZED goes out in the current framing, then compact framing
+     * is switched on or off for everything that follows.
+     */
+    public void sendFullState(boolean compactFrames) {
+        protocol.strings().reset();  // Controller clears its dictionary on HOST_INITIALIZED
+        protocol.hostInitialized(true, compactFrames);
+        protocol.setCompactFrames(compactFrames);
         transportHost.sendInitialState();
         deviceHost.sendInitialState();
         trackHost.sendInitialState();
@@ -53,7 +53,7 @@ public class TrackController {
         // Request windowed track list FROM controller
         protocol.onRequestTrackListWindow = msg -> {
             if (trackHost != null) {
-                trackHost.sendTrackListWindow(msg.getTrackStartIndex());
+                trackHost.sendTrackListWindow(msg.getTrackStartIndex(), msg.getWindowSize());
             }
         };
 
@@ -2,6 +2,7 @@ package handler.host;
 
 import com.bitwig.extension.controller.api.*;
 import protocol.Protocol;
+import protocol.StringDictionary;
 import protocol.struct.DeviceChangeHeaderMessage;
 import protocol.struct.DeviceChildrenMessage;
 import protocol.struct.DeviceListWindowMessage;
@@ -9,8 +10,13 @@ import protocol.struct.DevicePageChangeMessage;
 import config.BitwigConfig;
 import protocol.DeviceType;
 import protocol.ParameterType;
+import util.FrontCodingUtils;
+import util.HashUtils;
+import util.WindowUtils;
 import java.util.List;
 import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.Map;
 import handler.controller.DeviceController;
 
 /**
@@ -51,7 +57,6 @@ public class DeviceHost {
     private boolean controllerSelectorActive = false;
 
     // Combined batch for values + modulated values (single synchronized update)
-    private static final int BATCH_INTERVAL_MS = 1  ; // ~66Hz batch rate (15ms = imperceptible for UI)
     private final float[] modulatedValues = new float[BitwigConfig.MAX_PARAMETERS];
     private final float[] parameterValues = new float[BitwigConfig.MAX_PARAMETERS];
     private final float[] pendingValues = new float[BitwigConfig.MAX_PARAMETERS];
@@ -61,11 +66,33 @@ public class DeviceHost {
     private final boolean[] modulationVisible = new boolean[BitwigConfig.MAX_PARAMETERS];
     private int valuesDirtyMask = 0;  // Bit mask: which parameter values changed
     private int valuesEchoMask = 0;   // Bit mask: which parameters are echoes
+    private int modulationDirtyMask = 0; // Bit mask: which modulated values must be resent
     private boolean batchDirty = false; // True if any value or modulated value changed
+    private boolean batchScheduled = false; // A batchTick is pending (armed by markBatchDirty)
+    private long lastBatchSentMs = 0; // Paces batches to batchIntervalMs
+    private volatile int batchIntervalMs = BitwigConfig.BATCH_MIN_INTERVAL_MS; // Adapted from RENDER_STATS
+    private int batchSequence = 0; // Incremented per batch sent (stale-drop / loss detection on the controller)
+
+    // Mirror of the controller's device chain cache (DeviceChainCache.hpp): chain identity -> stamp
+    // of the chains it holds, least recently announced first. Both sides apply the same LRU to the
+    // same DEVICE_CHAIN_STAMP sequence, so a chain found here needs no window on announce.
+    private static final int CHAIN_CACHE_SIZE = 4;  // Must match DeviceChainCache::CAPACITY
+    private final LinkedHashMap<Long, Long> sentChains = new LinkedHashMap<Long, Long>(8, 0.75f, true) {
+        @Override
+        protected boolean removeEldestEntry(Map.Entry<Long, Long> eldest) {
+            return size() > CHAIN_CACHE_SIZE;
+        }
+    };
+
+    // windowSize of the controller's last device list request, reused for chain announces
+    private int deviceWindowSize = BitwigConfig.LIST_WINDOW_SIZE;
 
-    // Pre-allocated String array for display values (avoid null in message)
-    private final String[] batchDisplayValues = new String[BitwigConfig.MAX_PARAMETERS];
-    private final float[] batchModulatedValues = new float[BitwigConfig.MAX_PARAMETERS];
+    // Sparse batch arrays, pre-allocated per entry count (encoder uses array.length)
+    // batchValues[n] / batchDisplayValues[n] / batchModulatedValues[n] hold n packed entries
+    private static final int ALL_PARAMETERS_MASK = (1 << BitwigConfig.MAX_PARAMETERS) - 1;
+    private final float[][] batchValues = new float[BitwigConfig.MAX_PARAMETERS + 1][];
+    private final String[][] batchDisplayValues = new String[BitwigConfig.MAX_PARAMETERS + 1][];
+    private final float[][] batchModulatedValues = new float[BitwigConfig.MAX_PARAMETERS + 1][];
 
     public DeviceHost(
         ControllerHost host,
@@ -81,6 +108,12 @@ public class DeviceHost {
         this.cursorDevice = cursorDevice;
         this.remoteControls = remoteControls;
         this.deviceBank = deviceBank;
+
+        for (int n = 0; n <= BitwigConfig.MAX_PARAMETERS; n++) {
+            batchValues[n] = new float[n];
+            batchDisplayValues[n] = new String[n];
+            batchModulatedValues[n] = new float[n];
+        }
     }
 
     public void setupObservers() {
@@ -97,9 +130,6 @@ public class DeviceHost {
         setupRemoteControlsObservables();
         setupDeviceBankObservables();
         setupLayerAndDrumBanksObservables();
-
-        // Start combined batch timer
-        startBatchTimer();
     }
 
     /**
@@ -119,46 +149,96 @@ public class DeviceHost {
     }
 
     /**
-     * Start the combined batch timer.
-     * Sends values and modulated values in a single synchronized message.
+     * Flag the batch dirty and arm a single deferred batchTick.
+     * The first change after an idle period goes out immediately; changes
+     * arriving faster are merged so batches are at least batchIntervalMs
+     * apart. Nothing runs while idle.
      */
-    private void startBatchTimer() {
-        host.scheduleTask(this::batchTick, BATCH_INTERVAL_MS);
+    private void markBatchDirty() {
+        batchDirty = true;
+        scheduleBatch();
+    }
+
+    private void scheduleBatch() {
+        if (batchScheduled) return;
+        batchScheduled = true;
+        long sinceLast = System.currentTimeMillis() - lastBatchSentMs;
+        long delay = Math.max(0, batchIntervalMs - sinceLast);
+        host.scheduleTask(this::batchTick, delay);
+    }
+
+    /** Resume individual observers after a device change, and send what they held back */
+    private void endDeviceChange() {
+        deviceChangePending = false;
+        if (batchDirty) scheduleBatch();
+    }
+
+    /** Resume value/modulation sends after a selector response, and send what was held back */
+    private void endSelectorRequest() {
+        selectorRequestActive = false;
+        if (batchDirty) scheduleBatch();
     }
 
     /**
-     * Combined batch tick: send all values and modulated values in one message.
+     * Combined batch tick: send changed values and modulated values in one message.
      * This ensures perfect synchronization between value and modulation display.
+     *
+     * The batch is sparse: values/displayValues only carry the slots set in
+     * valuesDirtyMask, modulatedValues only those set in modulationDirtyMask,
+     * packed in ascending slot order. A single automated knob costs a few
+     * bytes instead of all 8 values and display strings.
      */
     private void batchTick() {
-        // Reschedule for next tick
-        host.scheduleTask(this::batchTick, BATCH_INTERVAL_MS);
+        batchScheduled = false;
 
-        // Skip if not on RemoteControls view or selector is open
+        // Only send if something changed
+        if (!batchDirty) return;
+
+        // Not on RemoteControls view or selector open: keep dirty, setControllerViewState re-arms
         if (controllerViewType != 0 || controllerSelectorActive) return;
+
+        // Short transition in progress: keep dirty, endDeviceChange / endSelectorRequest re-arm
         if (deviceChangePending || selectorRequestActive) return;
 
-        // Only send if something changed
-        if (!batchDirty) return;
         batchDirty = false;
+        lastBatchSentMs = System.currentTimeMillis();
+
+        // A value change moves the ribbon offset too, so resend its modulated value
+        int modulatedMask = modulationDirtyMask | valuesDirtyMask;
+        float[] values = batchValues[Integer.bitCount(valuesDirtyMask)];
+        String[] displayValues = batchDisplayValues[Integer.bitCount(valuesDirtyMask)];
+        float[] modulated = batchModulatedValues[Integer.bitCount(modulatedMask)];
 
-        // Build display values array (replace nulls with empty strings)
+        // Pack dirty entries (replace null display values with empty strings)
         // Build hasAutomationMask from hasAutomationState array
         int hasAutomationMask = 0;
+        int valueCount = 0;
+        int modulatedCount = 0;
         for (int i = 0; i < BitwigConfig.MAX_PARAMETERS; i++) {
-            batchDisplayValues[i] = pendingDisplayValues[i] != null ? pendingDisplayValues[i] : "";
-            batchModulatedValues[i] = modulationVisible[i] ? modulatedValues[i] : pendingValues[i];
+            int bit = 1 << i;
+            if ((valuesDirtyMask & bit) != 0) {
+                values[valueCount] = pendingValues[i];
+                displayValues[valueCount] = pendingDisplayValues[i] != null ? pendingDisplayValues[i] : "";
+                valueCount++;
+            }
+            if ((modulatedMask & bit) != 0) {
+                modulated[modulatedCount++] = modulationVisible[i] ? modulatedValues[i] : pendingValues[i];
+            }
             if (hasAutomationState[i]) {
-                hasAutomationMask |= (1 << i);
+                hasAutomationMask |= bit;
             }
         }
 
-        // Send single combined message - zero allocation (arrays passed directly)
-        protocol.deviceRemoteControlsBatch(0, valuesDirtyMask, valuesEchoMask, hasAutomationMask, pendingValues, batchModulatedValues, batchDisplayValues);
+        // Send single combined message - zero allocation (pre-sized arrays passed directly)
+        protocol.deviceRemoteControlsBatch(batchSequence, valuesDirtyMask, valuesEchoMask, hasAutomationMask, modulatedMask, values, modulated, displayValues);
+
+        // uint8 on the wire: the controller compares sequence numbers modulo 256
+        batchSequence = (batchSequence + 1) & 0xFF;
 
         // Reset masks
         valuesDirtyMask = 0;
         valuesEchoMask = 0;
+        modulationDirtyMask = 0;
 
         // Check isModulated state for all parameters
         for (int i = 0; i < BitwigConfig.MAX_PARAMETERS; i++) {
@@ -208,7 +288,7 @@ public class DeviceHost {
         // Updates device list with new activeDeviceIndex for DeviceSelector sync
         cursorDevice.position().addValueObserver(position -> {
             if (cursorDevice.exists().get()) {
-                sendDeviceListWindow(0);
+                sendDeviceChain();
             }
         });
 
@@ -218,7 +298,7 @@ public class DeviceHost {
             if (exists) {
                 lastDeviceName = cursorDevice.name().get();
                 sendDeviceChange();
-                sendDeviceListWindow(0);
+                sendDeviceChain();
             } else {
                 // Device no longer exists (switched to empty track or last device deleted)
                 lastDeviceName = "";
@@ -268,7 +348,7 @@ public class DeviceHost {
                 pendingValues[paramIndex] = value;   // Store for batch
                 pendingDisplayValues[paramIndex] = displayValue; // Store display value for batch
                 valuesDirtyMask |= (1 << paramIndex); // Mark value as changed
-                batchDirty = true;  // Mark batch for sending
+                markBatchDirty();  // Arm batch for sending
 
                 // Check if this is an echo from controller
                 if (deviceController != null && deviceController.consumeEcho(paramIndex)) {
@@ -285,7 +365,7 @@ public class DeviceHost {
             param.hasAutomation().addValueObserver(hasAutomation -> {
                 if (deviceChangePending) return;  // Skip - DevicePageChangeMessage will contain automation state
                 hasAutomationState[paramIndex] = hasAutomation; // Track for batch mask
-                batchDirty = true;  // Ensure batch is sent with updated mask
+                markBatchDirty();  // Ensure batch is sent with updated mask
                 // Check isModulated immediately (automation changes are rare)
                 checkAndSendIsModulatedChange(paramIndex);
             });
@@ -294,7 +374,8 @@ public class DeviceHost {
                 if (deviceChangePending) return;  // Skip - DevicePageChangeMessage will contain modulated values
                 modulatedValues[paramIndex] = (float) modulatedValue;
                 if (modulationVisible[paramIndex]) {
-                    batchDirty = true;  // Only repaint modulation while it is explicitly revealed
+                    modulationDirtyMask |= (1 << paramIndex);
+                    markBatchDirty();  // Only repaint modulation while it is explicitly revealed
                 }
             });
 
@@ -314,7 +395,7 @@ public class DeviceHost {
 
         // Observer for device count changes (add/remove device)
         deviceBank.itemCount().addValueObserver(count -> {
-            sendDeviceListWindow(0);  // Use windowed loading
+            sendDeviceChain();  // Use windowed loading (skipped if the controller has this chain cached)
         });
 
         // All devices in bank
@@ -352,8 +433,10 @@ public class DeviceHost {
     public void sendInitialState() {
         // Delay to let Bitwig API initialize values
         host.scheduleTask(() -> {
+            sentChains.clear();  // Controller cleared its cache (and link estimate) on HOST_INITIALIZED
+            deviceWindowSize = BitwigConfig.LIST_WINDOW_SIZE;
             sendDeviceChange();
-            sendDeviceListWindow(0);
+            sendDeviceListWindow(0, deviceWindowSize);
         }, BitwigConfig.DEVICE_CHANGE_HEADER_MS);
     }
 
@@ -374,7 +457,8 @@ public class DeviceHost {
         if (visible) {
             modulatedValues[paramIndex] = (float) remoteControls.getParameter(paramIndex).modulatedValue().get();
         }
-        batchDirty = true;
+        modulationDirtyMask |= (1 << paramIndex);
+        markBatchDirty();
     }
 
     /**
@@ -387,6 +471,38 @@ public class DeviceHost {
     public void setControllerViewState(int viewType, boolean selectorActive) {
         this.controllerViewType = viewType;
         this.controllerSelectorActive = selectorActive;
+
+        // Changes held back while away from RemoteControls go out now
+        if (batchDirty && viewType == 0 && !selectorActive) {
+            scheduleBatch();
+        }
+    }
+
+    /**
+     * The controller missed batches: the sparse slots they carried stay stale
+     * until they change again, so the next batch carries every slot.
+     */
+    public void resendAllParameters() {
+        valuesDirtyMask = ALL_PARAMETERS_MASK;
+        modulationDirtyMask = ALL_PARAMETERS_MASK;
+        markBatchDirty();
+    }
+
+    /**
+     * Adapt the batch interval to the controller's render budget (RENDER_STATS).
+     * One batch per displayed frame; the interval doubles when the controller
+     * reports little headroom, so batches stop competing with its redraws.
+     *
+     * @param renderHz        Display refreshes per second on the controller
+     * @param headroomPercent Idle share of the controller main loop
+     */
+    public void setControllerRenderStats(int renderHz, int headroomPercent) {
+        int interval = renderHz > 0 ? 1000 / renderHz : BitwigConfig.BATCH_MAX_INTERVAL_MS;
+        if (headroomPercent < BitwigConfig.BATCH_HEADROOM_LOW_PERCENT) {
+            interval *= 2;
+        }
+        batchIntervalMs = Math.max(BitwigConfig.BATCH_MIN_INTERVAL_MS,
+                Math.min(BitwigConfig.BATCH_MAX_INTERVAL_MS, interval));
     }
 
     /**
@@ -397,16 +513,15 @@ public class DeviceHost {
         host.scheduleTask(action, BitwigConfig.DEVICE_ENTER_CHILD_MS);
     }
 
-    private static final int PAGE_WINDOW_SIZE = 16;
-
     /**
      * Send windowed page names starting at requestedStartIndex.
-     * Implements lazy-loading pattern: sends 16 items per request.
-     * Clamps startIndex if out of range.
+     * Implements lazy-loading pattern: sends requestedWindowSize items, in
+     * messages of up to LIST_WINDOW_SIZE. Clamps startIndex if out of range.
      *
      * @param requestedStartIndex Start index requested by controller
+     * @param requestedWindowSize Items requested by controller (sized to its link)
      */
-    public void sendPageNamesWindow(int requestedStartIndex) {
+    public void sendPageNamesWindow(int requestedStartIndex, int requestedWindowSize) {
         // Pause value/modulation sends to free bandwidth for selector response
         selectorRequestActive = true;
 
@@ -415,46 +530,67 @@ public class DeviceHost {
             final int currentIndex = remoteControls.selectedPageIndex().get();
             final String[] pageNamesArray = remoteControls.pageNames().get();
 
-            // Clamp startIndex if out of range
-            int startIndex = requestedStartIndex;
-            if (startIndex >= totalCount) {
-                startIndex = Math.max(0, totalCount - PAGE_WINDOW_SIZE);
-            }
-            if (startIndex < 0) {
-                startIndex = 0;
-            }
-
-            // Build window of up to 16 items (protocol encodes count prefix)
-            int windowSize = Math.min(PAGE_WINDOW_SIZE, totalCount - startIndex);
-            final String[] windowNames = new String[windowSize];
-            for (int i = 0; i < windowSize; i++) {
-                int idx = startIndex + i;
-                if (pageNamesArray != null && idx < pageNamesArray.length) {
-                    windowNames[i] = pageNamesArray[idx];
-                } else {
-                    windowNames[i] = "";
-                }
-            }
+            final int windowSize = WindowUtils.clampWindowSize(requestedWindowSize);
+            final int startIndex = WindowUtils.clampStartIndex(requestedStartIndex, windowSize, totalCount);
+            final int endIndex = WindowUtils.endIndex(startIndex, windowSize, totalCount);
 
-            protocol.devicePageNamesWindow(
-                totalCount,     // Total pages (absolute)
-                startIndex,     // Actual start index (may be clamped)
-                currentIndex,   // Currently selected page
-                windowNames     // This window's page names (up to 16)
-            );
+            int messageStart = startIndex;
+            do {
+                sendPageNamesMessage(messageStart, endIndex, totalCount, currentIndex, pageNamesArray);
+                messageStart += BitwigConfig.LIST_WINDOW_SIZE;
+            } while (messageStart < endIndex);
 
             // Resume value/modulation sends after response sent
-            selectorRequestActive = false;
+            endSelectorRequest();
         }, BitwigConfig.DEVICE_ENTER_CHILD_MS);
     }
 
+    private void sendPageNamesMessage(int startIndex, int endIndex, int totalCount, int currentIndex,
+                                      String[] pageNamesArray) {
+        // Build message of up to 16 items (protocol encodes count prefix)
+        int windowSize = Math.min(BitwigConfig.LIST_WINDOW_SIZE, endIndex - startIndex);
+        final String[] windowNames = new String[windowSize];
+        for (int i = 0; i < windowSize; i++) {
+            int idx = startIndex + i;
+            if (pageNamesArray != null && idx < pageNamesArray.length) {
+                windowNames[i] = pageNamesArray[idx];
+            } else {
+                windowNames[i] = "";
+            }
+        }
+        final String[] windowRefs = protocol.strings().refAll(windowNames);
+        final int[] namePrefixes = FrontCodingUtils.encode(windowRefs);
+
+        protocol.devicePageNamesWindow(
+            totalCount,     // Total pages (absolute)
+            startIndex,     // Actual start index (may be clamped)
+            currentIndex,   // Currently selected page
+            windowRefs,     // This message's page names (up to 16)
+            namePrefixes    // Front coding of windowRefs (empty if sent whole)
+        );
+    }
+
     /**
-     * Send a windowed portion of the device list (16 items max per window).
-     * Used for lazy-loading large device chains.
+     * Send a windowed portion of the device list (requestedWindowSize items,
+     * in messages of up to 16). Used for lazy-loading large device chains.
      *
      * @param requestedStartIndex The starting index requested by the controller
+     * @param requestedWindowSize Items requested by the controller (sized to its link)
      */
-    public void sendDeviceListWindow(int requestedStartIndex) {
+    public void sendDeviceListWindow(int requestedStartIndex, int requestedWindowSize) {
+        sendDeviceList(requestedStartIndex, requestedWindowSize, false);
+    }
+
+    /**
+     * Announce the current device chain (track switch, chain edited, device
+     * focus moved). The first window is only pushed if the controller does not
+     * hold this version of the chain in its cache.
+     */
+    public void sendDeviceChain() {
+        sendDeviceList(0, deviceWindowSize, true);
+    }
+
+    private void sendDeviceList(int requestedStartIndex, int requestedWindowSize, boolean skipIfCached) {
         // Pause value/modulation sends to free bandwidth for selector response
         selectorRequestActive = true;
 
@@ -464,53 +600,113 @@ public class DeviceHost {
             final boolean isNested = cursorDevice.isNested().get();
             final String parentName = isNested ? cursorDevice.deviceChain().name().get() : "";
 
-            final int startIndex = clampDeviceListStartIndex(requestedStartIndex, totalDeviceCount);
-            final DeviceListWindowMessage.Devices[] windowDevices = buildDevicesListWindow(startIndex, totalDeviceCount);
+            deviceWindowSize = WindowUtils.clampWindowSize(requestedWindowSize);
+            final int startIndex = WindowUtils.clampStartIndex(requestedStartIndex, deviceWindowSize,
+                totalDeviceCount);
+            final int endIndex = WindowUtils.endIndex(startIndex, deviceWindowSize, totalDeviceCount);
+
+            // First window: stamp the chain so the controller can use (and keep) its cached copy
+            if (startIndex == 0) {
+                final long chainIdentity = HashUtils.fnv1a(cursorTrack.name().get(), isNested ? parentName : null);
+                final long chainStamp = computeChainStamp(totalDeviceCount, isNested, parentName);
+                final boolean cached = chainStamp == (long) sentChains.getOrDefault(chainIdentity, 0L);
+                sentChains.put(chainIdentity, chainStamp);
+
+                final boolean windowFollows = !(skipIfCached && cached);
+                protocol.deviceChainStamp(chainIdentity, chainStamp, totalDeviceCount, currentDevicePosition,
+                    isNested, windowFollows);
+                if (!windowFollows) {
+                    endSelectorRequest();
+                    return;
+                }
+            }
 
-            protocol.deviceListWindow(
-                totalDeviceCount,
-                startIndex,
-                currentDevicePosition,
-                isNested,
-                parentName,
-                windowDevices
-            );
+            int messageStart = startIndex;
+            do {
+                sendDeviceListMessage(messageStart, endIndex, totalDeviceCount, currentDevicePosition,
+                    isNested, parentName);
+                messageStart += BitwigConfig.LIST_WINDOW_SIZE;
+            } while (messageStart < endIndex);
 
             // Resume value/modulation sends after response sent
-            selectorRequestActive = false;
+            endSelectorRequest();
         }, BitwigConfig.DEVICE_ENTER_CHILD_MS);
     }
 
-    private int clampDeviceListStartIndex(int requestedStartIndex, int totalDeviceCount) {
-        int startIndex = requestedStartIndex;
-        if (startIndex >= totalDeviceCount) {
-            startIndex = Math.max(0, totalDeviceCount - BitwigConfig.LIST_WINDOW_SIZE);
+    private void sendDeviceListMessage(int startIndex, int endIndex, int totalDeviceCount,
+                                       int currentDevicePosition, boolean isNested, String parentName) {
+        final int windowSize = Math.min(BitwigConfig.LIST_WINDOW_SIZE, endIndex - startIndex);
+        final List<Device> windowItems = collectDevicesListWindow(startIndex, totalDeviceCount, windowSize);
+
+        // Names referenced through the string dictionary, front coded when it pays off
+        final String[] names = new String[windowItems.size()];
+        for (int i = 0; i < names.length; i++) {
+            names[i] = protocol.strings().ref(windowItems.get(i).name().get());
+        }
+        final int[] namePrefixes = FrontCodingUtils.encode(names);
+        final DeviceListWindowMessage.Devices[] windowDevices = buildDevicesListWindow(windowItems, names);
+
+        protocol.deviceListWindow(
+            totalDeviceCount,
+            startIndex,
+            currentDevicePosition,
+            isNested,
+            parentName,
+            windowDevices,
+            namePrefixes
+        );
+    }
+
+    /**
+     * Version of the current chain: everything the controller caches per device
+     * (name, type, enabled state, child types). Bitwig has no change counter for
+     * device chains, so the stamp is a hash of their content.
+     */
+    private long computeChainStamp(int totalDeviceCount, boolean isNested, String parentName) {
+        List<Device> devices = collectDevicesListWindow(0, totalDeviceCount, BitwigConfig.MAX_BANK_SIZE);
+        String[] fields = new String[2 + devices.size() * 2];
+        fields[0] = totalDeviceCount + (isNested ? "/nested" : "");
+        fields[1] = parentName;
+        for (int i = 0; i < devices.size(); i++) {
+            Device device = devices.get(i);
+            int[] childrenTypes = getDeviceChildrenTypes(device);
+            fields[2 + i * 2] = device.name().get();
+            fields[3 + i * 2] = device.deviceType().get() + (device.isEnabled().get() ? "+" : "-")
+                + childrenTypes[0] + childrenTypes[1] + childrenTypes[2];
         }
-        return Math.max(0, startIndex);
+        return HashUtils.fnv1a(fields);
     }
 
-    private DeviceListWindowMessage.Devices[] buildDevicesListWindow(int startIndex, int totalDeviceCount) {
-        List<DeviceListWindowMessage.Devices> list = new ArrayList<>();
+    private List<Device> collectDevicesListWindow(int startIndex, int totalDeviceCount, int windowSize) {
+        List<Device> list = new ArrayList<>();
         int bankSize = Math.min(deviceBank.getSizeOfBank(), totalDeviceCount);
-        int endIndex = Math.min(startIndex + BitwigConfig.LIST_WINDOW_SIZE, bankSize);
+        int endIndex = Math.min(startIndex + windowSize, bankSize);
 
         for (int i = startIndex; i < endIndex; i++) {
             Device device = deviceBank.getItemAt(i);
-            if (!device.exists().get()) continue;
+            if (device.exists().get()) list.add(device);
+        }
+        return list;
+    }
 
+    private DeviceListWindowMessage.Devices[] buildDevicesListWindow(List<Device> devices, String[] names) {
+        DeviceListWindowMessage.Devices[] window = new DeviceListWindowMessage.Devices[devices.size()];
+
+        for (int i = 0; i < window.length; i++) {
+            Device device = devices.get(i);
             String deviceTypeRaw = device.deviceType().get();
             DeviceType deviceType = DeviceType.fromString(deviceTypeRaw);
 
-            list.add(new DeviceListWindowMessage.Devices(
+            window[i] = new DeviceListWindowMessage.Devices(
                 device.position().get(),
-                device.name().get(),
+                names[i],
                 device.isEnabled().get(),
                 deviceType,
                 getDeviceChildrenTypes(device)
-            ));
+            );
         }
 
-        return list.toArray(new DeviceListWindowMessage.Devices[0]);
+        return window;
     }
 
     private int[] getDeviceChildrenTypes(Device device) {
@@ -640,7 +836,7 @@ public class DeviceHost {
             // Guard: if device was deleted during delay, don't send empty state
             // (sendDeviceCleared handles the "No Device" case separately)
             if (!cursorDevice.exists().get()) {
-                deviceChangePending = false;
+                endDeviceChange();
                 return;
             }
 
@@ -653,13 +849,23 @@ public class DeviceHost {
             String pageName = getPageName(pageIndex, pageCount);
             int[] childrenTypes = getDeviceChildrenTypes(cursorDevice);
 
-            sendDeviceChangeHeader(deviceName, isEnabled, deviceType, pageIndex, pageCount, pageName, childrenTypes);
+            // Page name cache keys: the controller reuses the names it already
+            // holds for this device if its page list did not change
+            long deviceIdentity = HashUtils.fnv1a(deviceName, deviceTypeRaw);
+            long pageNamesHash = HashUtils.fnv1a(remoteControls.pageNames().get());
+
+            sendDeviceChangeHeader(deviceName, isEnabled, deviceType, pageIndex, pageCount, pageName, childrenTypes,
+                deviceIdentity, pageNamesHash);
             sendPageChange();
         }, BitwigConfig.DEVICE_CHANGE_HEADER_MS);
     }
 
-    private void sendDeviceChangeHeader(String deviceName, boolean isEnabled, DeviceType deviceType, int pageIndex, int pageCount, String pageName, int[] childrenTypes) {
-        protocol.deviceChangeHeader(deviceName, isEnabled, deviceType, new DeviceChangeHeaderMessage.PageInfo(pageIndex, pageCount, pageName), childrenTypes);
+    private void sendDeviceChangeHeader(String deviceName, boolean isEnabled, DeviceType deviceType, int pageIndex, int pageCount, String pageName, int[] childrenTypes,
+            long deviceIdentity, long pageNamesHash) {
+        StringDictionary strings = protocol.strings();
+        protocol.deviceChangeHeader(strings.ref(deviceName), isEnabled, deviceType,
+            new DeviceChangeHeaderMessage.PageInfo(pageIndex, pageCount, strings.ref(pageName)), childrenTypes,
+            deviceIdentity, pageNamesHash);
     }
 
     private void sendDeviceCleared() {
@@ -674,7 +880,9 @@ public class DeviceHost {
                 false,                 // isEnabled
                 DeviceType.UNKNOWN,    // deviceType (UNKNOWN)
                 new DeviceChangeHeaderMessage.PageInfo(0, 0, ""),  // empty page info
-                new int[]{0, 0, 0, 0}  // no children types
+                new int[]{0, 0, 0, 0}, // no children types
+                0L,                    // deviceIdentity (not cached)
+                0L                     // pageNamesHash
             );
 
             // Clear all parameters (mark as not visible)
@@ -695,7 +903,7 @@ public class DeviceHost {
             }
 
             // Resume observers
-            deviceChangePending = false;
+            endDeviceChange();
         }, BitwigConfig.STANDARD_DELAY_MS);
     }
 
@@ -706,15 +914,16 @@ public class DeviceHost {
         final List<DevicePageChangeMessage.RemoteControls> remoteControlsList = buildRemoteControlsListForPageChange();
 
         protocol.devicePageChange(
-            new DevicePageChangeMessage.PageInfo(pageIndex, pageCount, pageName),
+            new DevicePageChangeMessage.PageInfo(pageIndex, pageCount, protocol.strings().ref(pageName)),
             remoteControlsList.toArray(new DevicePageChangeMessage.RemoteControls[0])
         );
 
-        // Ensure batch is sent with updated hasAutomationMask
-        batchDirty = true;
+        // Ensure batch is sent with updated hasAutomationMask and resyncs every ribbon
+        modulationDirtyMask = ALL_PARAMETERS_MASK;
+        markBatchDirty();
 
         // Resume individual observers
-        deviceChangePending = false;
+        endDeviceChange();
     }
 
     private String getPageName(int pageIndex, int pageCount) {
@@ -729,6 +938,7 @@ public class DeviceHost {
 
     private List<DevicePageChangeMessage.RemoteControls> buildRemoteControlsListForPageChange() {
         List<DevicePageChangeMessage.RemoteControls> remoteControlsList = new ArrayList<>();
+        StringDictionary strings = protocol.strings();
         for (int i = 0; i < BitwigConfig.MAX_PARAMETERS; i++) {
             RemoteControl param = remoteControls.getParameter(i);
             ParameterData data = captureParameterData(param, i);
@@ -743,13 +953,13 @@ public class DeviceHost {
             remoteControlsList.add(new DevicePageChangeMessage.RemoteControls(
                 i,
                 data.value,
-                data.name,
+                strings.ref(data.name),
                 data.origin,
                 data.exists,
                 (short) data.discreteCount,
                 data.displayedValue,
                 ParameterType.fromValue(data.typeInfo.parameterType),
-                data.typeInfo.discreteValueNames,
+                strings.refAll(data.typeInfo.discreteValueNames),
                 data.typeInfo.currentValueIndex,
                 data.hasAutomation,
                     data.modulatedValue,
@@ -6,6 +6,8 @@ import protocol.struct.SendDestinationsListMessage;
 import protocol.struct.TrackListWindowMessage;
 import config.BitwigConfig;
 import util.ColorUtils;
+import util.FrontCodingUtils;
+import util.WindowUtils;
 import protocol.TrackType;
 import java.util.List;
 import java.util.ArrayList;
@@ -43,6 +45,9 @@ public class TrackHost {
     private String lastTrackName = "";
     private long lastTrackColor = 0;
 
+    // windowSize of the controller's last track list request, reused for host-initiated pushes
+    private int trackWindowSize = BitwigConfig.LIST_WINDOW_SIZE;
+
     // Pending toggle tracking for reliable mute/solo confirmation
     // Includes timestamp to auto-expire if observer never fires
     private int pendingMuteTrackIndex = -1;
@@ -111,7 +116,7 @@ public class TrackHost {
             final int trackIndex = i;
             Track track = mainTrackBank.getItemAt(i);
             markTrackInterested(track);
-            addTrackObservers(track, trackIndex);
+            addTrackObservers(mainTrackBank, track, trackIndex);
         }
 
         // Mark parent track observables as interested
@@ -129,7 +134,7 @@ public class TrackHost {
             final int trackIndex = i;
             Track track = siblingTrackBank.getItemAt(i);
             markTrackInterested(track);
-            addTrackObservers(track, trackIndex);
+            addTrackObservers(siblingTrackBank, track, trackIndex);
         }
 
         // Observer on cursor track change (name or color)
@@ -282,6 +287,7 @@ public class TrackHost {
      * Send current track state (called at startup)
      */
     public void sendInitialState() {
+        trackWindowSize = BitwigConfig.LIST_WINDOW_SIZE;  // Controller measures its link afresh
         sendTrackChange();
         sendTrackListWindow(0);  // Use windowed loading
     }
@@ -329,11 +335,13 @@ public class TrackHost {
     }
 
     /**
-     * Add mute/solo observers to track for reliable toggle confirmation
+     * Add mute/solo observers to track for reliable toggle confirmation,
+     * and a muted-by-solo observer keeping the controller's track flags live
+     * @param bank Bank the track belongs to
      * @param track Track to add observers to
      * @param trackIndex Index of track in current bank
      */
-    private void addTrackObservers(Track track, int trackIndex) {
+    private void addTrackObservers(TrackBank bank, Track track, int trackIndex) {
         // Mute observer - sends confirmation when mute state changes
         track.mute().addValueObserver(isMuted -> {
             long elapsed = System.currentTimeMillis() - pendingMuteTimestamp;
@@ -351,6 +359,13 @@ public class TrackHost {
                 protocol.trackSoloState(trackIndex, isSoloed);
             }
         });
+
+        // Muted-by-solo observer - a solo toggle changes it on every other track
+        track.isMutedBySolo().addValueObserver(isMutedBySolo -> {
+            if (track.exists().get() && bank == getCurrentBank()) {
+                protocol.trackMutedBySoloState(trackIndex, isMutedBySolo);
+            }
+        });
     }
 
     /**
@@ -370,12 +385,23 @@ public class TrackHost {
     }
 
     /**
-     * Send a windowed portion of the track list (16 items max per window).
-     * Used for lazy-loading large track lists.
+     * Push the track list (track change, bank edit), sized like the
+     * controller's last request.
      *
-     * @param requestedStartIndex The starting index requested by the controller
+     * @param requestedStartIndex The starting index to send from
      */
     public void sendTrackListWindow(int requestedStartIndex) {
+        sendTrackListWindow(requestedStartIndex, trackWindowSize);
+    }
+
+    /**
+     * Send a windowed portion of the track list (requestedWindowSize items,
+     * in messages of up to 16). Used for lazy-loading large track lists.
+     *
+     * @param requestedStartIndex The starting index requested by the controller
+     * @param requestedWindowSize Items requested by the controller (sized to its link)
+     */
+    public void sendTrackListWindow(int requestedStartIndex, int requestedWindowSize) {
         host.scheduleTask(() -> {
             final TrackBank bank = getCurrentBank();
             final int totalTrackCount = bank.itemCount().get();
@@ -383,54 +409,76 @@ public class TrackHost {
             final boolean hasParent = hasParentGroup();
             final String parentName = hasParent ? parentTrack.name().get() : "";
 
-            // Clamp startIndex if out of range
-            int startIndex = requestedStartIndex;
-            if (startIndex >= totalTrackCount) {
-                startIndex = Math.max(0, totalTrackCount - BitwigConfig.LIST_WINDOW_SIZE);
-            }
-            if (startIndex < 0) {
-                startIndex = 0;
-            }
+            trackWindowSize = WindowUtils.clampWindowSize(requestedWindowSize);
+            final int startIndex = WindowUtils.clampStartIndex(requestedStartIndex, trackWindowSize, totalTrackCount);
+            final int endIndex = WindowUtils.endIndex(startIndex, trackWindowSize, totalTrackCount);
 
-            // Build windowed track list
-            final TrackListWindowMessage.Tracks[] windowTracks = buildTrackListWindow(bank, startIndex);
-
-            protocol.trackListWindow(
-                totalTrackCount,
-                startIndex,
-                cursorPosition,
-                hasParent,
-                parentName,
-                windowTracks
-            );
+            int messageStart = startIndex;
+            do {
+                sendTrackListMessage(bank, messageStart, endIndex, totalTrackCount, cursorPosition, hasParent,
+                    parentName);
+                messageStart += BitwigConfig.LIST_WINDOW_SIZE;
+            } while (messageStart < endIndex);
         }, BitwigConfig.TRACK_SELECT_DELAY_MS);
     }
 
-    private TrackListWindowMessage.Tracks[] buildTrackListWindow(TrackBank bank, int startIndex) {
-        final List<TrackListWindowMessage.Tracks> tracks = new ArrayList<>();
-        int endIndex = Math.min(startIndex + BitwigConfig.LIST_WINDOW_SIZE, bank.getSizeOfBank());
+    private void sendTrackListMessage(TrackBank bank, int startIndex, int endIndex, int totalTrackCount,
+                                      int cursorPosition, boolean hasParent, String parentName) {
+        // Build windowed track list, names referenced through the string
+        // dictionary and front coded when it pays off
+        final int windowSize = Math.min(BitwigConfig.LIST_WINDOW_SIZE, endIndex - startIndex);
+        final List<Track> windowItems = collectTrackListWindow(bank, startIndex, windowSize);
+        final String[] names = new String[windowItems.size()];
+        for (int i = 0; i < names.length; i++) {
+            names[i] = protocol.strings().ref(windowItems.get(i).name().get());
+        }
+        final int[] namePrefixes = FrontCodingUtils.encode(names);
+        final TrackListWindowMessage.Tracks[] windowTracks = buildTrackListWindow(windowItems, names);
+
+        protocol.trackListWindow(
+            totalTrackCount,
+            startIndex,
+            cursorPosition,
+            hasParent,
+            parentName,
+            windowTracks,
+            namePrefixes
+        );
+    }
+
+    private List<Track> collectTrackListWindow(TrackBank bank, int startIndex, int windowSize) {
+        final List<Track> tracks = new ArrayList<>();
+        int endIndex = Math.min(startIndex + windowSize, bank.getSizeOfBank());
 
         for (int i = startIndex; i < endIndex; i++) {
             Track track = bank.getItemAt(i);
-            if (track.exists().get()) {
-                tracks.add(new TrackListWindowMessage.Tracks(
-                    track.position().get(),
-                    track.name().get(),
-                    ColorUtils.toUint32Hex(track.color().get()),
-                    track.isActivated().get(),
-                    track.mute().get(),
-                    track.solo().get(),
-                    track.isMutedBySolo().get(),
-                    track.arm().get(),
-                    track.isGroup().get(),
-                    TrackType.fromString(track.trackType().get()),
-                    (float) track.volume().value().get(),
-                    (float) track.pan().value().get()
-                ));
-            }
+            if (track.exists().get()) tracks.add(track);
+        }
+        return tracks;
+    }
+
+    private TrackListWindowMessage.Tracks[] buildTrackListWindow(List<Track> tracks, String[] names) {
+        final TrackListWindowMessage.Tracks[] window = new TrackListWindowMessage.Tracks[tracks.size()];
+
+        for (int i = 0; i < window.length; i++) {
+            Track track = tracks.get(i);
+            window[i] = new TrackListWindowMessage.Tracks(
+                track.position().get(),
+                names[i],
+                ColorUtils.toUint32Hex(track.color().get()),
+                track.isActivated().get(),
+                track.mute().get(),
+                track.solo().get(),
+                track.isMutedBySolo().get(),
+                track.arm().get(),
+                track.isGroup().get(),
+                TrackType.fromString(track.trackType().get()),
+                (float) track.volume().value().get(),
+                (float) track.pan().value().get()
+            );
         }
 
-        return tracks.toArray(new TrackListWindowMessage.Tracks[0]);
+        return window;
     }
 
     /**
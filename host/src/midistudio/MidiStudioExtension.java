@@ -84,6 +84,7 @@ public class MidiStudioExtension extends ControllerExtension {
       TrackBank effectTrackBank = host.createEffectTrackBank(8, 0); // For send destination names
 
       protocol = new Protocol(host, "127.0.0.1", bridgePort);
+      protocol.strings().setEnabled(BitwigConfig.USE_STRING_DICTIONARY);
 
       new TransportController(transport, protocol);
       DeviceController deviceController = new DeviceController(host, cursorDevice, remoteControls, protocol, deviceBank,
@@ -149,5 +150,9 @@ public class MidiStudioExtension extends ControllerExtension {
 
    @Override
    public void flush() {
+      // Send messages queued by observers/tasks since the last flush as one frame
+      if (protocol != null) {
+         protocol.flush();
+      }
    }
 }
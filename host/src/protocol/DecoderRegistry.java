@@ -7,7 +7,7 @@ import protocol.struct.*;
 /**
  * DecoderRegistry - MessageID to Decoder mapping
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  *
  * Dispatches incoming messages to typed callbacks.
  * Called by Protocol.dispatch().
@@ -37,6 +37,11 @@ public class DecoderRegistry {
                     callbacks.onDeviceChangeHeader.handle(DeviceChangeHeaderMessage.decode(payload));
                 }
                 break;
+            case DEVICE_CHAIN_STAMP:
+                if (callbacks.onDeviceChainStamp != null) {
+                    callbacks.onDeviceChainStamp.handle(DeviceChainStampMessage.decode(payload));
+                }
+                break;
             case DEVICE_CHILDREN:
                 if (callbacks.onDeviceChildren != null) {
                     callbacks.onDeviceChildren.handle(DeviceChildrenMessage.decode(payload));
@@ -182,6 +187,11 @@ public class DecoderRegistry {
                     callbacks.onLastClickedValueState.handle(LastClickedValueStateMessage.decode(payload));
                 }
                 break;
+            case FLOW_CREDIT:
+                if (callbacks.onFlowCredit != null) {
+                    callbacks.onFlowCredit.handle(FlowCreditMessage.decode(payload));
+                }
+                break;
             case HOST_DEACTIVATED:
                 if (callbacks.onHostDeactivated != null) {
                     callbacks.onHostDeactivated.handle(HostDeactivatedMessage.decode(payload));
@@ -192,11 +202,26 @@ public class DecoderRegistry {
                     callbacks.onHostInitialized.handle(HostInitializedMessage.decode(payload));
                 }
                 break;
+            case RENDER_STATS:
+                if (callbacks.onRenderStats != null) {
+                    callbacks.onRenderStats.handle(RenderStatsMessage.decode(payload));
+                }
+                break;
             case REQUEST_HOST_STATUS:
                 if (callbacks.onRequestHostStatus != null) {
                     callbacks.onRequestHostStatus.handle(RequestHostStatusMessage.decode(payload));
                 }
                 break;
+            case STRING_DEFINE:
+                if (callbacks.onStringDefine != null) {
+                    callbacks.onStringDefine.handle(StringDefineMessage.decode(payload));
+                }
+                break;
+            case STRING_MISS:
+                if (callbacks.onStringMiss != null) {
+                    callbacks.onStringMiss.handle(StringMissMessage.decode(payload));
+                }
+                break;
             case ENTER_TRACK_GROUP:
                 if (callbacks.onEnterTrackGroup != null) {
                     callbacks.onEnterTrackGroup.handle(EnterTrackGroupMessage.decode(payload));
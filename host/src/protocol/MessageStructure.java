@@ -2,6 +2,7 @@ package protocol;
 
 import protocol.struct.DeviceChangeMessage;
 import protocol.struct.DeviceChangeHeaderMessage;
+import protocol.struct.DeviceChainStampMessage;
 import protocol.struct.DeviceChildrenMessage;
 import protocol.struct.DeviceEnabledStateMessage;
 import protocol.struct.DeviceListWindowMessage;
@@ -31,9 +32,13 @@ import protocol.struct.LastClickedTouchMessage;
 import protocol.struct.LastClickedUpdateMessage;
 import protocol.struct.LastClickedValueMessage;
 import protocol.struct.LastClickedValueStateMessage;
+import protocol.struct.FlowCreditMessage;
 import protocol.struct.HostDeactivatedMessage;
 import protocol.struct.HostInitializedMessage;
+import protocol.struct.RenderStatsMessage;
 import protocol.struct.RequestHostStatusMessage;
+import protocol.struct.StringDefineMessage;
+import protocol.struct.StringMissMessage;
 import protocol.struct.EnterTrackGroupMessage;
 import protocol.struct.ExitTrackGroupMessage;
 import protocol.struct.RequestSendDestinationsMessage;
@@ -96,7 +101,7 @@ import protocol.struct.TransportTempoStateMessage;
 /**
  * MessageStructure - Umbrella class for all protocol messages
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  *
  * This class imports all message struct definitions from the struct package.
  * Use this single import in your code instead of importing individual structs.
@@ -121,6 +126,8 @@ public final class MessageStructure {
     public static final Class<DeviceChangeMessage> DEVICE_CHANGE = DeviceChangeMessage.class;
     /** @see DeviceChangeHeaderMessage */
     public static final Class<DeviceChangeHeaderMessage> DEVICE_CHANGE_HEADER = DeviceChangeHeaderMessage.class;
+    /** @see DeviceChainStampMessage */
+    public static final Class<DeviceChainStampMessage> DEVICE_CHAIN_STAMP = DeviceChainStampMessage.class;
     /** @see DeviceChildrenMessage */
     public static final Class<DeviceChildrenMessage> DEVICE_CHILDREN = DeviceChildrenMessage.class;
     /** @see DeviceEnabledStateMessage */
@@ -179,12 +186,20 @@ public final class MessageStructure {
     public static final Class<LastClickedValueMessage> LAST_CLICKED_VALUE = LastClickedValueMessage.class;
     /** @see LastClickedValueStateMessage */
     public static final Class<LastClickedValueStateMessage> LAST_CLICKED_VALUE_STATE = LastClickedValueStateMessage.class;
+    /** @see FlowCreditMessage */
+    public static final Class<FlowCreditMessage> FLOW_CREDIT = FlowCreditMessage.class;
     /** @see HostDeactivatedMessage */
     public static final Class<HostDeactivatedMessage> HOST_DEACTIVATED = HostDeactivatedMessage.class;
     /** @see HostInitializedMessage */
     public static final Class<HostInitializedMessage> HOST_INITIALIZED = HostInitializedMessage.class;
+    /** @see RenderStatsMessage */
+    public static final Class<RenderStatsMessage> RENDER_STATS = RenderStatsMessage.class;
     /** @see RequestHostStatusMessage */
     public static final Class<RequestHostStatusMessage> REQUEST_HOST_STATUS = RequestHostStatusMessage.class;
+    /** @see StringDefineMessage */
+    public static final Class<StringDefineMessage> STRING_DEFINE = StringDefineMessage.class;
+    /** @see StringMissMessage */
+    public static final Class<StringMissMessage> STRING_MISS = StringMissMessage.class;
     /** @see EnterTrackGroupMessage */
     public static final Class<EnterTrackGroupMessage> ENTER_TRACK_GROUP = EnterTrackGroupMessage.class;
     /** @see ExitTrackGroupMessage */
@@ -2,11 +2,19 @@ package protocol;
 
 import com.bitwig.extension.controller.api.ControllerHost;
 import protocol.MessageID;
+import protocol.MessageNames;
 import protocol.ProtocolConstants;
 import protocol.DecoderRegistry;
+import protocol.struct.FlowCreditMessage;
+import protocol.struct.StringDefineMessage;
+import protocol.struct.StringMissMessage;
 
 import java.lang.reflect.Field;
 import java.lang.reflect.Method;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayDeque;
+import java.util.EnumSet;
+import java.util.Iterator;
 import java.util.concurrent.ConcurrentHashMap;
 import java.util.concurrent.atomic.AtomicBoolean;
 
@@ -29,6 +37,29 @@ import java.util.concurrent.atomic.AtomicBoolean;
  * // Send notifications to controller using explicit API
  * protocol.transportPlayingState(true);
  * protocol.deviceChange(name, enabled, ...);
+ *
+ * Threading: frames arrive on the transport's receive thread and are handed
+ * to Bitwig's control thread (host.scheduleTask) before dispatch, so every
+ * callback, and every send it triggers, runs on the control thread like the
+ * observers do. The envelope and flow control state are confined to it.
+ *
+ * In compact mode, small messages are queued into one envelope frame
+ * ([ENVELOPE_MESSAGE_ID | flag]{[len][compact frame]}*) and sent by flush(),
+ * which the extension calls from ControllerExtension.flush(). Queuing the
+ * first record requests that flush (host.requestFlush()), so replies do not
+ * wait for unrelated project activity.
+ *
+ * Flow control: the controller periodically sends FLOW_CREDIT (bytes it has
+ * dispatched + window it accepts in flight). Bulk messages (list windows,
+ * children, discrete values) are held back while the window is used up, so
+ * interactive traffic (batches, echoes, state) never queues behind them.
+ * Until the first credit arrives, nothing is held back.
+ *
+ * String dictionary: senders pass repeated names through strings().ref(),
+ * which defines each name once (STRING_DEFINE) and returns a short reference
+ * (see StringDictionary). send() ties the references made since the previous
+ * message to the one being sent: queued bulk messages pin their slots, and a
+ * STRING_MISS defines the string again and resends that message.
  */
 public class Protocol extends ProtocolCallbacks {
 
@@ -48,13 +79,55 @@ public class Protocol extends ProtocolCallbacks {
 
     // Reflection cache for performance
     // encode(byte[], int) returns bytes written - streaming, zero-allocation
-    private record MessageMeta(MessageID messageId, Method encodeMethod) {}
+    // nameBytes: MESSAGE_NAME prefix for named frames
+    private record MessageMeta(MessageID messageId, Method encodeMethod, byte[] nameBytes) {}
+    // Message with the string IDs it references
+    private record Outgoing(Object message, int[] refs) {}
     private final ConcurrentHashMap<Class<?>, MessageMeta> messageCache = new ConcurrentHashMap<>();
 
     // Pre-allocated send buffer (Bitwig is single-threaded, no need for ThreadLocal)
     private static final int MAX_SEND_BUFFER_SIZE = 4096;
     private final byte[] sendBuffer = new byte[MAX_SEND_BUFFER_SIZE];
 
+    // Compact framing: drop MESSAGE_NAME prefix (negotiated at HOST_INITIALIZED)
+    private volatile boolean compactFrames = false;
+
+    // Envelope being filled between flushes: [type byte]{[len][compact frame]}*
+    // (control thread only)
+    private final byte[] envelopeBuffer = new byte[ProtocolConstants.MAX_ENVELOPE_SIZE];
+    private int envelopeLength = 1;
+    private int envelopeRecords = 0;
+
+    // Flow control: bulk messages wait for controller credit (see FLOW_CREDIT)
+    private static final EnumSet<MessageID> BULK_MESSAGES = EnumSet.of(
+        MessageID.DEVICE_CHILDREN,
+        MessageID.DEVICE_LIST_WINDOW,
+        MessageID.DEVICE_PAGE_NAMES_WINDOW,
+        MessageID.DEVICE_REMOTE_CONTROL_DISCRETE_VALUES,
+        MessageID.SEND_DESTINATIONS_LIST,
+        MessageID.TRACK_LIST_WINDOW,
+        MessageID.TRACK_SEND_LIST);
+    private static final int BYTE_COUNTER_MASK = 0xFFFF;  // Counters are uint16 on the wire
+    private static final int MAX_PLAUSIBLE_IN_FLIGHT = 0x8000;  // Beyond this, counters are out of sync
+    private static final int LOSS_CREDITS = 2;  // Credits without ack progress before bytes are written off
+    private static final int MAX_QUEUED_BULK = 64;  // Controller gone silent: superseded messages are dropped
+
+    private final ArrayDeque<Outgoing> bulkQueue = new ArrayDeque<>();
+    private int bytesSent = 0;          // Frame bytes handed to the transport (mod 65536)
+    private int creditsSeen = 0;        // Last creditCount consumed by pumpBulk()
+    private int stalledCredits = 0;
+    private int lastAckedBytes = 0;
+    // Last FLOW_CREDIT (onCredit), consumed by pumpBulk(); control thread only like the queue
+    private int ackedBytes = 0;
+    private int windowBytes = 0;  // 0 = controller has not advertised credit yet
+    private int creditCount = 0;
+    private int batchLosses = -1;  // Last FLOW_CREDIT batchLosses, -1 until the first credit
+
+    /** Controller lost remote control batches (FLOW_CREDIT batchLosses changed): resend every slot */
+    public Runnable onBatchLoss = null;
+
+    private final StringDictionary strings = new StringDictionary(this);
+
     // ========================================================================
     // Lifecycle
     // ========================================================================
@@ -100,6 +173,8 @@ public class Protocol extends ProtocolCallbacks {
         this.host = host;
 
         this.transport = createTransport(bridgeHost, bridgePort);
+        this.onFlowCredit = this::onCredit;
+        this.onStringMiss = this::onStringMissed;
     }
 
     /**
@@ -111,6 +186,11 @@ public class Protocol extends ProtocolCallbacks {
         ProtocolTransport replacement = createTransport(bridgeHost, bridgePort);
         ProtocolTransport previous = transport;
         transport = replacement;
+        // New endpoint: back to named frames until the controller asks again
+        compactFrames = false;
+        clearEnvelope();
+        resetFlowControl();
+        strings.reset();
         if (previous != null) {
             previous.close();
         }
@@ -118,7 +198,7 @@ public class Protocol extends ProtocolCallbacks {
 
     private ProtocolTransport createTransport(String bridgeHost, int bridgePort) {
         ProtocolTransport.Type transportType = getTransportTypeFromEnv();
-        ProtocolTransport.ReceiveCallback callback = this::dispatch;
+        ProtocolTransport.ReceiveCallback callback = this::receive;
 
         if (transportType == ProtocolTransport.Type.TCP) {
             return new TcpTransport(host, bridgeHost, bridgePort, callback);
@@ -140,6 +220,54 @@ public class Protocol extends ProtocolCallbacks {
         // return ProtocolTransport.Type.UDP;  // Default
     }
 
+    // ========================================================================
+    // Framing
+    // ========================================================================
+
+    /**
+     * Drop the MESSAGE_NAME prefix from outgoing frames.
+     *
+     * Frames start named so the bridge can log them. The controller advertises
+     * compact framing in REQUEST_HOST_STATUS; HostStatusController confirms it
+     * in HOST_INITIALIZED (sent in the current framing) and then enables it here. Incoming frames
+     * are accepted in either form regardless of this setting.
+     */
+    public void setCompactFrames(boolean compact) {
+        if (!compact) {
+            flush();  // Queued records are compact frames
+        }
+        compactFrames = compact;
+    }
+
+    public boolean isCompactFrames() {
+        return compactFrames;
+    }
+
+    // ========================================================================
+    // String Dictionary
+    // ========================================================================
+
+    /**
+     * Names shared with the controller: pass repeated names through ref()
+     */
+    public StringDictionary strings() {
+        return strings;
+    }
+
+    /**
+     * STRING_MISS: define the string again, then resend the last message that
+     * referenced it so the controller shows the name instead of a blank
+     */
+    private void onStringMissed(StringMissMessage miss) {
+        if (!isActive.get()) return;
+        StringDictionary.Definition definition = strings.onMiss(miss.getStringId());
+        if (definition == null) return;
+        stringDefine(definition.id, definition.text);
+        if (definition.carrier instanceof Outgoing carrier && !bulkQueue.contains(carrier)) {
+            send(carrier);
+        }
+    }
+
     // ========================================================================
     // Internal Send (used by generated explicit API methods)
     // ========================================================================
@@ -152,7 +280,24 @@ public class Protocol extends ProtocolCallbacks {
     @Override
     protected void send(Object message) {
         if (!isActive.get()) return;
-        sendInternal(message);
+        if (message instanceof StringDefineMessage) {
+            sendInternal(message);  // Sent from ref(), while the carrier is being built
+            return;
+        }
+        send(new Outgoing(message, strings.takeReferences()));
+    }
+
+    private void send(Outgoing outgoing) {
+        strings.carriedBy(outgoing.refs(), outgoing);
+        if (shouldDefer(outgoing.message())) {
+            if (bulkQueue.size() >= MAX_QUEUED_BULK) {
+                dropSuperseded(metaOf(outgoing.message()).messageId());
+            }
+            strings.pin(outgoing.refs());
+            bulkQueue.add(outgoing);
+            return;
+        }
+        sendInternal(outgoing.message());
     }
 
     /**
@@ -163,46 +308,241 @@ public class Protocol extends ProtocolCallbacks {
         if (current == null || !current.isConnected()) return;
         try {
             sendInternal(message);
+            flush();
         } catch (Exception e) {
             // Ignore - transport may already be closed
         }
     }
 
+    /**
+     * Send bulk messages the controller has credit for, then the queued
+     * messages as one envelope frame.
+     * A single queued message goes out as a plain compact frame.
+     */
+    public void flush() {
+        pumpBulk();
+        flushEnvelope();
+    }
+
+    private void flushEnvelope() {
+        if (envelopeRecords == 0) return;
+
+        ProtocolTransport current = transport;
+        if (current != null && current.isConnected()) {
+            if (envelopeRecords == 1) {
+                transmit(current, envelopeBuffer, 2, envelopeBuffer[1] & 0xFF);
+            } else {
+                envelopeBuffer[0] = (byte) (ProtocolConstants.ENVELOPE_MESSAGE_ID | ProtocolConstants.COMPACT_FRAME_FLAG);
+                transmit(current, envelopeBuffer, 0, envelopeLength);
+            }
+        }
+        clearEnvelope();
+    }
+
+    private void clearEnvelope() {
+        envelopeLength = 1;
+        envelopeRecords = 0;
+    }
+
     private <T> void sendInternal(T message) {
+        MessageMeta meta = metaOf(message);
+
+        int frameLength;
+        try {
+            int offset = 0;
+            if (compactFrames) {
+                // Frame header: [MessageID | COMPACT_FRAME_FLAG]
+                sendBuffer[offset++] = (byte) (meta.messageId().getValue() | ProtocolConstants.COMPACT_FRAME_FLAG);
+            } else {
+                // Frame header: [MessageID][nameLen][name...]
+                byte[] nameBytes = meta.nameBytes();
+                sendBuffer[offset++] = meta.messageId().getValue();
+                sendBuffer[offset++] = (byte) nameBytes.length;
+                System.arraycopy(nameBytes, 0, sendBuffer, offset, nameBytes.length);
+                offset += nameBytes.length;
+            }
+            // Encode payload after the header (zero-allocation)
+            int payloadLength = (int) meta.encodeMethod().invoke(message, sendBuffer, offset);
+            frameLength = offset + payloadLength;
+        } catch (Exception e) {
+            throw new RuntimeException("Failed to encode message: " + e.getMessage(), e);
+        }
+
+        // Queue small compact frames into the envelope (sent by flush())
+        if (compactFrames && frameLength <= ProtocolConstants.MAX_ENVELOPE_RECORD_SIZE) {
+            if (envelopeLength + 1 + frameLength > envelopeBuffer.length) {
+                flushEnvelope();
+            }
+            if (envelopeRecords == 0) {
+                host.requestFlush();
+            }
+            envelopeBuffer[envelopeLength++] = (byte) frameLength;
+            System.arraycopy(sendBuffer, 0, envelopeBuffer, envelopeLength, frameLength);
+            envelopeLength += frameLength;
+            envelopeRecords++;
+            return;
+        }
+
+        // Sent on its own: anything queued must go first
+        flushEnvelope();
+
+        ProtocolTransport current = transport;
+        if (current == null || !current.isConnected()) return;
+
+        // Send via transport (pass buffer slice without allocation)
+        transmit(current, sendBuffer, 0, frameLength);
+    }
+
+    private MessageMeta metaOf(Object message) {
         if (message == null) {
             throw new IllegalArgumentException("Message cannot be null");
         }
 
         // Use cached reflection for performance
-        Class<?> clazz = message.getClass();
-        MessageMeta meta = messageCache.computeIfAbsent(clazz, c -> {
+        return messageCache.computeIfAbsent(message.getClass(), c -> {
             try {
                 Field messageIdField = c.getField("MESSAGE_ID");
                 MessageID id = (MessageID) messageIdField.get(null);
                 // encode(byte[], int) - streaming, zero-allocation
                 Method encode = c.getMethod("encode", byte[].class, int.class);
-                return new MessageMeta(id, encode);
+                String name = MessageNames.of(id);
+                byte[] nameBytes = name != null
+                    ? name.getBytes(StandardCharsets.US_ASCII)
+                    : new byte[0];
+                return new MessageMeta(id, encode, nameBytes);
             } catch (Exception e) {
                 throw new RuntimeException("Failed to cache message type: " + c.getName(), e);
             }
         });
+    }
 
-        int frameLength;
-        try {
-            // Frame header: [MessageID]
-            sendBuffer[0] = meta.messageId().getValue();
-            // Encode payload starting at offset 1 (zero-allocation)
-            int payloadLength = (int) meta.encodeMethod().invoke(message, sendBuffer, 1);
-            frameLength = 1 + payloadLength;
-        } catch (Exception e) {
-            throw new RuntimeException("Failed to encode message: " + e.getMessage(), e);
+    /**
+     * Single exit point to the transport: counts bytes for flow control
+     */
+    private void transmit(ProtocolTransport current, byte[] buffer, int offset, int length) {
+        current.send(buffer, offset, length);
+        bytesSent = (bytesSent + length) & BYTE_COUNTER_MASK;
+    }
+
+    // ========================================================================
+    // Flow Control
+    // ========================================================================
+
+    /**
+     * FLOW_CREDIT from the controller: recorded here, consumed by pumpBulk()
+     * on the flush it requests when bulk messages are waiting
+     */
+    private void onCredit(FlowCreditMessage credit) {
+        ackedBytes = credit.getReceivedBytes();
+        windowBytes = credit.getWindowBytes();
+        creditCount++;
+        if (batchLosses >= 0 && credit.getBatchLosses() != batchLosses && onBatchLoss != null) {
+            onBatchLoss.run();
+        }
+        batchLosses = credit.getBatchLosses();
+        if (!bulkQueue.isEmpty()) {
+            host.requestFlush();
         }
+    }
 
-        ProtocolTransport current = transport;
-        if (current == null || !current.isConnected()) return;
+    private int bytesInFlight() {
+        int pending = envelopeRecords > 0 ? envelopeLength : 0;  // Queued, counted once transmitted
+        return ((bytesSent - ackedBytes) & BYTE_COUNTER_MASK) + pending;
+    }
 
-        // Send via transport (pass buffer slice without allocation)
-        current.send(sendBuffer, 0, frameLength);
+    /**
+     * Bulk messages go through the queue once the controller advertises credit,
+     * and only while its window has room (order among bulk messages is kept)
+     */
+    private boolean shouldDefer(Object message) {
+        if (windowBytes == 0) return false;
+        if (!BULK_MESSAGES.contains(metaOf(message).messageId())) return false;
+        return !bulkQueue.isEmpty() || bytesInFlight() >= windowBytes;
+    }
+
+    /**
+     * Consume new credits, then send queued bulk messages while the window
+     * has room. One message may overshoot the window (it is never split).
+     */
+    private void pumpBulk() {
+        int credits = creditCount;
+        if (credits != creditsSeen) {
+            if (creditsSeen == 0) {
+                // First credit: align our counter with the controller's
+                bytesSent = ackedBytes;
+            }
+            creditsSeen = credits;
+            trackAckProgress();
+        }
+
+        while (!bulkQueue.isEmpty() && (windowBytes == 0 || bytesInFlight() < windowBytes)) {
+            Outgoing next = bulkQueue.poll();
+            strings.unpin(next.refs());
+            sendInternal(next.message());
+        }
+    }
+
+    /**
+     * Queue full: drop the oldest message a newer one supersedes. A queued
+     * message with the incoming ID goes first (e.g. an older window of the
+     * same list); otherwise the oldest message whose ID is queued again
+     * later. With fewer bulk IDs than slots, one of the two always exists.
+     */
+    private void dropSuperseded(MessageID incoming) {
+        Outgoing dropped = null;
+        for (Outgoing queued : bulkQueue) {
+            if (metaOf(queued.message()).messageId() == incoming) {
+                dropped = queued;
+                break;
+            }
+        }
+        if (dropped == null) {
+            EnumSet<MessageID> newer = EnumSet.noneOf(MessageID.class);
+            Iterator<Outgoing> it = bulkQueue.descendingIterator();
+            while (it.hasNext()) {
+                Outgoing queued = it.next();
+                if (!newer.add(metaOf(queued.message()).messageId())) {
+                    dropped = queued;  // A newer message of its ID is queued
+                }
+            }
+        }
+        if (dropped != null) {
+            bulkQueue.removeFirstOccurrence(dropped);
+            strings.unpin(dropped.refs());
+        }
+    }
+
+    /**
+     * Write off bytes that will never be acknowledged (lost datagrams, or the
+     * controller restarted its counter), so the window cannot stay shut.
+     */
+    private void trackAckProgress() {
+        int acked = ackedBytes;
+        int inFlight = bytesInFlight();
+        if (inFlight > MAX_PLAUSIBLE_IN_FLIGHT) {
+            bytesSent = acked;
+            stalledCredits = 0;
+        } else if (inFlight > 0 && acked == lastAckedBytes) {
+            if (++stalledCredits >= LOSS_CREDITS) {
+                bytesSent = acked;
+                stalledCredits = 0;
+            }
+        } else {
+            stalledCredits = 0;
+        }
+        lastAckedBytes = acked;
+    }
+
+    private void resetFlowControl() {
+        for (Outgoing queued : bulkQueue) {
+            strings.unpin(queued.refs());
+        }
+        bulkQueue.clear();
+        windowBytes = 0;
+        creditCount = 0;
+        creditsSeen = 0;
+        stalledCredits = 0;
+        batchLosses = -1;
     }
 
     // ========================================================================
@@ -210,25 +550,71 @@ public class Protocol extends ProtocolCallbacks {
     // ========================================================================
 
     /**
-     * Dispatch incoming frame to callbacks
+     * Frame from the transport (receive thread): dispatch it on the control
+     * thread, in arrival order
+     */
+    private void receive(byte[] frame) {
+        host.scheduleTask(() -> {
+            if (isActive.get()) {
+                dispatch(frame);
+            }
+        }, 0);
+    }
+
+    /**
+     * Dispatch incoming frame to callbacks (control thread)
      */
     private void dispatch(byte[] frame) {
         if (frame == null || frame.length < ProtocolConstants.MIN_MESSAGE_LENGTH) {
             return;
         }
 
-        // Parse header
-        byte messageIdByte = frame[ProtocolConstants.MESSAGE_TYPE_OFFSET];
+        // Envelope: dispatch each [len][compact frame] record in order
+        if ((frame[ProtocolConstants.MESSAGE_TYPE_OFFSET] & 0xFF)
+                == (ProtocolConstants.ENVELOPE_MESSAGE_ID | ProtocolConstants.COMPACT_FRAME_FLAG)) {
+            int offset = 1;
+            while (offset < frame.length) {
+                int recordLength = frame[offset] & 0xFF;
+                if (offset + 1 + recordLength > frame.length) {
+                    host.errorln("[Protocol] Truncated envelope record");
+                    return;
+                }
+                byte[] record = new byte[recordLength];
+                System.arraycopy(frame, offset + 1, record, 0, recordLength);
+                if (record.length > 0 && (record[0] & ProtocolConstants.COMPACT_FRAME_FLAG) != 0
+                        && (record[0] & ProtocolConstants.MESSAGE_ID_MASK) != ProtocolConstants.ENVELOPE_MESSAGE_ID) {
+                    dispatch(record);
+                }
+                offset += 1 + recordLength;
+            }
+            return;
+        }
+
+        // Parse header (named or compact, see setCompactFrames)
+        int typeByte = frame[ProtocolConstants.MESSAGE_TYPE_OFFSET] & 0xFF;
+        byte messageIdByte = (byte) (typeByte & ProtocolConstants.MESSAGE_ID_MASK);
         MessageID messageId = MessageID.fromValue(messageIdByte);
         if (messageId == null) {
             host.errorln("[Protocol] Unknown message ID: " + messageIdByte);
             return;
         }
 
+        int payloadOffset = ProtocolConstants.PAYLOAD_OFFSET;
+        if ((typeByte & ProtocolConstants.COMPACT_FRAME_FLAG) == 0) {
+            // Named frame: skip [nameLen][name...]
+            if (frame.length < payloadOffset + 1) return;
+            int nameLen = frame[payloadOffset] & 0xFF;
+            payloadOffset += 1 + nameLen;
+            if (frame.length < payloadOffset) {
+                host.errorln("[Protocol] Truncated name prefix for " + messageId);
+                return;
+            }
+        }
+
         // Extract payload
-        int payloadLength = frame.length - ProtocolConstants.PAYLOAD_OFFSET;
+        int payloadLength = frame.length - payloadOffset;
         byte[] payload = new byte[payloadLength];
-        System.arraycopy(frame, ProtocolConstants.PAYLOAD_OFFSET, payload, 0, payloadLength);
+        System.arraycopy(frame, payloadOffset, payload, 0, payloadLength);
 
         // Dispatch to callbacks
         DecoderRegistry.dispatch(this, messageId, payload);
@@ -5,7 +5,7 @@ import protocol.struct.*;
 /**
  * ProtocolCallbacks - Typed callbacks for all messages
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  *
  * Base class providing typed callbacks for each message type.
  * Protocol extends this and DecoderRegistry calls these callbacks.
@@ -33,6 +33,7 @@ public abstract class ProtocolCallbacks extends ProtocolMethods {
 
     public MessageHandler<DeviceChangeMessage> onDeviceChange;
     public MessageHandler<DeviceChangeHeaderMessage> onDeviceChangeHeader;
+    public MessageHandler<DeviceChainStampMessage> onDeviceChainStamp;
     public MessageHandler<DeviceChildrenMessage> onDeviceChildren;
     public MessageHandler<DeviceEnabledStateMessage> onDeviceEnabledState;
     public MessageHandler<DeviceListWindowMessage> onDeviceListWindow;
@@ -62,9 +63,13 @@ public abstract class ProtocolCallbacks extends ProtocolMethods {
     public MessageHandler<LastClickedUpdateMessage> onLastClickedUpdate;
     public MessageHandler<LastClickedValueMessage> onLastClickedValue;
     public MessageHandler<LastClickedValueStateMessage> onLastClickedValueState;
+    public MessageHandler<FlowCreditMessage> onFlowCredit;
     public MessageHandler<HostDeactivatedMessage> onHostDeactivated;
     public MessageHandler<HostInitializedMessage> onHostInitialized;
+    public MessageHandler<RenderStatsMessage> onRenderStats;
     public MessageHandler<RequestHostStatusMessage> onRequestHostStatus;
+    public MessageHandler<StringDefineMessage> onStringDefine;
+    public MessageHandler<StringMissMessage> onStringMiss;
     public MessageHandler<EnterTrackGroupMessage> onEnterTrackGroup;
     public MessageHandler<ExitTrackGroupMessage> onExitTrackGroup;
     public MessageHandler<RequestSendDestinationsMessage> onRequestSendDestinations;
@@ -3,7 +3,7 @@ package protocol;
 /**
  * ProtocolConstants - Protocol Configuration Constants (Binary)
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: BinaryConfig
  *
  * This class contains all protocol constants including message structure
@@ -33,6 +33,15 @@ public final class ProtocolConstants {
     /** Minimum valid message length */
     public static final int MIN_MESSAGE_LENGTH = 1;
 
+    /** MessageID byte flag: frame has no MESSAGE_NAME prefix */
+    public static final int COMPACT_FRAME_FLAG = 0x80;
+
+    /** MessageID bits of the type byte */
+    public static final int MESSAGE_ID_MASK = 0x7F;
+
+    /** Reserved MessageID: frame packs several compact records */
+    public static final int ENVELOPE_MESSAGE_ID = 0x7F;
+
     // ============================================================================
     // ENCODING LIMITS
     // ============================================================================
@@ -49,5 +58,11 @@ public final class ProtocolConstants {
     /** Maximum total message bytes */
     public static final int MAX_MESSAGE_SIZE = 16000;
 
+    /** Maximum envelope frame bytes */
+    public static final int MAX_ENVELOPE_SIZE = 512;
+
+    /** Maximum envelope record bytes (8-bit length) */
+    public static final int MAX_ENVELOPE_RECORD_SIZE = 255;
+
 
 }  // class ProtocolConstants
@@ -1,7 +1,7 @@
 /**
  * ProtocolMethods.java - Explicit Protocol API
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  *
  * This class provides explicit API methods instead of generic send().
  * Extend this class or include its methods in your Protocol class.
@@ -43,7 +43,10 @@ public abstract class ProtocolMethods {
     public Consumer<ViewStateMessage> onViewState = null;
     public Consumer<LastClickedTouchMessage> onLastClickedTouch = null;
     public Consumer<LastClickedValueMessage> onLastClickedValue = null;
+    public Consumer<FlowCreditMessage> onFlowCredit = null;
+    public Consumer<RenderStatsMessage> onRenderStats = null;
     public Consumer<RequestHostStatusMessage> onRequestHostStatus = null;
+    public Consumer<StringMissMessage> onStringMiss = null;
     public Consumer<EnterTrackGroupMessage> onEnterTrackGroup = null;
     public Consumer<ExitTrackGroupMessage> onExitTrackGroup = null;
     public Consumer<RequestSendDestinationsMessage> onRequestSendDestinations = null;
@@ -82,8 +85,12 @@ public abstract class ProtocolMethods {
         send(new DeviceChangeMessage(deviceTrackName, deviceName, isEnabled, pageInfo, remoteControls));
     }
 
-    public void deviceChangeHeader(String deviceName, boolean isEnabled, DeviceType deviceType, DeviceChangeHeaderMessage.PageInfo pageInfo, int[] childrenTypes) {
-        send(new DeviceChangeHeaderMessage(deviceName, isEnabled, deviceType, pageInfo, childrenTypes));
+    public void deviceChangeHeader(String deviceName, boolean isEnabled, DeviceType deviceType, DeviceChangeHeaderMessage.PageInfo pageInfo, int[] childrenTypes, long deviceIdentity, long pageNamesHash) {
+        send(new DeviceChangeHeaderMessage(deviceName, isEnabled, deviceType, pageInfo, childrenTypes, deviceIdentity, pageNamesHash));
+    }
+
+    public void deviceChainStamp(long chainIdentity, long chainStamp, int deviceCount, int deviceIndex, boolean isNested, boolean windowFollows) {
+        send(new DeviceChainStampMessage(chainIdentity, chainStamp, deviceCount, deviceIndex, isNested, windowFollows));
     }
 
     public void deviceChildren(int deviceIndex, int childType, int childrenCount, DeviceChildrenMessage.Children[] children) {
@@ -94,20 +101,20 @@ public abstract class ProtocolMethods {
         send(new DeviceEnabledStateMessage(deviceIndex, isEnabled));
     }
 
-    public void deviceListWindow(int deviceCount, int deviceStartIndex, int deviceIndex, boolean isNested, String parentName, DeviceListWindowMessage.Devices[] devices) {
-        send(new DeviceListWindowMessage(deviceCount, deviceStartIndex, deviceIndex, isNested, parentName, devices));
+    public void deviceListWindow(int deviceCount, int deviceStartIndex, int deviceIndex, boolean isNested, String parentName, DeviceListWindowMessage.Devices[] devices, int[] deviceNamePrefixes) {
+        send(new DeviceListWindowMessage(deviceCount, deviceStartIndex, deviceIndex, isNested, parentName, devices, deviceNamePrefixes));
     }
 
     public void devicePageChange(DevicePageChangeMessage.PageInfo pageInfo, DevicePageChangeMessage.RemoteControls[] remoteControls) {
         send(new DevicePageChangeMessage(pageInfo, remoteControls));
     }
 
-    public void devicePageNamesWindow(int devicePageCount, int pageStartIndex, int devicePageIndex, String[] pageNames) {
-        send(new DevicePageNamesWindowMessage(devicePageCount, pageStartIndex, devicePageIndex, pageNames));
+    public void devicePageNamesWindow(int devicePageCount, int pageStartIndex, int devicePageIndex, String[] pageNames, int[] pageNamePrefixes) {
+        send(new DevicePageNamesWindowMessage(devicePageCount, pageStartIndex, devicePageIndex, pageNames, pageNamePrefixes));
     }
 
-    public void deviceRemoteControlsBatch(int sequenceNumber, int dirtyMask, int echoMask, int hasAutomationMask, float[] values, float[] modulatedValues, String[] displayValues) {
-        send(new DeviceRemoteControlsBatchMessage(sequenceNumber, dirtyMask, echoMask, hasAutomationMask, values, modulatedValues, displayValues));
+    public void deviceRemoteControlsBatch(int sequenceNumber, int dirtyMask, int echoMask, int hasAutomationMask, int modulatedMask, float[] values, float[] modulatedValues, String[] displayValues) {
+        send(new DeviceRemoteControlsBatchMessage(sequenceNumber, dirtyMask, echoMask, hasAutomationMask, modulatedMask, values, modulatedValues, displayValues));
     }
 
     public void deviceRemoteControlDiscreteValues(int remoteControlIndex, String[] discreteValueNames, int currentValueIndex) {
@@ -150,8 +157,12 @@ public abstract class ProtocolMethods {
         send(new HostDeactivatedMessage(isHostActive));
     }
 
-    public void hostInitialized(boolean isHostActive) {
-        send(new HostInitializedMessage(isHostActive));
+    public void hostInitialized(boolean isHostActive, boolean compactFrames) {
+        send(new HostInitializedMessage(isHostActive, compactFrames));
+    }
+
+    public void stringDefine(int stringId, String text) {
+        send(new StringDefineMessage(stringId, text));
     }
 
     public void sendDestinationsList(int sendCount, SendDestinationsListMessage.SendDestinations[] sendDestinations) {
@@ -166,8 +177,8 @@ public abstract class ProtocolMethods {
         send(new TrackChangeMessage(trackName, color, trackIndex, trackType, isActivated, isMute, isSolo, isMutedBySolo, isArm, volume, volumeDisplay, pan, panDisplay));
     }
 
-    public void trackListWindow(int trackCount, int trackStartIndex, int trackIndex, boolean isNested, String parentGroupName, TrackListWindowMessage.Tracks[] tracks) {
-        send(new TrackListWindowMessage(trackCount, trackStartIndex, trackIndex, isNested, parentGroupName, tracks));
+    public void trackListWindow(int trackCount, int trackStartIndex, int trackIndex, boolean isNested, String parentGroupName, TrackListWindowMessage.Tracks[] tracks, int[] trackNamePrefixes) {
+        send(new TrackListWindowMessage(trackCount, trackStartIndex, trackIndex, isNested, parentGroupName, tracks, trackNamePrefixes));
     }
 
     public void trackMutedBySoloState(int trackIndex, boolean isMutedBySolo) {
@@ -0,0 +1,196 @@
+package protocol;
+
+import java.util.Arrays;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+/**
+ * StringDictionary - Host side of the string dictionary
+ *
+ * MANUAL - DO NOT REGENERATE
+ *
+ * Names that repeat across navigation (device, page, track, parameter names,
+ * discrete value labels) are sent once with STRING_DEFINE; ref() then
+ * returns a 3-char reference to put in the name field instead:
+ *
+ *   [REFERENCE_MARKER][id lo][id hi]
+ *
+ * The controller keeps CAPACITY strings in fixed memory and resolves the
+ * references (src/protocol/StringDictionary.hpp). This side decides what it
+ * keeps: the least recently referenced name gives up its slot, and an ID is
+ * (generation << SLOT_BITS) | slot so a stale reference cannot resolve to the
+ * new name.
+ *
+ * Protocol ties every message to the IDs referenced while building it
+ * (takeReferences()). A slot referenced by a bulk message still waiting in
+ * the flow control queue is pinned and never evicted. A STRING_MISS (the
+ * STRING_DEFINE was lost, or arrived after a reordered reference) returns
+ * the definition and the last message that carried the ID, so Protocol can
+ * define it again and resend that message instead of leaving a blank name.
+ * The previous definition of each slot is kept for the same purpose.
+ *
+ * Control thread only (Protocol dispatches controller messages there).
+ */
+public final class StringDictionary {
+
+    public static final int SLOT_BITS = 7;
+    public static final int CAPACITY = 1 << SLOT_BITS;  // Must match StringDictionary.hpp
+    private static final int SLOT_MASK = CAPACITY - 1;
+    private static final int GENERATION_MASK = 0xFFFF >> SLOT_BITS;
+    private static final char REFERENCE_MARKER = '\u001F';
+    private static final int REFERENCE_LENGTH = 3;
+    private static final int[] NO_REFERENCES = new int[0];
+
+    private final ProtocolMethods protocol;
+    // Name -> ID, in access order (eldest = least recently referenced)
+    private final LinkedHashMap<String, Integer> ids = new LinkedHashMap<>(CAPACITY * 2, 0.75f, true);
+    private final int[] generations = new int[CAPACITY];
+    private final Definition[] current = new Definition[CAPACITY];
+    private final Definition[] retired = new Definition[CAPACITY];  // Last evicted, per slot
+    private final int[] pins = new int[CAPACITY];  // Queued messages referencing the slot
+    private int[] references = new int[16];  // IDs referenced since the last takeReferences()
+    private int referenceCount = 0;
+    private int usedSlots = 0;
+    private boolean enabled = true;
+
+    /** A defined string and the last message that referenced it */
+    static final class Definition {
+        final int id;
+        final String text;
+        Object carrier;
+
+        Definition(int id, String text) {
+            this.id = id;
+            this.text = text;
+        }
+    }
+
+    StringDictionary(ProtocolMethods protocol) {
+        this.protocol = protocol;
+    }
+
+    /**
+     * Name field value for @p text: a reference, after defining the string
+     * on first use. Names too short to gain anything, or too long for a
+     * controller slot, are returned unchanged.
+     */
+    public synchronized String ref(String text) {
+        if (!enabled || text == null || text.length() <= REFERENCE_LENGTH
+                || text.length() > ProtocolConstants.STRING_MAX_LENGTH) {
+            return text;
+        }
+
+        Integer id = ids.get(text);
+        if (id == null) {
+            int slot = allocate();
+            if (slot < 0) return text;  // Every slot pinned by queued messages
+            id = define(slot, text);
+        }
+        if (referenceCount == references.length) {
+            references = Arrays.copyOf(references, referenceCount * 2);
+        }
+        references[referenceCount++] = id;
+        return reference(id);
+    }
+
+    /** IDs referenced since the previous call: the message about to be sent carries them */
+    synchronized int[] takeReferences() {
+        if (referenceCount == 0) return NO_REFERENCES;
+        int[] taken = Arrays.copyOf(references, referenceCount);
+        referenceCount = 0;
+        return taken;
+    }
+
+    /** @p message is the latest one to reference @p refs (resent on a miss) */
+    synchronized void carriedBy(int[] refs, Object message) {
+        for (int id : refs) {
+            Definition definition = current[id & SLOT_MASK];
+            if (definition != null && definition.id == id) {
+                definition.carrier = message;
+            }
+        }
+    }
+
+    /** A queued message references @p refs: their slots cannot be evicted until unpin() */
+    synchronized void pin(int[] refs) {
+        for (int id : refs) {
+            pins[id & SLOT_MASK]++;
+        }
+    }
+
+    synchronized void unpin(int[] refs) {
+        for (int id : refs) {
+            int slot = id & SLOT_MASK;
+            if (pins[slot] > 0) pins[slot]--;
+        }
+    }
+
+    /** ref() of every name, as a new array (@p names is left untouched) */
+    public String[] refAll(String[] names) {
+        if (names == null) return null;
+        String[] refs = new String[names.length];
+        for (int i = 0; i < names.length; i++) {
+            refs[i] = ref(names[i]);
+        }
+        return refs;
+    }
+
+    /** Off: ref() returns every name unchanged */
+    public synchronized void setEnabled(boolean enabled) {
+        this.enabled = enabled;
+    }
+
+    /**
+     * STRING_MISS: the controller does not hold this ID.
+     *
+     * @return the definition to send again, with the message to resend after
+     *         it, or null if the ID is older than the slot's last eviction
+     */
+    synchronized Definition onMiss(int id) {
+        int slot = id & SLOT_MASK;
+        if (current[slot] != null && current[slot].id == id) return current[slot];
+        if (retired[slot] != null && retired[slot].id == id) return retired[slot];
+        return null;
+    }
+
+    /** Forget everything (the controller clears its side on HOST_INITIALIZED) */
+    public synchronized void reset() {
+        ids.clear();
+        usedSlots = 0;
+        Arrays.fill(current, null);
+        Arrays.fill(retired, null);
+        Arrays.fill(pins, 0);
+        referenceCount = 0;
+        // generations[] is kept: references still in flight cannot match new IDs
+    }
+
+    /** Unused slot, or the least recently referenced unpinned one; -1 if all are pinned */
+    private int allocate() {
+        if (usedSlots < CAPACITY) return usedSlots++;
+
+        Iterator<Map.Entry<String, Integer>> it = ids.entrySet().iterator();
+        while (it.hasNext()) {
+            int slot = it.next().getValue() & SLOT_MASK;
+            if (pins[slot] == 0) {
+                it.remove();
+                retired[slot] = current[slot];
+                return slot;
+            }
+        }
+        return -1;
+    }
+
+    private int define(int slot, String text) {
+        generations[slot] = (generations[slot] + 1) & GENERATION_MASK;
+        int id = (generations[slot] << SLOT_BITS) | slot;
+        ids.put(text, id);
+        current[slot] = new Definition(id, text);
+        protocol.stringDefine(id, text);
+        return id;
+    }
+
+    private static String reference(int id) {
+        return new String(new char[] {REFERENCE_MARKER, (char) (id & 0xFF), (char) ((id >> 8) & 0xFF)});
+    }
+}
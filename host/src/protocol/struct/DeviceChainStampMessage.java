@@ -0,0 +1,191 @@
+package protocol.struct;
+
+import protocol.MessageID;
+import protocol.Encoder;
+import protocol.Decoder;
+
+/**
+ * DeviceChainStampMessage - Auto-generated Protocol Message
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ * Generated from: types.yaml
+ *
+ * Description: DEVICE_CHAIN_STAMP message
+ *
+ * This class is immutable and uses Encoder for encode/decode operations.
+ * All encoding is 8-bit binary (Binary).
+ */
+public final class DeviceChainStampMessage {
+
+
+    // ============================================================================
+    // Auto-detected MessageID for protocol.send()
+    // ============================================================================
+
+    public static final MessageID MESSAGE_ID = MessageID.DEVICE_CHAIN_STAMP;
+
+    // Message name for logging (framed by the protocol layer, not the codec)
+    public static final String MESSAGE_NAME = "DeviceChainStamp";
+
+
+    // ============================================================================
+    // Fields
+    // ============================================================================
+
+    private final long chainIdentity;
+    private final long chainStamp;
+    private final int deviceCount;
+    private final int deviceIndex;
+    private final boolean isNested;
+    private final boolean windowFollows;
+
+    // ============================================================================
+    // Constructor
+    // ============================================================================
+
+    /**
+     * Construct a new DeviceChainStampMessage
+     *
+     * @param chainIdentity The chainIdentity value
+     * @param chainStamp The chainStamp value
+     * @param deviceCount The deviceCount value
+     * @param deviceIndex The deviceIndex value
+     * @param isNested The isNested value
+     * @param windowFollows The windowFollows value
+     */
+    public DeviceChainStampMessage(long chainIdentity, long chainStamp, int deviceCount, int deviceIndex, boolean isNested, boolean windowFollows) {
+        this.chainIdentity = chainIdentity;
+        this.chainStamp = chainStamp;
+        this.deviceCount = deviceCount;
+        this.deviceIndex = deviceIndex;
+        this.isNested = isNested;
+        this.windowFollows = windowFollows;
+    }
+
+    // ============================================================================
+    // Getters
+    // ============================================================================
+
+    /**
+     * Get the chainIdentity value
+     *
+     * @return chainIdentity
+     */
+    public long getChainIdentity() {
+        return chainIdentity;
+    }
+
+    /**
+     * Get the chainStamp value
+     *
+     * @return chainStamp
+     */
+    public long getChainStamp() {
+        return chainStamp;
+    }
+
+    /**
+     * Get the deviceCount value
+     *
+     * @return deviceCount
+     */
+    public int getDeviceCount() {
+        return deviceCount;
+    }
+
+    /**
+     * Get the deviceIndex value
+     *
+     * @return deviceIndex
+     */
+    public int getDeviceIndex() {
+        return deviceIndex;
+    }
+
+    /**
+     * Get the isNested value
+     *
+     * @return isNested
+     */
+    public boolean isNested() {
+        return isNested;
+    }
+
+    /**
+     * Get the windowFollows value
+     *
+     * @return windowFollows
+     */
+    public boolean getWindowFollows() {
+        return windowFollows;
+    }
+
+    // ============================================================================
+    // Encoding
+    // ============================================================================
+
+    /**
+     * Maximum payload size in bytes (8-bit binary)
+     */
+    public static final int MAX_PAYLOAD_SIZE = 12;
+
+    /**
+     * Encode message directly into provided buffer (zero allocation)
+     *
+     * @param buffer Output buffer (must have enough space)
+     * @param startOffset Starting position in buffer
+     * @return Number of bytes written
+     */
+    public int encode(byte[] buffer, int startOffset) {
+        int offset = startOffset;
+
+        offset += Encoder.encodeUint32(buffer, offset, chainIdentity);
+        offset += Encoder.encodeUint32(buffer, offset, chainStamp);
+        offset += Encoder.encodeUint8(buffer, offset, deviceCount);
+        offset += Encoder.encodeUint8(buffer, offset, deviceIndex);
+        offset += Encoder.encodeBool(buffer, offset, isNested);
+        offset += Encoder.encodeBool(buffer, offset, windowFollows);
+
+        return offset - startOffset;
+    }
+
+    // ============================================================================
+    // Decoding
+    // ============================================================================
+
+    /**
+     * Minimum payload size in bytes (with empty strings)
+     */
+    private static final int MIN_PAYLOAD_SIZE = 12;
+
+    /**
+     * Decode message from MIDI-safe bytes
+     *
+     * @param data Input buffer with encoded data
+     * @return Decoded DeviceChainStampMessage instance
+     * @throws IllegalArgumentException if data is invalid or insufficient
+     */
+    public static DeviceChainStampMessage decode(byte[] data) {
+        if (data.length < MIN_PAYLOAD_SIZE) {
+            throw new IllegalArgumentException("Insufficient data for DeviceChainStampMessage decode");
+        }
+
+        int offset = 0;
+
+        long chainIdentity = Decoder.decodeUint32(data, offset);
+        offset += 4;
+        long chainStamp = Decoder.decodeUint32(data, offset);
+        offset += 4;
+        int deviceCount = Decoder.decodeUint8(data, offset);
+        offset += 1;
+        int deviceIndex = Decoder.decodeUint8(data, offset);
+        offset += 1;
+        boolean isNested = Decoder.decodeBool(data, offset);
+        offset += 1;
+        boolean windowFollows = Decoder.decodeBool(data, offset);
+        offset += 1;
+
+        return new DeviceChainStampMessage(chainIdentity, chainStamp, deviceCount, deviceIndex, isNested, windowFollows);
+    }
+
+}  // class Message
@@ -9,7 +9,7 @@ import protocol.DeviceType;
 /**
  * DeviceChangeHeaderMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_CHANGE_HEADER message
@@ -26,7 +26,7 @@ public final class DeviceChangeHeaderMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_CHANGE_HEADER;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DeviceChangeHeader";
 
     // ============================================================================
@@ -67,6 +67,8 @@ public final class DeviceChangeHeaderMessage {
     private final DeviceType deviceType;
     private final PageInfo pageInfo;
     private final int[] childrenTypes;
+    private final long deviceIdentity;
+    private final long pageNamesHash;
 
     // ============================================================================
     // Constructor
@@ -80,13 +82,17 @@ public final class DeviceChangeHeaderMessage {
      * @param deviceType The deviceType value
      * @param pageInfo The pageInfo value
      * @param childrenTypes The childrenTypes value
+     * @param deviceIdentity The deviceIdentity value
+     * @param pageNamesHash The pageNamesHash value
      */
-    public DeviceChangeHeaderMessage(String deviceName, boolean isEnabled, DeviceType deviceType, PageInfo pageInfo, int[] childrenTypes) {
+    public DeviceChangeHeaderMessage(String deviceName, boolean isEnabled, DeviceType deviceType, PageInfo pageInfo, int[] childrenTypes, long deviceIdentity, long pageNamesHash) {
         this.deviceName = deviceName;
         this.isEnabled = isEnabled;
         this.deviceType = deviceType;
         this.pageInfo = pageInfo;
         this.childrenTypes = childrenTypes;
+        this.deviceIdentity = deviceIdentity;
+        this.pageNamesHash = pageNamesHash;
     }
 
     // ============================================================================
@@ -138,6 +144,24 @@ public final class DeviceChangeHeaderMessage {
         return childrenTypes;
     }
 
+    /**
+     * Get the deviceIdentity value
+     *
+     * @return deviceIdentity
+     */
+    public long getDeviceIdentity() {
+        return deviceIdentity;
+    }
+
+    /**
+     * Get the pageNamesHash value
+     *
+     * @return pageNamesHash
+     */
+    public long getPageNamesHash() {
+        return pageNamesHash;
+    }
+
     // ============================================================================
     // Encoding
     // ============================================================================
@@ -145,7 +169,7 @@ public final class DeviceChangeHeaderMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 94;
+    public static final int MAX_PAYLOAD_SIZE = 83;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -157,12 +181,6 @@ public final class DeviceChangeHeaderMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeString(buffer, offset, deviceName);
         offset += Encoder.encodeBool(buffer, offset, isEnabled);
         offset += Encoder.encodeUint8(buffer, offset, deviceType.getValue());
@@ -174,7 +192,8 @@ public final class DeviceChangeHeaderMessage {
         for (int item : childrenTypes) {
             offset += Encoder.encodeUint8(buffer, offset, item);
         }
-
+        offset += Encoder.encodeUint32(buffer, offset, deviceIdentity);
+        offset += Encoder.encodeUint32(buffer, offset, pageNamesHash);
 
         return offset - startOffset;
     }
@@ -186,7 +205,7 @@ public final class DeviceChangeHeaderMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 26;
+    private static final int MIN_PAYLOAD_SIZE = 15;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -202,10 +221,6 @@ public final class DeviceChangeHeaderMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         String deviceName = Decoder.decodeString(data, offset, ProtocolConstants.STRING_MAX_LENGTH);
         offset += 1 + deviceName.length();
         boolean isEnabled = Decoder.decodeBool(data, offset);
@@ -229,9 +244,12 @@ public final class DeviceChangeHeaderMessage {
             childrenTypes[i] = Decoder.decodeUint8(data, offset);
             offset += 1;
         }
+        long deviceIdentity = Decoder.decodeUint32(data, offset);
+        offset += 4;
+        long pageNamesHash = Decoder.decodeUint32(data, offset);
+        offset += 4;
 
-
-        return new DeviceChangeHeaderMessage(deviceName, isEnabled, deviceType, pageInfo, childrenTypes);
+        return new DeviceChangeHeaderMessage(deviceName, isEnabled, deviceType, pageInfo, childrenTypes, deviceIdentity, pageNamesHash);
     }
 
 }  // class Message
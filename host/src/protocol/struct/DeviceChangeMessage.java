@@ -9,7 +9,7 @@ import protocol.ParameterType;
 /**
  * DeviceChangeMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_CHANGE message
@@ -26,7 +26,7 @@ public final class DeviceChangeMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_CHANGE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DeviceChange";
 
     // ============================================================================
@@ -234,7 +234,7 @@ public final class DeviceChangeMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 9260;
+    public static final int MAX_PAYLOAD_SIZE = 9247;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -246,12 +246,6 @@ public final class DeviceChangeMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeString(buffer, offset, deviceTrackName);
         offset += Encoder.encodeString(buffer, offset, deviceName);
         offset += Encoder.encodeBool(buffer, offset, isEnabled);
@@ -290,7 +284,7 @@ public final class DeviceChangeMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 20;
+    private static final int MIN_PAYLOAD_SIZE = 7;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -306,10 +300,6 @@ public final class DeviceChangeMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         String deviceTrackName = Decoder.decodeString(data, offset, ProtocolConstants.STRING_MAX_LENGTH);
         offset += 1 + deviceTrackName.length();
         String deviceName = Decoder.decodeString(data, offset, ProtocolConstants.STRING_MAX_LENGTH);
@@ -8,7 +8,7 @@ import protocol.ProtocolConstants;
 /**
  * DeviceChildrenMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_CHILDREN message
@@ -25,7 +25,7 @@ public final class DeviceChildrenMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_CHILDREN;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DeviceChildren";
 
     // ============================================================================
@@ -132,7 +132,7 @@ public final class DeviceChildrenMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 579;
+    public static final int MAX_PAYLOAD_SIZE = 564;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -144,12 +144,6 @@ public final class DeviceChildrenMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, deviceIndex);
         offset += Encoder.encodeUint8(buffer, offset, childType);
         offset += Encoder.encodeUint8(buffer, offset, childrenCount);
@@ -172,7 +166,7 @@ public final class DeviceChildrenMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 19;
+    private static final int MIN_PAYLOAD_SIZE = 4;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -188,10 +182,6 @@ public final class DeviceChildrenMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int deviceIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
         int childType = Decoder.decodeUint8(data, offset);
@@ -7,7 +7,7 @@ import protocol.Decoder;
 /**
  * DeviceEnabledStateMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_ENABLED_STATE message
@@ -24,7 +24,7 @@ public final class DeviceEnabledStateMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_ENABLED_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DeviceEnabledState";
 
 
@@ -79,7 +79,7 @@ public final class DeviceEnabledStateMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 21;
+    public static final int MAX_PAYLOAD_SIZE = 2;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -91,12 +91,6 @@ public final class DeviceEnabledStateMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, deviceIndex);
         offset += Encoder.encodeBool(buffer, offset, isEnabled);
 
@@ -110,7 +104,7 @@ public final class DeviceEnabledStateMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 21;
+    private static final int MIN_PAYLOAD_SIZE = 2;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -126,10 +120,6 @@ public final class DeviceEnabledStateMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int deviceIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
         boolean isEnabled = Decoder.decodeBool(data, offset);
@@ -9,7 +9,7 @@ import protocol.DeviceType;
 /**
  * DeviceListWindowMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_LIST_WINDOW message
@@ -26,7 +26,7 @@ public final class DeviceListWindowMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_LIST_WINDOW;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DeviceListWindow";
 
     // ============================================================================
@@ -80,6 +80,7 @@ public final class DeviceListWindowMessage {
     private final boolean isNested;
     private final String parentName;
     private final Devices[] devices;
+    private final int[] deviceNamePrefixes;
 
     // ============================================================================
     // Constructor
@@ -94,14 +95,16 @@ public final class DeviceListWindowMessage {
      * @param isNested The isNested value
      * @param parentName The parentName value
      * @param devices The devices value
+     * @param deviceNamePrefixes The deviceNamePrefixes value
      */
-    public DeviceListWindowMessage(int deviceCount, int deviceStartIndex, int deviceIndex, boolean isNested, String parentName, Devices[] devices) {
+    public DeviceListWindowMessage(int deviceCount, int deviceStartIndex, int deviceIndex, boolean isNested, String parentName, Devices[] devices, int[] deviceNamePrefixes) {
         this.deviceCount = deviceCount;
         this.deviceStartIndex = deviceStartIndex;
         this.deviceIndex = deviceIndex;
         this.isNested = isNested;
         this.parentName = parentName;
         this.devices = devices;
+        this.deviceNamePrefixes = deviceNamePrefixes;
     }
 
     // ============================================================================
@@ -162,6 +165,15 @@ public final class DeviceListWindowMessage {
         return devices;
     }
 
+    /**
+     * Get the deviceNamePrefixes value
+     *
+     * @return deviceNamePrefixes
+     */
+    public int[] getDeviceNamePrefixes() {
+        return deviceNamePrefixes;
+    }
+
     // ============================================================================
     // Encoding
     // ============================================================================
@@ -181,12 +193,6 @@ public final class DeviceListWindowMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, deviceCount);
         offset += Encoder.encodeUint8(buffer, offset, deviceStartIndex);
         offset += Encoder.encodeUint8(buffer, offset, deviceIndex);
@@ -205,6 +211,12 @@ public final class DeviceListWindowMessage {
             }
         }
 
+        offset += Encoder.encodeUint8(buffer, offset, deviceNamePrefixes.length);
+
+        for (int item : deviceNamePrefixes) {
+            offset += Encoder.encodeUint8(buffer, offset, item);
+        }
+
 
         return offset - startOffset;
     }
@@ -216,7 +228,7 @@ public final class DeviceListWindowMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 23;
+    private static final int MIN_PAYLOAD_SIZE = 7;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -232,10 +244,6 @@ public final class DeviceListWindowMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int deviceCount = Decoder.decodeUint8(data, offset);
         offset += 1;
         int deviceStartIndex = Decoder.decodeUint8(data, offset);
@@ -270,8 +278,17 @@ public final class DeviceListWindowMessage {
             devices[i] = new Devices(item_deviceIndex, item_deviceName, item_isEnabled, item_deviceType, item_childrenTypes);
         }
 
+        int count_deviceNamePrefixes = Decoder.decodeUint8(data, offset);
+        offset += 1;
+
+        int[] deviceNamePrefixes = new int[count_deviceNamePrefixes];
+        for (int i = 0; i < count_deviceNamePrefixes; i++) {
+            deviceNamePrefixes[i] = Decoder.decodeUint8(data, offset);
+            offset += 1;
+        }
+
 
-        return new DeviceListWindowMessage(deviceCount, deviceStartIndex, deviceIndex, isNested, parentName, devices);
+        return new DeviceListWindowMessage(deviceCount, deviceStartIndex, deviceIndex, isNested, parentName, devices, deviceNamePrefixes);
     }
 
 }  // class Message
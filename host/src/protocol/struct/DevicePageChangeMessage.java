@@ -9,7 +9,7 @@ import protocol.ParameterType;
 /**
  * DevicePageChangeMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_PAGE_CHANGE message
@@ -26,7 +26,7 @@ public final class DevicePageChangeMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_PAGE_CHANGE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DevicePageChange";
 
     // ============================================================================
@@ -198,7 +198,7 @@ public final class DevicePageChangeMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 9197;
+    public static final int MAX_PAYLOAD_SIZE = 9180;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -210,12 +210,6 @@ public final class DevicePageChangeMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, pageInfo.getDevicePageIndex());
         offset += Encoder.encodeUint8(buffer, offset, pageInfo.getDevicePageCount());
         offset += Encoder.encodeString(buffer, offset, pageInfo.getDevicePageName());
@@ -251,7 +245,7 @@ public final class DevicePageChangeMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 21;
+    private static final int MIN_PAYLOAD_SIZE = 4;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -267,10 +261,6 @@ public final class DevicePageChangeMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int pageInfo_devicePageIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
         int pageInfo_devicePageCount = Decoder.decodeUint8(data, offset);
@@ -8,7 +8,7 @@ import protocol.ProtocolConstants;
 /**
  * DevicePageNamesWindowMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_PAGE_NAMES_WINDOW message
@@ -25,7 +25,7 @@ public final class DevicePageNamesWindowMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_PAGE_NAMES_WINDOW;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DevicePageNamesWindow";
 
 
@@ -37,6 +37,7 @@ public final class DevicePageNamesWindowMessage {
     private final int pageStartIndex;
     private final int devicePageIndex;
     private final String[] pageNames;
+    private final int[] pageNamePrefixes;
 
     // ============================================================================
     // Constructor
@@ -49,12 +50,14 @@ public final class DevicePageNamesWindowMessage {
      * @param pageStartIndex The pageStartIndex value
      * @param devicePageIndex The devicePageIndex value
      * @param pageNames The pageNames value
+     * @param pageNamePrefixes The pageNamePrefixes value
      */
-    public DevicePageNamesWindowMessage(int devicePageCount, int pageStartIndex, int devicePageIndex, String[] pageNames) {
+    public DevicePageNamesWindowMessage(int devicePageCount, int pageStartIndex, int devicePageIndex, String[] pageNames, int[] pageNamePrefixes) {
         this.devicePageCount = devicePageCount;
         this.pageStartIndex = pageStartIndex;
         this.devicePageIndex = devicePageIndex;
         this.pageNames = pageNames;
+        this.pageNamePrefixes = pageNamePrefixes;
     }
 
     // ============================================================================
@@ -97,6 +100,15 @@ public final class DevicePageNamesWindowMessage {
         return pageNames;
     }
 
+    /**
+     * Get the pageNamePrefixes value
+     *
+     * @return pageNamePrefixes
+     */
+    public int[] getPageNamePrefixes() {
+        return pageNamePrefixes;
+    }
+
     // ============================================================================
     // Encoding
     // ============================================================================
@@ -104,7 +116,7 @@ public final class DevicePageNamesWindowMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 554;
+    public static final int MAX_PAYLOAD_SIZE = 549;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -116,12 +128,6 @@ public final class DevicePageNamesWindowMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, devicePageCount);
         offset += Encoder.encodeUint8(buffer, offset, pageStartIndex);
         offset += Encoder.encodeUint8(buffer, offset, devicePageIndex);
@@ -131,6 +137,12 @@ public final class DevicePageNamesWindowMessage {
             offset += Encoder.encodeString(buffer, offset, item);
         }
 
+        offset += Encoder.encodeUint8(buffer, offset, pageNamePrefixes.length);
+
+        for (int item : pageNamePrefixes) {
+            offset += Encoder.encodeUint8(buffer, offset, item);
+        }
+
 
         return offset - startOffset;
     }
@@ -142,7 +154,7 @@ public final class DevicePageNamesWindowMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 26;
+    private static final int MIN_PAYLOAD_SIZE = 5;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -158,10 +170,6 @@ public final class DevicePageNamesWindowMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int devicePageCount = Decoder.decodeUint8(data, offset);
         offset += 1;
         int pageStartIndex = Decoder.decodeUint8(data, offset);
@@ -177,8 +185,17 @@ public final class DevicePageNamesWindowMessage {
             offset += 1 + pageNames[i].length();
         }
 
+        int count_pageNamePrefixes = Decoder.decodeUint8(data, offset);
+        offset += 1;
+
+        int[] pageNamePrefixes = new int[count_pageNamePrefixes];
+        for (int i = 0; i < count_pageNamePrefixes; i++) {
+            pageNamePrefixes[i] = Decoder.decodeUint8(data, offset);
+            offset += 1;
+        }
+
 
-        return new DevicePageNamesWindowMessage(devicePageCount, pageStartIndex, devicePageIndex, pageNames);
+        return new DevicePageNamesWindowMessage(devicePageCount, pageStartIndex, devicePageIndex, pageNames, pageNamePrefixes);
     }
 
 }  // class Message
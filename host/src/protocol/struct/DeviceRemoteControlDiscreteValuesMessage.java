@@ -8,7 +8,7 @@ import protocol.ProtocolConstants;
 /**
  * DeviceRemoteControlDiscreteValuesMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_REMOTE_CONTROL_DISCRETE_VALUES message
@@ -25,7 +25,7 @@ public final class DeviceRemoteControlDiscreteValuesMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_REMOTE_CONTROL_DISCRETE_VALUES;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DeviceRemoteControlDiscreteValues";
 
 
@@ -92,7 +92,7 @@ public final class DeviceRemoteControlDiscreteValuesMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 1093;
+    public static final int MAX_PAYLOAD_SIZE = 1059;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -104,12 +104,6 @@ public final class DeviceRemoteControlDiscreteValuesMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, remoteControlIndex);
         offset += Encoder.encodeUint8(buffer, offset, discreteValueNames.length);
 
@@ -129,7 +123,7 @@ public final class DeviceRemoteControlDiscreteValuesMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 37;
+    private static final int MIN_PAYLOAD_SIZE = 3;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -145,10 +139,6 @@ public final class DeviceRemoteControlDiscreteValuesMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int remoteControlIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
         int count_discreteValueNames = Decoder.decodeUint8(data, offset);
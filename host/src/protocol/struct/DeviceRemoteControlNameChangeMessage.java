@@ -8,7 +8,7 @@ import protocol.ProtocolConstants;
 /**
  * DeviceRemoteControlNameChangeMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_REMOTE_CONTROL_NAME_CHANGE message
@@ -25,7 +25,7 @@ public final class DeviceRemoteControlNameChangeMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_REMOTE_CONTROL_NAME_CHANGE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DeviceRemoteControlNameChange";
 
 
@@ -80,7 +80,7 @@ public final class DeviceRemoteControlNameChangeMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 64;
+    public static final int MAX_PAYLOAD_SIZE = 34;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -92,12 +92,6 @@ public final class DeviceRemoteControlNameChangeMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, remoteControlIndex);
         offset += Encoder.encodeString(buffer, offset, parameterName);
 
@@ -111,7 +105,7 @@ public final class DeviceRemoteControlNameChangeMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 32;
+    private static final int MIN_PAYLOAD_SIZE = 2;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -127,10 +121,6 @@ public final class DeviceRemoteControlNameChangeMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int remoteControlIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
         String parameterName = Decoder.decodeString(data, offset, ProtocolConstants.STRING_MAX_LENGTH);
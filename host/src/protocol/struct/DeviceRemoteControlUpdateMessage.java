@@ -9,7 +9,7 @@ import protocol.ParameterType;
 /**
  * DeviceRemoteControlUpdateMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_REMOTE_CONTROL_UPDATE message
@@ -26,7 +26,7 @@ public final class DeviceRemoteControlUpdateMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_REMOTE_CONTROL_UPDATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DeviceRemoteControlUpdate";
 
 
@@ -189,7 +189,7 @@ public final class DeviceRemoteControlUpdateMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 111;
+    public static final int MAX_PAYLOAD_SIZE = 85;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -201,12 +201,6 @@ public final class DeviceRemoteControlUpdateMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, remoteControlIndex);
         offset += Encoder.encodeString(buffer, offset, parameterName);
         offset += Encoder.encodeFloat32(buffer, offset, parameterValue);
@@ -229,7 +223,7 @@ public final class DeviceRemoteControlUpdateMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 47;
+    private static final int MIN_PAYLOAD_SIZE = 21;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -245,10 +239,6 @@ public final class DeviceRemoteControlUpdateMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int remoteControlIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
         String parameterName = Decoder.decodeString(data, offset, ProtocolConstants.STRING_MAX_LENGTH);
@@ -8,7 +8,7 @@ import protocol.ProtocolConstants;
 /**
  * DeviceRemoteControlsBatchMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_REMOTE_CONTROLS_BATCH message
@@ -25,7 +25,7 @@ public final class DeviceRemoteControlsBatchMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.DEVICE_REMOTE_CONTROLS_BATCH;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "DeviceRemoteControlsBatch";
 
 
@@ -37,6 +37,7 @@ public final class DeviceRemoteControlsBatchMessage {
     private final int dirtyMask;
     private final int echoMask;
     private final int hasAutomationMask;
+    private final int modulatedMask;
     private final float[] values;
     private final float[] modulatedValues;
     private final String[] displayValues;
@@ -52,15 +53,17 @@ public final class DeviceRemoteControlsBatchMessage {
      * @param dirtyMask The dirtyMask value
      * @param echoMask The echoMask value
      * @param hasAutomationMask The hasAutomationMask value
+     * @param modulatedMask The modulatedMask value
      * @param values The values value
      * @param modulatedValues The modulatedValues value
      * @param displayValues The displayValues value
      */
-    public DeviceRemoteControlsBatchMessage(int sequenceNumber, int dirtyMask, int echoMask, int hasAutomationMask, float[] values, float[] modulatedValues, String[] displayValues) {
+    public DeviceRemoteControlsBatchMessage(int sequenceNumber, int dirtyMask, int echoMask, int hasAutomationMask, int modulatedMask, float[] values, float[] modulatedValues, String[] displayValues) {
         this.sequenceNumber = sequenceNumber;
         this.dirtyMask = dirtyMask;
         this.echoMask = echoMask;
         this.hasAutomationMask = hasAutomationMask;
+        this.modulatedMask = modulatedMask;
         this.values = values;
         this.modulatedValues = modulatedValues;
         this.displayValues = displayValues;
@@ -106,6 +109,15 @@ public final class DeviceRemoteControlsBatchMessage {
         return hasAutomationMask;
     }
 
+    /**
+     * Get the modulatedMask value
+     *
+     * @return modulatedMask
+     */
+    public int getModulatedMask() {
+        return modulatedMask;
+    }
+
     /**
      * Get the values value
      *
@@ -140,7 +152,7 @@ public final class DeviceRemoteControlsBatchMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 313;
+    public static final int MAX_PAYLOAD_SIZE = 288;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -152,16 +164,11 @@ public final class DeviceRemoteControlsBatchMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, sequenceNumber);
         offset += Encoder.encodeUint8(buffer, offset, dirtyMask);
         offset += Encoder.encodeUint8(buffer, offset, echoMask);
         offset += Encoder.encodeUint8(buffer, offset, hasAutomationMask);
+        offset += Encoder.encodeUint8(buffer, offset, modulatedMask);
         offset += Encoder.encodeUint8(buffer, offset, values.length);
 
         for (float item : values) {
@@ -191,7 +198,7 @@ public final class DeviceRemoteControlsBatchMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 33;
+    private static final int MIN_PAYLOAD_SIZE = 8;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -207,10 +214,6 @@ public final class DeviceRemoteControlsBatchMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int sequenceNumber = Decoder.decodeUint8(data, offset);
         offset += 1;
         int dirtyMask = Decoder.decodeUint8(data, offset);
@@ -219,6 +222,8 @@ public final class DeviceRemoteControlsBatchMessage {
         offset += 1;
         int hasAutomationMask = Decoder.decodeUint8(data, offset);
         offset += 1;
+        int modulatedMask = Decoder.decodeUint8(data, offset);
+        offset += 1;
         int count_values = Decoder.decodeUint8(data, offset);
         offset += 1;
 
@@ -247,7 +252,7 @@ public final class DeviceRemoteControlsBatchMessage {
         }
 
 
-        return new DeviceRemoteControlsBatchMessage(sequenceNumber, dirtyMask, echoMask, hasAutomationMask, values, modulatedValues, displayValues);
+        return new DeviceRemoteControlsBatchMessage(sequenceNumber, dirtyMask, echoMask, hasAutomationMask, modulatedMask, values, modulatedValues, displayValues);
     }
 
 }  // class Message
@@ -0,0 +1,146 @@
+package protocol.struct;
+
+import protocol.MessageID;
+import protocol.Encoder;
+import protocol.Decoder;
+
+/**
+ * FlowCreditMessage - Auto-generated Protocol Message
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ * Generated from: types.yaml
+ *
+ * Description: FLOW_CREDIT message
+ *
+ * This class is immutable and uses Encoder for encode/decode operations.
+ * All encoding is 8-bit binary (Binary).
+ */
+public final class FlowCreditMessage {
+
+
+    // ============================================================================
+    // Auto-detected MessageID for protocol.send()
+    // ============================================================================
+
+    public static final MessageID MESSAGE_ID = MessageID.FLOW_CREDIT;
+
+    // Message name for logging (framed by the protocol layer, not the codec)
+    public static final String MESSAGE_NAME = "FlowCredit";
+
+
+    // ============================================================================
+    // Fields
+    // ============================================================================
+
+    private final int receivedBytes;
+    private final int windowBytes;
+    private final int batchLosses;
+
+    // ============================================================================
+    // Constructor
+    // ============================================================================
+
+    /**
+     * Construct a new FlowCreditMessage
+     *
+     * @param receivedBytes The receivedBytes value
+     * @param windowBytes The windowBytes value
+     * @param batchLosses The batchLosses value
+     */
+    public FlowCreditMessage(int receivedBytes, int windowBytes, int batchLosses) {
+        this.receivedBytes = receivedBytes;
+        this.windowBytes = windowBytes;
+        this.batchLosses = batchLosses;
+    }
+
+    // ============================================================================
+    // Getters
+    // ============================================================================
+
+    /**
+     * Get the receivedBytes value
+     *
+     * @return receivedBytes
+     */
+    public int getReceivedBytes() {
+        return receivedBytes;
+    }
+
+    /**
+     * Get the windowBytes value
+     *
+     * @return windowBytes
+     */
+    public int getWindowBytes() {
+        return windowBytes;
+    }
+
+    /**
+     * Get the batchLosses value
+     *
+     * @return batchLosses
+     */
+    public int getBatchLosses() {
+        return batchLosses;
+    }
+
+    // ============================================================================
+    // Encoding
+    // ============================================================================
+
+    /**
+     * Maximum payload size in bytes (8-bit binary)
+     */
+    public static final int MAX_PAYLOAD_SIZE = 5;
+
+    /**
+     * Encode message directly into provided buffer (zero allocation)
+     *
+     * @param buffer Output buffer (must have enough space)
+     * @param startOffset Starting position in buffer
+     * @return Number of bytes written
+     */
+    public int encode(byte[] buffer, int startOffset) {
+        int offset = startOffset;
+
+        offset += Encoder.encodeUint16(buffer, offset, receivedBytes);
+        offset += Encoder.encodeUint16(buffer, offset, windowBytes);
+        offset += Encoder.encodeUint8(buffer, offset, batchLosses);
+
+        return offset - startOffset;
+    }
+
+    // ============================================================================
+    // Decoding
+    // ============================================================================
+
+    /**
+     * Minimum payload size in bytes (with empty strings)
+     */
+    private static final int MIN_PAYLOAD_SIZE = 5;
+
+    /**
+     * Decode message from MIDI-safe bytes
+     *
+     * @param data Input buffer with encoded data
+     * @return Decoded FlowCreditMessage instance
+     * @throws IllegalArgumentException if data is invalid or insufficient
+     */
+    public static FlowCreditMessage decode(byte[] data) {
+        if (data.length < MIN_PAYLOAD_SIZE) {
+            throw new IllegalArgumentException("Insufficient data for FlowCreditMessage decode");
+        }
+
+        int offset = 0;
+
+        int receivedBytes = Decoder.decodeUint16(data, offset);
+        offset += 2;
+        int windowBytes = Decoder.decodeUint16(data, offset);
+        offset += 2;
+        int batchLosses = Decoder.decodeUint8(data, offset);
+        offset += 1;
+
+        return new FlowCreditMessage(receivedBytes, windowBytes, batchLosses);
+    }
+
+}  // class Message
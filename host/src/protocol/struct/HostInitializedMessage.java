@@ -7,7 +7,7 @@ import protocol.Decoder;
 /**
  * HostInitializedMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: HOST_INITIALIZED message
@@ -24,7 +24,7 @@ public final class HostInitializedMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.HOST_INITIALIZED;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "HostInitialized";
 
 
@@ -33,6 +33,7 @@ public final class HostInitializedMessage {
     // ============================================================================
 
     private final boolean isHostActive;
+    private final boolean compactFrames;
 
     // ============================================================================
     // Constructor
@@ -42,9 +43,11 @@ public final class HostInitializedMessage {
      * Construct a new HostInitializedMessage
      *
      * @param isHostActive The isHostActive value
+     * @param compactFrames The compactFrames value
      */
-    public HostInitializedMessage(boolean isHostActive) {
+    public HostInitializedMessage(boolean isHostActive, boolean compactFrames) {
         this.isHostActive = isHostActive;
+        this.compactFrames = compactFrames;
     }
 
     // ============================================================================
@@ -60,6 +63,15 @@ public final class HostInitializedMessage {
         return isHostActive;
     }
 
+    /**
+     * Get the compactFrames value
+     *
+     * @return compactFrames
+     */
+    public boolean getCompactFrames() {
+        return compactFrames;
+    }
+
     // ============================================================================
     // Encoding
     // ============================================================================
@@ -67,7 +79,7 @@ public final class HostInitializedMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 17;
+    public static final int MAX_PAYLOAD_SIZE = 2;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -79,13 +91,8 @@ public final class HostInitializedMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeBool(buffer, offset, isHostActive);
+        offset += Encoder.encodeBool(buffer, offset, compactFrames);
 
         return offset - startOffset;
     }
@@ -97,7 +104,7 @@ public final class HostInitializedMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 17;
+    private static final int MIN_PAYLOAD_SIZE = 2;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -113,14 +120,12 @@ public final class HostInitializedMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         boolean isHostActive = Decoder.decodeBool(data, offset);
         offset += 1;
+        boolean compactFrames = Decoder.decodeBool(data, offset);
+        offset += 1;
 
-        return new HostInitializedMessage(isHostActive);
+        return new HostInitializedMessage(isHostActive, compactFrames);
     }
 
 }  // class Message
@@ -9,7 +9,7 @@ import protocol.ParameterType;
 /**
  * LastClickedUpdateMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: LAST_CLICKED_UPDATE message
@@ -26,7 +26,7 @@ public final class LastClickedUpdateMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.LAST_CLICKED_UPDATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "LastClickedUpdate";
 
 
@@ -153,7 +153,7 @@ public final class LastClickedUpdateMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 97;
+    public static final int MAX_PAYLOAD_SIZE = 79;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -165,12 +165,6 @@ public final class LastClickedUpdateMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeString(buffer, offset, parameterName);
         offset += Encoder.encodeFloat32(buffer, offset, parameterValue);
         offset += Encoder.encodeString(buffer, offset, displayValue);
@@ -190,7 +184,7 @@ public final class LastClickedUpdateMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 33;
+    private static final int MIN_PAYLOAD_SIZE = 15;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -206,10 +200,6 @@ public final class LastClickedUpdateMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         String parameterName = Decoder.decodeString(data, offset, ProtocolConstants.STRING_MAX_LENGTH);
         offset += 1 + parameterName.length();
         float parameterValue = Decoder.decodeFloat32(data, offset);
@@ -8,7 +8,7 @@ import protocol.ProtocolConstants;
 /**
  * LastClickedValueStateMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: LAST_CLICKED_VALUE_STATE message
@@ -25,7 +25,7 @@ public final class LastClickedValueStateMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.LAST_CLICKED_VALUE_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "LastClickedValueState";
 
 
@@ -80,7 +80,7 @@ public final class LastClickedValueStateMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 59;
+    public static final int MAX_PAYLOAD_SIZE = 37;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -92,12 +92,6 @@ public final class LastClickedValueStateMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeFloat32(buffer, offset, parameterValue);
         offset += Encoder.encodeString(buffer, offset, displayValue);
 
@@ -111,7 +105,7 @@ public final class LastClickedValueStateMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 27;
+    private static final int MIN_PAYLOAD_SIZE = 5;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -127,10 +121,6 @@ public final class LastClickedValueStateMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         float parameterValue = Decoder.decodeFloat32(data, offset);
         offset += 4;
         String displayValue = Decoder.decodeString(data, offset, ProtocolConstants.STRING_MAX_LENGTH);
@@ -8,7 +8,7 @@ import protocol.ProtocolConstants;
 /**
  * RemoteControlValueStateMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: REMOTE_CONTROL_VALUE_STATE message
@@ -25,7 +25,7 @@ public final class RemoteControlValueStateMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.REMOTE_CONTROL_VALUE_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "RemoteControlValueState";
 
 
@@ -92,7 +92,7 @@ public final class RemoteControlValueStateMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 62;
+    public static final int MAX_PAYLOAD_SIZE = 38;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -104,12 +104,6 @@ public final class RemoteControlValueStateMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, remoteControlIndex);
         offset += Encoder.encodeFloat32(buffer, offset, parameterValue);
         offset += Encoder.encodeString(buffer, offset, displayValue);
@@ -124,7 +118,7 @@ public final class RemoteControlValueStateMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 30;
+    private static final int MIN_PAYLOAD_SIZE = 6;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -140,10 +134,6 @@ public final class RemoteControlValueStateMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int remoteControlIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
         float parameterValue = Decoder.decodeFloat32(data, offset);
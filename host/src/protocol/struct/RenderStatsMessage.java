@@ -0,0 +1,146 @@
+package protocol.struct;
+
+import protocol.MessageID;
+import protocol.Encoder;
+import protocol.Decoder;
+
+/**
+ * RenderStatsMessage - Auto-generated Protocol Message
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ * Generated from: types.yaml
+ *
+ * Description: RENDER_STATS message
+ *
+ * This class is immutable and uses Encoder for encode/decode operations.
+ * All encoding is 8-bit binary (Binary).
+ */
+public final class RenderStatsMessage {
+
+
+    // ============================================================================
+    // Auto-detected MessageID for protocol.send()
+    // ============================================================================
+
+    public static final MessageID MESSAGE_ID = MessageID.RENDER_STATS;
+
+    // Message name for logging (framed by the protocol layer, not the codec)
+    public static final String MESSAGE_NAME = "RenderStats";
+
+
+    // ============================================================================
+    // Fields
+    // ============================================================================
+
+    private final int renderHz;
+    private final int frameTimeUs;
+    private final int headroomPercent;
+
+    // ============================================================================
+    // Constructor
+    // ============================================================================
+
+    /**
+     * Construct a new RenderStatsMessage
+     *
+     * @param renderHz The renderHz value
+     * @param frameTimeUs The frameTimeUs value
+     * @param headroomPercent The headroomPercent value
+     */
+    public RenderStatsMessage(int renderHz, int frameTimeUs, int headroomPercent) {
+        this.renderHz = renderHz;
+        this.frameTimeUs = frameTimeUs;
+        this.headroomPercent = headroomPercent;
+    }
+
+    // ============================================================================
+    // Getters
+    // ============================================================================
+
+    /**
+     * Get the renderHz value
+     *
+     * @return renderHz
+     */
+    public int getRenderHz() {
+        return renderHz;
+    }
+
+    /**
+     * Get the frameTimeUs value
+     *
+     * @return frameTimeUs
+     */
+    public int getFrameTimeUs() {
+        return frameTimeUs;
+    }
+
+    /**
+     * Get the headroomPercent value
+     *
+     * @return headroomPercent
+     */
+    public int getHeadroomPercent() {
+        return headroomPercent;
+    }
+
+    // ============================================================================
+    // Encoding
+    // ============================================================================
+
+    /**
+     * Maximum payload size in bytes (8-bit binary)
+     */
+    public static final int MAX_PAYLOAD_SIZE = 4;
+
+    /**
+     * Encode message directly into provided buffer (zero allocation)
+     *
+     * @param buffer Output buffer (must have enough space)
+     * @param startOffset Starting position in buffer
+     * @return Number of bytes written
+     */
+    public int encode(byte[] buffer, int startOffset) {
+        int offset = startOffset;
+
+        offset += Encoder.encodeUint8(buffer, offset, renderHz);
+        offset += Encoder.encodeUint16(buffer, offset, frameTimeUs);
+        offset += Encoder.encodeUint8(buffer, offset, headroomPercent);
+
+        return offset - startOffset;
+    }
+
+    // ============================================================================
+    // Decoding
+    // ============================================================================
+
+    /**
+     * Minimum payload size in bytes (with empty strings)
+     */
+    private static final int MIN_PAYLOAD_SIZE = 4;
+
+    /**
+     * Decode message from MIDI-safe bytes
+     *
+     * @param data Input buffer with encoded data
+     * @return Decoded RenderStatsMessage instance
+     * @throws IllegalArgumentException if data is invalid or insufficient
+     */
+    public static RenderStatsMessage decode(byte[] data) {
+        if (data.length < MIN_PAYLOAD_SIZE) {
+            throw new IllegalArgumentException("Insufficient data for RenderStatsMessage decode");
+        }
+
+        int offset = 0;
+
+        int renderHz = Decoder.decodeUint8(data, offset);
+        offset += 1;
+        int frameTimeUs = Decoder.decodeUint16(data, offset);
+        offset += 2;
+        int headroomPercent = Decoder.decodeUint8(data, offset);
+        offset += 1;
+
+        return new RenderStatsMessage(renderHz, frameTimeUs, headroomPercent);
+    }
+
+}  // class Message
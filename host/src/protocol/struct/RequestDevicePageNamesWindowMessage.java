@@ -7,7 +7,7 @@ import protocol.Decoder;
 /**
  * RequestDevicePageNamesWindowMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: REQUEST_DEVICE_PAGE_NAMES_WINDOW message
@@ -24,7 +24,7 @@ public final class RequestDevicePageNamesWindowMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.REQUEST_DEVICE_PAGE_NAMES_WINDOW;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "RequestDevicePageNamesWindow";
 
 
@@ -33,6 +33,7 @@ public final class RequestDevicePageNamesWindowMessage {
     // ============================================================================
 
     private final int pageStartIndex;
+    private final int windowSize;
 
     // ============================================================================
     // Constructor
@@ -42,9 +43,11 @@ public final class RequestDevicePageNamesWindowMessage {
      * Construct a new RequestDevicePageNamesWindowMessage
      *
      * @param pageStartIndex The pageStartIndex value
+     * @param windowSize The windowSize value
      */
-    public RequestDevicePageNamesWindowMessage(int pageStartIndex) {
+    public RequestDevicePageNamesWindowMessage(int pageStartIndex, int windowSize) {
         this.pageStartIndex = pageStartIndex;
+        this.windowSize = windowSize;
     }
 
     // ============================================================================
@@ -60,6 +63,15 @@ public final class RequestDevicePageNamesWindowMessage {
         return pageStartIndex;
     }
 
+    /**
+     * Get the windowSize value
+     *
+     * @return windowSize
+     */
+    public int getWindowSize() {
+        return windowSize;
+    }
+
     // ============================================================================
     // Encoding
     // ============================================================================
@@ -67,7 +79,7 @@ public final class RequestDevicePageNamesWindowMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 30;
+    public static final int MAX_PAYLOAD_SIZE = 2;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -79,13 +91,8 @@ public final class RequestDevicePageNamesWindowMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, pageStartIndex);
+        offset += Encoder.encodeUint8(buffer, offset, windowSize);
 
         return offset - startOffset;
     }
@@ -97,7 +104,7 @@ public final class RequestDevicePageNamesWindowMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 30;
+    private static final int MIN_PAYLOAD_SIZE = 2;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -113,14 +120,12 @@ public final class RequestDevicePageNamesWindowMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int pageStartIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
+        int windowSize = Decoder.decodeUint8(data, offset);
+        offset += 1;
 
-        return new RequestDevicePageNamesWindowMessage(pageStartIndex);
+        return new RequestDevicePageNamesWindowMessage(pageStartIndex, windowSize);
     }
 
 }  // class Message
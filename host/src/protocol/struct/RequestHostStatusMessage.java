@@ -1,12 +1,13 @@
 package protocol.struct;
 
 import protocol.MessageID;
+import protocol.Encoder;
 import protocol.Decoder;
 
 /**
  * RequestHostStatusMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: REQUEST_HOST_STATUS message
@@ -23,7 +24,7 @@ public final class RequestHostStatusMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.REQUEST_HOST_STATUS;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "RequestHostStatus";
 
 
@@ -31,6 +32,7 @@ public final class RequestHostStatusMessage {
     // Fields
     // ============================================================================
 
+    private final boolean compactFrames;
 
     // ============================================================================
     // Constructor
@@ -39,14 +41,25 @@ public final class RequestHostStatusMessage {
     /**
      * Construct a new RequestHostStatusMessage
      *
+     * @param compactFrames The compactFrames value
      */
-    public RequestHostStatusMessage() {
+    public RequestHostStatusMessage(boolean compactFrames) {
+        this.compactFrames = compactFrames;
     }
 
     // ============================================================================
     // Getters
     // ============================================================================
 
+    /**
+     * Get the compactFrames value
+     *
+     * @return compactFrames
+     */
+    public boolean getCompactFrames() {
+        return compactFrames;
+    }
+
     // ============================================================================
     // Encoding
     // ============================================================================
@@ -54,7 +67,7 @@ public final class RequestHostStatusMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 18;
+    public static final int MAX_PAYLOAD_SIZE = 1;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -66,11 +79,7 @@ public final class RequestHostStatusMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
+        offset += Encoder.encodeBool(buffer, offset, compactFrames);
 
         return offset - startOffset;
     }
@@ -80,25 +89,28 @@ public final class RequestHostStatusMessage {
     // ============================================================================
 
     /**
-     * Minimum payload size in bytes (name prefix only)
+     * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 18;
+    private static final int MIN_PAYLOAD_SIZE = 1;
 
     /**
-     * Decode message from bytes (no fields, with name prefix)
-     * @param data Input buffer
-     * @return New RequestHostStatusMessage instance
+     * Decode message from MIDI-safe bytes
+     *
+     * @param data Input buffer with encoded data
+     * @return Decoded RequestHostStatusMessage instance
      * @throws IllegalArgumentException if data is invalid or insufficient
      */
     public static RequestHostStatusMessage decode(byte[] data) {
         if (data.length < MIN_PAYLOAD_SIZE) {
             throw new IllegalArgumentException("Insufficient data for RequestHostStatusMessage decode");
         }
-        // Skip MESSAGE_NAME prefix
+
         int offset = 0;
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-        return new RequestHostStatusMessage();
+
+        boolean compactFrames = Decoder.decodeBool(data, offset);
+        offset += 1;
+
+        return new RequestHostStatusMessage(compactFrames);
     }
 
 }  // class Message
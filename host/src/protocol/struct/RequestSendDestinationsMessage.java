@@ -6,7 +6,7 @@ import protocol.Decoder;
 /**
  * RequestSendDestinationsMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: REQUEST_SEND_DESTINATIONS message
@@ -23,7 +23,7 @@ public final class RequestSendDestinationsMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.REQUEST_SEND_DESTINATIONS;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "RequestSendDestinations";
 
 
@@ -54,7 +54,7 @@ public final class RequestSendDestinationsMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 24;
+    public static final int MAX_PAYLOAD_SIZE = 0;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -66,12 +66,6 @@ public final class RequestSendDestinationsMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         return offset - startOffset;
     }
 
@@ -80,12 +74,12 @@ public final class RequestSendDestinationsMessage {
     // ============================================================================
 
     /**
-     * Minimum payload size in bytes (name prefix only)
+     * Minimum payload size in bytes (no fields)
      */
-    private static final int MIN_PAYLOAD_SIZE = 24;
+    private static final int MIN_PAYLOAD_SIZE = 0;
 
     /**
-     * Decode message from bytes (no fields, with name prefix)
+     * Decode message from bytes (no fields)
      * @param data Input buffer
      * @return New RequestSendDestinationsMessage instance
      * @throws IllegalArgumentException if data is invalid or insufficient
@@ -94,10 +88,6 @@ public final class RequestSendDestinationsMessage {
         if (data.length < MIN_PAYLOAD_SIZE) {
             throw new IllegalArgumentException("Insufficient data for RequestSendDestinationsMessage decode");
         }
-        // Skip MESSAGE_NAME prefix
-        int offset = 0;
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
         return new RequestSendDestinationsMessage();
     }
 
@@ -8,7 +8,7 @@ import protocol.ProtocolConstants;
 /**
  * SendDestinationsListMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: SEND_DESTINATIONS_LIST message
@@ -25,7 +25,7 @@ public final class SendDestinationsListMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.SEND_DESTINATIONS_LIST;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "SendDestinationsList";
 
     // ============================================================================
@@ -102,7 +102,7 @@ public final class SendDestinationsListMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 295;
+    public static final int MAX_PAYLOAD_SIZE = 274;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -114,12 +114,6 @@ public final class SendDestinationsListMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, sendCount);
         offset += Encoder.encodeUint8(buffer, offset, sendDestinations.length);
 
@@ -139,7 +133,7 @@ public final class SendDestinationsListMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 23;
+    private static final int MIN_PAYLOAD_SIZE = 2;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -155,10 +149,6 @@ public final class SendDestinationsListMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int sendCount = Decoder.decodeUint8(data, offset);
         offset += 1;
         int count_sendDestinations = Decoder.decodeUint8(data, offset);
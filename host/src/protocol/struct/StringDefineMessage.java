@@ -0,0 +1,132 @@
+package protocol.struct;
+
+import protocol.MessageID;
+import protocol.Encoder;
+import protocol.Decoder;
+import protocol.ProtocolConstants;
+
+/**
+ * StringDefineMessage - Auto-generated Protocol Message
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ * Generated from: types.yaml
+ *
+ * Description: STRING_DEFINE message
+ *
+ * This class is immutable and uses Encoder for encode/decode operations.
+ * All encoding is 8-bit binary (Binary).
+ */
+public final class StringDefineMessage {
+
+
+    // ============================================================================
+    // Auto-detected MessageID for protocol.send()
+    // ============================================================================
+
+    public static final MessageID MESSAGE_ID = MessageID.STRING_DEFINE;
+
+    // Message name for logging (framed by the protocol layer, not the codec)
+    public static final String MESSAGE_NAME = "StringDefine";
+
+
+    // ============================================================================
+    // Fields
+    // ============================================================================
+
+    private final int stringId;
+    private final String text;
+
+    // ============================================================================
+    // Constructor
+    // ============================================================================
+
+    /**
+     * Construct a new StringDefineMessage
+     *
+     * @param stringId The stringId value
+     * @param text The text value
+     */
+    public StringDefineMessage(int stringId, String text) {
+        this.stringId = stringId;
+        this.text = text;
+    }
+
+    // ============================================================================
+    // Getters
+    // ============================================================================
+
+    /**
+     * Get the stringId value
+     *
+     * @return stringId
+     */
+    public int getStringId() {
+        return stringId;
+    }
+
+    /**
+     * Get the text value
+     *
+     * @return text
+     */
+    public String getText() {
+        return text;
+    }
+
+    // ============================================================================
+    // Encoding
+    // ============================================================================
+
+    /**
+     * Maximum payload size in bytes (8-bit binary)
+     */
+    public static final int MAX_PAYLOAD_SIZE = 35;
+
+    /**
+     * Encode message directly into provided buffer (zero allocation)
+     *
+     * @param buffer Output buffer (must have enough space)
+     * @param startOffset Starting position in buffer
+     * @return Number of bytes written
+     */
+    public int encode(byte[] buffer, int startOffset) {
+        int offset = startOffset;
+
+        offset += Encoder.encodeUint16(buffer, offset, stringId);
+        offset += Encoder.encodeString(buffer, offset, text);
+
+        return offset - startOffset;
+    }
+
+    // ============================================================================
+    // Decoding
+    // ============================================================================
+
+    /**
+     * Minimum payload size in bytes (with empty strings)
+     */
+    private static final int MIN_PAYLOAD_SIZE = 3;
+
+    /**
+     * Decode message from MIDI-safe bytes
+     *
+     * @param data Input buffer with encoded data
+     * @return Decoded StringDefineMessage instance
+     * @throws IllegalArgumentException if data is invalid or insufficient
+     */
+    public static StringDefineMessage decode(byte[] data) {
+        if (data.length < MIN_PAYLOAD_SIZE) {
+            throw new IllegalArgumentException("Insufficient data for StringDefineMessage decode");
+        }
+
+        int offset = 0;
+
+        int stringId = Decoder.decodeUint16(data, offset);
+        offset += 2;
+        String text = Decoder.decodeString(data, offset, ProtocolConstants.STRING_MAX_LENGTH);
+        offset += 1 + text.length();
+
+        return new StringDefineMessage(stringId, text);
+    }
+
+}  // class Message
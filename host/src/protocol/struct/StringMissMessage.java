@@ -0,0 +1,116 @@
+package protocol.struct;
+
+import protocol.MessageID;
+import protocol.Encoder;
+import protocol.Decoder;
+
+/**
+ * StringMissMessage - Auto-generated Protocol Message
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ * Generated from: types.yaml
+ *
+ * Description: STRING_MISS message
+ *
+ * This class is immutable and uses Encoder for encode/decode operations.
+ * All encoding is 8-bit binary (Binary).
+ */
+public final class StringMissMessage {
+
+
+    // ============================================================================
+    // Auto-detected MessageID for protocol.send()
+    // ============================================================================
+
+    public static final MessageID MESSAGE_ID = MessageID.STRING_MISS;
+
+    // Message name for logging (framed by the protocol layer, not the codec)
+    public static final String MESSAGE_NAME = "StringMiss";
+
+
+    // ============================================================================
+    // Fields
+    // ============================================================================
+
+    private final int stringId;
+
+    // ============================================================================
+    // Constructor
+    // ============================================================================
+
+    /**
+     * Construct a new StringMissMessage
+     *
+     * @param stringId The stringId value
+     */
+    public StringMissMessage(int stringId) {
+        this.stringId = stringId;
+    }
+
+    // ============================================================================
+    // Getters
+    // ============================================================================
+
+    /**
+     * Get the stringId value
+     *
+     * @return stringId
+     */
+    public int getStringId() {
+        return stringId;
+    }
+
+    // ============================================================================
+    // Encoding
+    // ============================================================================
+
+    /**
+     * Maximum payload size in bytes (8-bit binary)
+     */
+    public static final int MAX_PAYLOAD_SIZE = 2;
+
+    /**
+     * Encode message directly into provided buffer (zero allocation)
+     *
+     * @param buffer Output buffer (must have enough space)
+     * @param startOffset Starting position in buffer
+     * @return Number of bytes written
+     */
+    public int encode(byte[] buffer, int startOffset) {
+        int offset = startOffset;
+
+        offset += Encoder.encodeUint16(buffer, offset, stringId);
+
+        return offset - startOffset;
+    }
+
+    // ============================================================================
+    // Decoding
+    // ============================================================================
+
+    /**
+     * Minimum payload size in bytes (with empty strings)
+     */
+    private static final int MIN_PAYLOAD_SIZE = 2;
+
+    /**
+     * Decode message from MIDI-safe bytes
+     *
+     * @param data Input buffer with encoded data
+     * @return Decoded StringMissMessage instance
+     * @throws IllegalArgumentException if data is invalid or insufficient
+     */
+    public static StringMissMessage decode(byte[] data) {
+        if (data.length < MIN_PAYLOAD_SIZE) {
+            throw new IllegalArgumentException("Insufficient data for StringMissMessage decode");
+        }
+
+        int offset = 0;
+
+        int stringId = Decoder.decodeUint16(data, offset);
+        offset += 2;
+
+        return new StringMissMessage(stringId);
+    }
+
+}  // class Message
@@ -9,7 +9,7 @@ import protocol.TrackType;
 /**
  * TrackChangeMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRACK_CHANGE message
@@ -26,7 +26,7 @@ public final class TrackChangeMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.TRACK_CHANGE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "TrackChange";
 
 
@@ -213,7 +213,7 @@ public final class TrackChangeMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 130;
+    public static final int MAX_PAYLOAD_SIZE = 118;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -225,12 +225,6 @@ public final class TrackChangeMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeString(buffer, offset, trackName);
         offset += Encoder.encodeUint32(buffer, offset, color);
         offset += Encoder.encodeUint8(buffer, offset, trackIndex);
@@ -255,7 +249,7 @@ public final class TrackChangeMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 34;
+    private static final int MIN_PAYLOAD_SIZE = 22;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -271,10 +265,6 @@ public final class TrackChangeMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         String trackName = Decoder.decodeString(data, offset, ProtocolConstants.STRING_MAX_LENGTH);
         offset += 1 + trackName.length();
         long color = Decoder.decodeUint32(data, offset);
@@ -9,7 +9,7 @@ import protocol.TrackType;
 /**
  * TrackListWindowMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRACK_LIST_WINDOW message
@@ -26,7 +26,7 @@ public final class TrackListWindowMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.TRACK_LIST_WINDOW;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "TrackListWindow";
 
     // ============================================================================
@@ -122,6 +122,7 @@ public final class TrackListWindowMessage {
     private final boolean isNested;
     private final String parentGroupName;
     private final Tracks[] tracks;
+    private final int[] trackNamePrefixes;
 
     // ============================================================================
     // Constructor
@@ -136,14 +137,16 @@ public final class TrackListWindowMessage {
      * @param isNested The isNested value
      * @param parentGroupName The parentGroupName value
      * @param tracks The tracks value
+     * @param trackNamePrefixes The trackNamePrefixes value
      */
-    public TrackListWindowMessage(int trackCount, int trackStartIndex, int trackIndex, boolean isNested, String parentGroupName, Tracks[] tracks) {
+    public TrackListWindowMessage(int trackCount, int trackStartIndex, int trackIndex, boolean isNested, String parentGroupName, Tracks[] tracks, int[] trackNamePrefixes) {
         this.trackCount = trackCount;
         this.trackStartIndex = trackStartIndex;
         this.trackIndex = trackIndex;
         this.isNested = isNested;
         this.parentGroupName = parentGroupName;
         this.tracks = tracks;
+        this.trackNamePrefixes = trackNamePrefixes;
     }
 
     // ============================================================================
@@ -204,6 +207,15 @@ public final class TrackListWindowMessage {
         return tracks;
     }
 
+    /**
+     * Get the trackNamePrefixes value
+     *
+     * @return trackNamePrefixes
+     */
+    public int[] getTrackNamePrefixes() {
+        return trackNamePrefixes;
+    }
+
     // ============================================================================
     // Encoding
     // ============================================================================
@@ -211,7 +223,7 @@ public final class TrackListWindowMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 902;
+    public static final int MAX_PAYLOAD_SIZE = 903;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -223,12 +235,6 @@ public final class TrackListWindowMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, trackCount);
         offset += Encoder.encodeUint8(buffer, offset, trackStartIndex);
         offset += Encoder.encodeUint8(buffer, offset, trackIndex);
@@ -251,6 +257,12 @@ public final class TrackListWindowMessage {
             offset += Encoder.encodeFloat32(buffer, offset, item.getPan());
         }
 
+        offset += Encoder.encodeUint8(buffer, offset, trackNamePrefixes.length);
+
+        for (int item : trackNamePrefixes) {
+            offset += Encoder.encodeUint8(buffer, offset, item);
+        }
+
 
         return offset - startOffset;
     }
@@ -262,7 +274,7 @@ public final class TrackListWindowMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 22;
+    private static final int MIN_PAYLOAD_SIZE = 7;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -278,10 +290,6 @@ public final class TrackListWindowMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int trackCount = Decoder.decodeUint8(data, offset);
         offset += 1;
         int trackStartIndex = Decoder.decodeUint8(data, offset);
@@ -324,8 +332,17 @@ public final class TrackListWindowMessage {
             tracks[i] = new Tracks(item_trackIndex, item_trackName, item_color, item_isActivated, item_isMute, item_isSolo, item_isMutedBySolo, item_isArm, item_isGroup, item_trackType, item_volume, item_pan);
         }
 
+        int count_trackNamePrefixes = Decoder.decodeUint8(data, offset);
+        offset += 1;
+
+        int[] trackNamePrefixes = new int[count_trackNamePrefixes];
+        for (int i = 0; i < count_trackNamePrefixes; i++) {
+            trackNamePrefixes[i] = Decoder.decodeUint8(data, offset);
+            offset += 1;
+        }
+
 
-        return new TrackListWindowMessage(trackCount, trackStartIndex, trackIndex, isNested, parentGroupName, tracks);
+        return new TrackListWindowMessage(trackCount, trackStartIndex, trackIndex, isNested, parentGroupName, tracks, trackNamePrefixes);
     }
 
 }  // class Message
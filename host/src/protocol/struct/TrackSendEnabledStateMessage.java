@@ -7,7 +7,7 @@ import protocol.Decoder;
 /**
  * TrackSendEnabledStateMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRACK_SEND_ENABLED_STATE message
@@ -24,7 +24,7 @@ public final class TrackSendEnabledStateMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.TRACK_SEND_ENABLED_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "TrackSendEnabledState";
 
 
@@ -91,7 +91,7 @@ public final class TrackSendEnabledStateMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 25;
+    public static final int MAX_PAYLOAD_SIZE = 3;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -103,12 +103,6 @@ public final class TrackSendEnabledStateMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, trackIndex);
         offset += Encoder.encodeUint8(buffer, offset, sendIndex);
         offset += Encoder.encodeBool(buffer, offset, sendIsEnabled);
@@ -123,7 +117,7 @@ public final class TrackSendEnabledStateMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 25;
+    private static final int MIN_PAYLOAD_SIZE = 3;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -139,10 +133,6 @@ public final class TrackSendEnabledStateMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int trackIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
         int sendIndex = Decoder.decodeUint8(data, offset);
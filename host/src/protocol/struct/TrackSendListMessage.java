@@ -8,7 +8,7 @@ import protocol.ProtocolConstants;
 /**
  * TrackSendListMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRACK_SEND_LIST message
@@ -25,7 +25,7 @@ public final class TrackSendListMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.TRACK_SEND_LIST;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "TrackSendList";
 
     // ============================================================================
@@ -150,7 +150,7 @@ public final class TrackSendListMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 897;
+    public static final int MAX_PAYLOAD_SIZE = 883;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -162,12 +162,6 @@ public final class TrackSendListMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, trackIndex);
         offset += Encoder.encodeUint8(buffer, offset, sendCount);
         offset += Encoder.encodeUint8(buffer, offset, sends.length);
@@ -194,7 +188,7 @@ public final class TrackSendListMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 17;
+    private static final int MIN_PAYLOAD_SIZE = 3;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -210,10 +204,6 @@ public final class TrackSendListMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int trackIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
         int sendCount = Decoder.decodeUint8(data, offset);
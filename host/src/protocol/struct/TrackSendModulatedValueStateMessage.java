@@ -7,7 +7,7 @@ import protocol.Decoder;
 /**
  * TrackSendModulatedValueStateMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRACK_SEND_MODULATED_VALUE_STATE message
@@ -24,7 +24,7 @@ public final class TrackSendModulatedValueStateMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.TRACK_SEND_MODULATED_VALUE_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "TrackSendModulatedValueState";
 
 
@@ -91,7 +91,7 @@ public final class TrackSendModulatedValueStateMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 35;
+    public static final int MAX_PAYLOAD_SIZE = 6;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -103,12 +103,6 @@ public final class TrackSendModulatedValueStateMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeUint8(buffer, offset, trackIndex);
         offset += Encoder.encodeUint8(buffer, offset, sendIndex);
         offset += Encoder.encodeFloat32(buffer, offset, modulatedValue);
@@ -123,7 +117,7 @@ public final class TrackSendModulatedValueStateMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 35;
+    private static final int MIN_PAYLOAD_SIZE = 6;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -139,10 +133,6 @@ public final class TrackSendModulatedValueStateMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         int trackIndex = Decoder.decodeUint8(data, offset);
         offset += 1;
         int sendIndex = Decoder.decodeUint8(data, offset);
@@ -7,7 +7,7 @@ import protocol.Decoder;
 /**
  * TransportClipLauncherAutomationWriteEnabledStateMessage - Auto-generated Protocol Message
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRANSPORT_CLIP_LAUNCHER_AUTOMATION_WRITE_ENABLED_STATE message
@@ -24,7 +24,7 @@ public final class TransportClipLauncherAutomationWriteEnabledStateMessage {
 
     public static final MessageID MESSAGE_ID = MessageID.TRANSPORT_CLIP_LAUNCHER_AUTOMATION_WRITE_ENABLED_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     public static final String MESSAGE_NAME = "TransportClipLauncherAutomationWriteEnabledState";
 
 
@@ -67,7 +67,7 @@ public final class TransportClipLauncherAutomationWriteEnabledStateMessage {
     /**
      * Maximum payload size in bytes (8-bit binary)
      */
-    public static final int MAX_PAYLOAD_SIZE = 50;
+    public static final int MAX_PAYLOAD_SIZE = 1;
 
     /**
      * Encode message directly into provided buffer (zero allocation)
@@ -79,12 +79,6 @@ public final class TransportClipLauncherAutomationWriteEnabledStateMessage {
     public int encode(byte[] buffer, int startOffset) {
         int offset = startOffset;
 
-        // Encode MESSAGE_NAME prefix
-        buffer[offset++] = (byte) MESSAGE_NAME.length();
-        for (int i = 0; i < MESSAGE_NAME.length(); i++) {
-            buffer[offset++] = (byte) MESSAGE_NAME.charAt(i);
-        }
-
         offset += Encoder.encodeBool(buffer, offset, isClipLauncherAutomationWriteEnabled);
 
         return offset - startOffset;
@@ -97,7 +91,7 @@ public final class TransportClipLauncherAutomationWriteEnabledStateMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    private static final int MIN_PAYLOAD_SIZE = 50;
+    private static final int MIN_PAYLOAD_SIZE = 1;
 
     /**
      * Decode message from MIDI-safe bytes
@@ -113,10 +107,6 @@ public final class TransportClipLauncherAutomationWriteEnabledStateMessage {
 
         int offset = 0;
 
-        // Skip MESSAGE_NAME prefix
-        int nameLen = Decoder.decodeUint8(data, offset);
-        offset += 1 + nameLen;
-
         boolean isClipLauncherAutomationWriteEnabled = Decoder.decodeBool(data, offset);
         offset += 1;
 
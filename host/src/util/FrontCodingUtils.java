@@ -0,0 +1,65 @@
+package util;
+
+import config.BitwigConfig;
+
+/**
+ * FrontCodingUtils - Shared-prefix coding of windowed name lists
+ *
+ * Names in a window often share long prefixes ("Synth Bus 1", "Synth Bus 2").
+ * Each name is sent as the suffix after the characters it shares with the
+ * previous one, plus a prefix-length array:
+ *
+ *   name[i] = name[i-1].substring(0, prefix[i]) + suffix[i]
+ *
+ * Used by DeviceHost (page names, device list) and TrackHost (track list).
+ * The controller rebuilds the names in its selector handlers, before it
+ * resolves string dictionary references.
+ *
+ * Windows are coded after StringDictionary.ref(), so with the dictionary on
+ * most names are 3-char references that share at most 2 chars: the saving
+ * rarely beats the prefix array and encode() usually returns NONE. Coding
+ * pays off for the names left plain (short, too long, or dictionary off).
+ */
+public final class FrontCodingUtils {
+
+    /** Prefix array of a window sent with whole names */
+    public static final int[] NONE = new int[0];
+
+    private static final int MAX_PREFIX = 255; // uint8 on the wire
+
+    private FrontCodingUtils() {} // Prevent instantiation
+
+    /**
+     * Front code a window of names in place, if it saves bytes.
+     * A non-empty name always keeps at least one character (an empty
+     * name marks the end of a window on the controller).
+     *
+     * @param names Window names, replaced by their suffixes when coded
+     * @return Prefix lengths, or NONE if the names were left whole
+     */
+    public static int[] encode(String[] names) {
+        if (!BitwigConfig.FRONT_CODE_NAME_WINDOWS || names.length < 2) return NONE;
+
+        int[] prefixes = new int[names.length];
+        int shared = 0;
+        for (int i = 1; i < names.length; i++) {
+            prefixes[i] = sharedPrefix(names[i - 1], names[i]);
+            shared += prefixes[i];
+        }
+
+        // One prefix byte per name plus the array count
+        if (shared <= names.length + 1) return NONE;
+
+        for (int i = names.length - 1; i > 0; i--) {
+            names[i] = names[i].substring(prefixes[i]);
+        }
+        return prefixes;
+    }
+
+    private static int sharedPrefix(String previous, String name) {
+        int limit = Math.min(Math.min(previous.length(), name.length() - 1), MAX_PREFIX);
+        int n = 0;
+        while (n < limit && previous.charAt(n) == name.charAt(n)) n++;
+        return n;
+    }
+}
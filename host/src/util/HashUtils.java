@@ -0,0 +1,35 @@
+package util;
+
+/**
+ * HashUtils - 32-bit FNV-1a over names
+ *
+ * Used for the keys of the controller's page name cache
+ * (DEVICE_CHANGE_HEADER deviceIdentity / pageNamesHash). Results are
+ * unsigned 32-bit values in a long; 0 is reserved for "unknown".
+ */
+public final class HashUtils {
+
+    private static final int FNV_OFFSET = 0x811C9DC5;
+    private static final int FNV_PRIME = 0x01000193;
+
+    private HashUtils() {} // Prevent instantiation
+
+    /**
+     * Hash of a list of names (null entries hash as empty). Names are
+     * separated so that {"ab", "c"} and {"a", "bc"} differ.
+     */
+    public static long fnv1a(String... names) {
+        int hash = FNV_OFFSET;
+        if (names == null) return hash & 0xFFFFFFFFL;
+        for (String name : names) {
+            if (name != null) {
+                for (int i = 0; i < name.length(); i++) {
+                    hash = (hash ^ (name.charAt(i) & 0xFFFF)) * FNV_PRIME;
+                }
+            }
+            hash = (hash ^ 0xFF) * FNV_PRIME;  // Separator
+        }
+        long unsigned = hash & 0xFFFFFFFFL;
+        return unsigned != 0 ? unsigned : 1;
+    }
+}
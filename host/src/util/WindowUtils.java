@@ -0,0 +1,36 @@
+package util;
+
+import config.BitwigConfig;
+
+/**
+ * WindowUtils - Sizing of list window answers
+ *
+ * REQUEST_XXX_WINDOW carries the number of items the controller wants
+ * (chosen from its measured link throughput). The answer is split into
+ * XXX_WINDOW messages of up to LIST_WINDOW_SIZE items, the protocol array
+ * size; the controller accumulates them at their start indices.
+ */
+public final class WindowUtils {
+
+    private WindowUtils() {} // Prevent instantiation
+
+    /** Requested windowSize, capped to what the host honours (0 = default size) */
+    public static int clampWindowSize(int requested) {
+        if (requested <= 0) return BitwigConfig.LIST_WINDOW_SIZE;
+        return Math.min(requested, BitwigConfig.MAX_LIST_WINDOW_SIZE);
+    }
+
+    /** Start index clamped so that a request past the end still gets the last window */
+    public static int clampStartIndex(int requested, int windowSize, int totalCount) {
+        int startIndex = requested;
+        if (startIndex >= totalCount) {
+            startIndex = totalCount - windowSize;
+        }
+        return Math.max(0, startIndex);
+    }
+
+    /** End (exclusive) of the items answering windowSize items from startIndex */
+    public static int endIndex(int startIndex, int windowSize, int totalCount) {
+        return Math.max(startIndex, Math.min(startIndex + windowSize, totalCount));
+    }
+}
@@ -3,6 +3,12 @@ Bitwig Plugin Binary Protocol Configuration
 
 Plugin-specific configuration for Binary (8-bit) protocol.
 Used with oc-bridge for USB Serial communication.
+
+compact_frame_flag, envelope_message_id, max_envelope_size,
+include_message_name and cpp_decode_mode describe the hand edits in the files
+marked "MANUAL - DO NOT REGENERATE"; protocol-codegen has to implement them
+before those markers can go. generate_protocol.sh fails when a MANUAL file
+falls behind the message definitions.
 """
 
 from protocol_codegen.generators.orchestrators.binary import (
@@ -17,12 +23,22 @@ PROTOCOL_CONFIG = BinaryConfig(
     structure=BinaryStructure(
         message_type_offset=0,  # First byte = MessageID
         payload_offset=1,  # Payload starts at byte 1
+        compact_frame_flag=0x80,  # MessageID high bit = frame without MESSAGE_NAME prefix
+        envelope_message_id=0x7F,  # Reserved ID: frame packs several [len][compact frame] records
     ),
     limits=BinaryLimits(
         string_max_length=32,  # Match SysEx config
         array_max_items=32,  # Match SysEx config
         max_payload_size=10000,  # Match SysEx config
         max_message_size=16000,  # Match SysEx config
-        include_message_name=True,  # Include MESSAGE_NAME prefix for bridge logging
+        max_envelope_size=512,  # One USB high-speed bulk packet
+        # MESSAGE_NAME prefix is framed by BitwigProtocol / Protocol (not the struct
+        # codecs) and dropped once compact framing is negotiated at HOST_INITIALIZED.
+        # Loggers resolve names from MessageNames instead.
+        include_message_name=False,
     ),
+    # C++ decoders expose string fields as std::string_view into the received
+    # frame (and string lists as ViewList<N>) instead of heap-allocated copies.
+    # Other dynamic arrays decode into BoundedList<T, N> (inline storage, no heap).
+    cpp_decode_mode="view",
 )
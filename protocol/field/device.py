@@ -1,6 +1,7 @@
 from protocol_codegen.core.field import PrimitiveField, CompositeField, EnumField, Type
 from field.parameter import *  # Import generic parameter fields
 from field.color import color_rgb
+from field.window import window_size
 from enums.device import DeviceType
 from enums.navigation import ChildType, ViewType
 
@@ -87,7 +88,7 @@ page_names = PrimitiveField('pageNames', type_name=Type.STRING, array=32)
 # WINDOWED PAGE NAVIGATION FIELDS (New)
 # ============================================================================
 # For lazy-loading large page lists (>16 pages)
-# Pattern: REQUEST_XXX_WINDOW(startIndex) -> XXX_WINDOW(total, start, current, items[16])
+# Pattern: REQUEST_XXX_WINDOW(startIndex, windowSize) -> XXX_WINDOW(total, start, current, items[16]) * n
 
 # Start index for windowed requests
 device_page_start_index = PrimitiveField('pageStartIndex', type_name=Type.UINT8)
@@ -96,6 +97,10 @@ device_page_start_index = PrimitiveField('pageStartIndex', type_name=Type.UINT8)
 # Memory impact: 16 * 17 bytes = 272 bytes per message
 page_names_window = PrimitiveField('pageNames', type_name=Type.STRING, array=16)
 
+# Optional front coding of pageNames: name[i] = name[i-1][:prefix[i]] + pageNames[i]
+# Empty when the names are sent whole
+page_name_prefixes = PrimitiveField('pageNamePrefixes', type_name=Type.UINT8, array=16, dynamic=True)
+
 # ============================================================================
 # DEVICE NAVIGATION FIELDS (Hierarchical Navigation)
 # ============================================================================
@@ -119,6 +124,17 @@ child_type = EnumField('childType', enum_def=ChildType)
 # Example: [1, 2, 0, 0] = has Slots AND Layers
 children_types = PrimitiveField('childrenTypes', type_name=Type.UINT8, array=4)
 
+# Page name cache keys (DEVICE_CHANGE_HEADER): which device, and which version
+# of its page name list (FNV-1a, 0 = unknown / do not cache)
+device_identity = PrimitiveField('deviceIdentity', type_name=Type.UINT32)
+page_names_hash = PrimitiveField('pageNamesHash', type_name=Type.UINT32)
+
+# Device chain cache keys (DEVICE_CHAIN_STAMP): which chain (track + nesting),
+# and which version of its device list (FNV-1a, 0 = do not cache)
+chain_identity = PrimitiveField('chainIdentity', type_name=Type.UINT32)
+chain_stamp = PrimitiveField('chainStamp', type_name=Type.UINT32)
+window_follows = PrimitiveField('windowFollows', type_name=Type.BOOL)
+
 # Child name (includes notation for drums: "Kick (C1)")
 child_name = PrimitiveField('childName', type_name=Type.STRING)
 
@@ -147,7 +163,7 @@ device_list = CompositeField('devices', fields=device_info, array=32)
 # WINDOWED DEVICE LIST FIELDS (New)
 # ============================================================================
 # For lazy-loading large device lists (>16 devices)
-# Pattern: REQUEST_XXX_WINDOW(startIndex) -> XXX_WINDOW(total, start, current, items[16])
+# Pattern: REQUEST_XXX_WINDOW(startIndex, windowSize) -> XXX_WINDOW(total, start, current, items[16]) * n
 
 # Start index for windowed requests
 device_start_index = PrimitiveField('deviceStartIndex', type_name=Type.UINT8)
@@ -156,6 +172,9 @@ device_start_index = PrimitiveField('deviceStartIndex', type_name=Type.UINT8)
 # Memory impact: 16 devices * ~25 bytes = 400 bytes per message
 device_list_window = CompositeField('devices', fields=device_info, array=16)
 
+# Optional front coding of devices[].deviceName (see page_name_prefixes)
+device_name_prefixes = PrimitiveField('deviceNamePrefixes', type_name=Type.UINT8, array=16, dynamic=True)
+
 # ChildInfo: Information about a child (slot/layer/pad) with type
 child_info = [
     child_index,           # Index (0-N for slots/layers, MIDI note 0-127 for drums)
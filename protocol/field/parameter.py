@@ -55,11 +55,10 @@ parameter_is_modulated = PrimitiveField('isModulated', type_name=Type.BOOL)
 # Used to detect USB buffer accumulation and discard stale batches
 batch_sequence_number = PrimitiveField('sequenceNumber', type_name=Type.UINT8)
 
-# Array of 8 modulated values (one per remote control slot)
+# Modulated values, one per set bit of modulatedMask (packed, ascending slot order)
 # Uses NORM8 (1 byte per value) for minimal bandwidth
-# Total: 8 bytes instead of 40 bytes per batch (80% reduction)
 # Precision: ~0.8% (1/127), sufficient for visual display of modulation ribbon
-parameter_modulated_values_batch = PrimitiveField('modulatedValues', type_name=Type.NORM8, array=8)
+parameter_modulated_values_batch = PrimitiveField('modulatedValues', type_name=Type.NORM8, array=8, dynamic=True)
 
 # ============================================================================
 # BATCHED PARAMETER VALUES FIELDS
@@ -76,12 +75,14 @@ values_echo_mask = PrimitiveField('echoMask', type_name=Type.UINT8)
 # Host is source of truth, always up-to-date
 has_automation_mask = PrimitiveField('hasAutomationMask', type_name=Type.UINT8)
 
-# Array of 8 parameter values (one per remote control slot)
+# Modulated mask - which modulated values this batch carries (bit 0-7)
+modulated_mask = PrimitiveField('modulatedMask', type_name=Type.UINT8)
+
+# Parameter values, one per set bit of dirtyMask (packed, ascending slot order)
 # Uses NORM8 (1 byte per value) for minimal bandwidth
-# Total: 8 bytes instead of 40 bytes per batch (80% reduction)
-parameter_values_batch = PrimitiveField('values', type_name=Type.NORM8, array=8)
+# Idle slots cost nothing: one automated knob is 1 byte instead of 8
+parameter_values_batch = PrimitiveField('values', type_name=Type.NORM8, array=8, dynamic=True)
 
-# Array of 8 display values (one per remote control slot)
-# Used for LIST/BUTTON parameters to show the current discrete value name
-# KNOB parameters send empty strings (host skips update if empty)
-parameter_display_values_batch = PrimitiveField('displayValues', type_name=Type.STRING, array=8)
+# Display values, one per set bit of dirtyMask (same packing as values)
+# Bitwig-formatted value text; empty strings are skipped by the controller
+parameter_display_values_batch = PrimitiveField('displayValues', type_name=Type.STRING, array=8, dynamic=True)
@@ -6,3 +6,45 @@ from protocol_codegen.core.field import PrimitiveField, Type
 
 # Host active state (true=host initialized and active, false=host deactivating)
 host_active = PrimitiveField('isHostActive', type_name=Type.BOOL)
+
+# Compact framing (true=MESSAGE_NAME prefix dropped, names resolved from MessageID)
+compact_frames = PrimitiveField('compactFrames', type_name=Type.BOOL)
+
+
+# ============================================================================
+# FLOW CONTROL FIELDS (Controller → Host credit)
+# ============================================================================
+
+# Frame bytes the controller has dispatched so far (wraps at 65536, acknowledges host output)
+received_bytes = PrimitiveField('receivedBytes', type_name=Type.UINT16)
+
+# Unacknowledged bytes the host may keep in flight before holding bulk messages back
+window_bytes = PrimitiveField('windowBytes', type_name=Type.UINT16)
+
+# Batch sequence gaps/jumps seen by the controller (wraps at 256, a change makes the host resend every slot)
+batch_losses = PrimitiveField('batchLosses', type_name=Type.UINT8)
+
+
+# ============================================================================
+# RENDER STATS FIELDS (Controller → Host load report)
+# ============================================================================
+
+# Effective display refreshes per second over the last report window
+render_hz = PrimitiveField('renderHz', type_name=Type.UINT8)
+
+# Average busy time of one main loop iteration (update + refresh), microseconds
+frame_time_us = PrimitiveField('frameTimeUs', type_name=Type.UINT16)
+
+# Idle share of the main loop period (0 = overloaded, 100 = idle)
+headroom_percent = PrimitiveField('headroomPercent', type_name=Type.UINT8)
+
+
+# ============================================================================
+# STRING DICTIONARY FIELDS
+# ============================================================================
+
+# Host-assigned string ID: (generation << 7) | slot, see StringDictionary
+string_id = PrimitiveField('stringId', type_name=Type.UINT16)
+
+# Dictionary string (name fields then carry a 3-byte reference instead)
+string_text = PrimitiveField('text', type_name=Type.STRING)
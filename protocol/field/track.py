@@ -1,5 +1,6 @@
 from protocol_codegen.core.field import PrimitiveField, CompositeField, EnumField, Type
 from field.color import color_rgb
+from field.window import window_size
 from enums.track import TrackType
 
 # ============================================================================
@@ -85,7 +86,7 @@ track_list = CompositeField('tracks', fields=track_info, array=32)
 # WINDOWED TRACK LIST FIELDS (New)
 # ============================================================================
 # For lazy-loading large track lists (>16 tracks)
-# Pattern: REQUEST_XXX_WINDOW(startIndex) -> XXX_WINDOW(total, start, current, items[16])
+# Pattern: REQUEST_XXX_WINDOW(startIndex, windowSize) -> XXX_WINDOW(total, start, current, items[16]) * n
 
 # Start index for windowed requests
 track_start_index = PrimitiveField('trackStartIndex', type_name=Type.UINT8)
@@ -93,3 +94,7 @@ track_start_index = PrimitiveField('trackStartIndex', type_name=Type.UINT8)
 # Array of 16 tracks (one window)
 # Memory impact: 16 tracks * ~40 bytes = 640 bytes per message
 track_list_window = CompositeField('tracks', fields=track_info, array=16)
+
+# Optional front coding of tracks[].trackName: name[i] = name[i-1][:prefix[i]] + trackName[i]
+# Empty when the names are sent whole
+track_name_prefixes = PrimitiveField('trackNamePrefixes', type_name=Type.UINT8, array=16, dynamic=True)
@@ -0,0 +1,10 @@
+from protocol_codegen.core.field import PrimitiveField, Type
+
+# ============================================================================
+# WINDOW FIELDS (Generic)
+# ============================================================================
+
+# Items requested by REQUEST_XXX_WINDOW, chosen by the controller from the
+# measured link throughput (LinkMeter.hpp). The host answers with as many
+# XXX_WINDOW messages of up to 16 items as it takes to cover the request.
+window_size = PrimitiveField('windowSize', type_name=Type.UINT8)
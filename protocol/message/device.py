@@ -12,6 +12,7 @@ DEVICE MESSAGES:
 - DEVICE_STATE_CHANGE: Toggle device enabled (command)
 - DEVICE_PAGE_SELECT: Select page by index (command)
 - DEVICE_CHANGE_HEADER: Device context changed (notify)
+- DEVICE_CHAIN_STAMP: Device chain version, lets the controller reuse a cached list (notify)
 - DEVICE_PAGE_CHANGE: Page changed with remote controls (notify)
 - etc.
 
@@ -110,15 +111,15 @@ VIEW_STATE = Message(
 REQUEST_DEVICE_LIST_WINDOW = Message(
     direction=Direction.TO_HOST,
     intent=Intent.QUERY,
-    description='Request device list starting at index (windowed, 16 items)',
-    fields=[device_start_index]
+    description='Request windowSize devices starting at index (answered in windows of 16)',
+    fields=[device_start_index, window_size]
 )
 
 REQUEST_DEVICE_PAGE_NAMES_WINDOW = Message(
     direction=Direction.TO_HOST,
     intent=Intent.QUERY,
-    description='Request page names starting at index (windowed, 16 items)',
-    fields=[device_page_start_index]
+    description='Request windowSize page names starting at index (answered in windows of 16)',
+    fields=[device_page_start_index, window_size]
 )
 
 REQUEST_DEVICE_CHILDREN = Message(
@@ -143,7 +144,8 @@ DEVICE_LIST_WINDOW = Message(
         device_index,
         device_is_nested,
         parent_name,
-        device_list_window
+        device_list_window,
+        device_name_prefixes
     ]
 )
 
@@ -155,7 +157,8 @@ DEVICE_PAGE_NAMES_WINDOW = Message(
         device_page_count,
         device_page_start_index,
         device_page_index,
-        page_names_window
+        page_names_window,
+        page_name_prefixes
     ]
 )
 
@@ -190,7 +193,15 @@ DEVICE_CHANGE_HEADER = Message(
     direction=Direction.TO_CONTROLLER,
     intent=Intent.NOTIFY,
     description='Device change header - lightweight message with device identity only',
-    fields=[device_name, device_state, device_type, page_info, children_types]
+    fields=[device_name, device_state, device_type, page_info, children_types,
+            device_identity, page_names_hash]
+)
+
+DEVICE_CHAIN_STAMP = Message(
+    direction=Direction.TO_CONTROLLER,
+    intent=Intent.NOTIFY,
+    description='Device chain identity and version stamp (controller reuses its cached list if unchanged)',
+    fields=[chain_identity, chain_stamp, device_count, device_index, device_is_nested, window_follows]
 )
 
 DEVICE_ENABLED_STATE = Message(
@@ -265,12 +276,13 @@ DEVICE_REMOTE_CONTROL_ORIGIN_CHANGE = Message(
 DEVICE_REMOTE_CONTROLS_BATCH = Message(
     direction=Direction.TO_CONTROLLER,
     intent=Intent.NOTIFY,
-    description='Combined batch update of all 8 remote control values and modulated values (sent at fixed rate ~50Hz)',
+    description='Sparse batch update of changed remote control values and modulated values (sent on change, at most one per controller frame)',
     fields=[
         batch_sequence_number,
         values_dirty_mask,
         values_echo_mask,      # Keep echo mask - it's a bitmask, not the deprecated isEcho field
         has_automation_mask,
+        modulated_mask,
         parameter_values_batch,
         parameter_modulated_values_batch,
         parameter_display_values_batch
@@ -8,6 +8,10 @@ MESSAGES:
 - REQUEST_HOST_STATUS: Controller requests current host status (Controller → Host)
 - HOST_INITIALIZED: Host plugin is initialized and ready (Host → Controller)
 - HOST_DEACTIVATED: Host plugin is deactivating/closing (Host → Controller)
+- FLOW_CREDIT: Controller receive credit for host bulk output (Controller → Host)
+- RENDER_STATS: Controller render rate and frame-time headroom (Controller → Host)
+- STRING_DEFINE: Dictionary string referenced by ID in name fields (Host → Controller)
+- STRING_MISS: Controller met an unknown string ID (Controller → Host)
 """
 
 from field.plugin import *
@@ -23,7 +27,45 @@ REQUEST_HOST_STATUS = Message(
     direction=Direction.TO_HOST,
     intent=Intent.QUERY,
     description='Request current host status (triggers HOST_INITIALIZED response)',
-    fields=[]  # No payload - simple ping/request
+    fields=[compact_frames]  # Controller supports compact framing
+)
+
+
+# ============================================================================
+# Flow Control (Controller → Host)
+# ============================================================================
+
+FLOW_CREDIT = Message(
+    direction=Direction.TO_HOST,
+    intent=Intent.COMMAND,
+    description='Controller receive credit: bytes dispatched so far, bytes the host may keep in flight, batch losses',
+    fields=[received_bytes, window_bytes, batch_losses]  # Sent periodically by BitwigContext::update()
+)
+
+RENDER_STATS = Message(
+    direction=Direction.TO_HOST,
+    intent=Intent.NOTIFY,
+    description='Controller render rate and frame-time headroom (host paces batches against it)',
+    fields=[render_hz, frame_time_us, headroom_percent]  # Reported about once per second
+)
+
+
+# ============================================================================
+# String Dictionary
+# ============================================================================
+
+STRING_DEFINE = Message(
+    direction=Direction.TO_CONTROLLER,
+    intent=Intent.NOTIFY,
+    description='Define a dictionary string (name fields reference it by ID)',
+    fields=[string_id, string_text]  # Sent right before the first message referencing it
+)
+
+STRING_MISS = Message(
+    direction=Direction.TO_HOST,
+    intent=Intent.NOTIFY,
+    description='Controller met an unknown string ID (host redefines it)',
+    fields=[string_id]
 )
 
 
@@ -35,7 +77,7 @@ HOST_INITIALIZED = Message(
     direction=Direction.TO_CONTROLLER,
     intent=Intent.NOTIFY,
     description='Host plugin initialized and active',
-    fields=[host_active]  # isHostActive = true
+    fields=[host_active, compact_frames]  # isHostActive = true, compact framing accepted
 )
 
 HOST_DEACTIVATED = Message(
@@ -162,8 +162,8 @@ SELECT_MIX_SEND = Message(
 REQUEST_TRACK_LIST_WINDOW = Message(
     direction=Direction.TO_HOST,
     intent=Intent.QUERY,
-    description='Request track list starting at index (windowed, 16 items)',
-    fields=[track_start_index]
+    description='Request windowSize tracks starting at index (answered in windows of 16)',
+    fields=[track_start_index, window_size]
 )
 
 REQUEST_TRACK_SEND_LIST = Message(
@@ -195,7 +195,8 @@ TRACK_LIST_WINDOW = Message(
         track_index,
         track_is_nested,
         parent_group_name,
-        track_list_window
+        track_list_window,
+        track_name_prefixes
     ]
 )
 
@@ -8,6 +8,14 @@
 # Usage:
 #   ./script/protocol/generate_protocol.sh
 #
+# Files marked "MANUAL - DO NOT REGENERATE" (generated once, then edited by
+# hand, e.g. compact framing in the structs) are restored after generation:
+# port such edits to protocol-codegen before dropping the marker.
+# The script fails when the generator's output for such a file declares
+# other message IDs, callbacks, send methods or encoded fields than the
+# restored copy (a message was added or changed in protocol/): port the
+# change by hand, then run it again.
+#
 # Requirements:
 #   - uv/uvx installed (https://docs.astral.sh/uv/)
 #
@@ -54,6 +62,24 @@ fi
 
 cd "$PROJECT_ROOT"
 
+# Keep hand-maintained files out of the generator's reach
+MANUAL_BACKUP="$(mktemp -d)"
+trap 'rm -rf "$MANUAL_BACKUP"' EXIT
+MANUAL_FILES=$(grep -rl "MANUAL - DO NOT REGENERATE" src/protocol host/src/protocol || true)
+for file in $MANUAL_FILES; do
+    mkdir -p "$MANUAL_BACKUP/$(dirname "$file")"
+    cp "$file" "$MANUAL_BACKUP/$file"
+done
+
+# What a MANUAL file must agree on with its regenerated version: message
+# IDs, callbacks, send methods and encoded fields (not formatting or comments)
+protocol_shape() {
+    grep -oE '^\s*[A-Z][A-Z0-9_]* ?(= ?0x[0-9A-Fa-f]+|\(0x[0-9A-Fa-f]+\))' "$1" | tr -d ' '
+    grep -oE '\bon[A-Z][A-Za-z0-9]*' "$1" | sort -u
+    grep -E '^\s*(public )?void [a-z]\w*\(' "$1" | sed 's/^ *//; s/ *{ *$//'
+    grep -oE 'Encoder(::|\.)encode\w+\([^;]*' "$1" | grep -v MESSAGE_NAME || true
+}
+
 echo "Running protocol-codegen..."
 echo ""
 
@@ -66,6 +92,26 @@ uv run protocol-codegen generate \
     --output-base "." \
     --verbose
 
+DRIFTED=""
+for file in $MANUAL_FILES; do
+    if [[ -f "$file" ]] && ! diff -u --label "$file (MANUAL)" --label "$file (generated)" \
+            <(protocol_shape "$MANUAL_BACKUP/$file") <(protocol_shape "$file"); then
+        DRIFTED="$DRIFTED $file"
+    fi
+    cp "$MANUAL_BACKUP/$file" "$file"
+done
+echo "Kept $(echo "$MANUAL_FILES" | grep -c . || true) files marked MANUAL"
+
+if [[ -n "$DRIFTED" ]]; then
+    echo ""
+    echo -e "${RED}Error: MANUAL files are out of date with protocol/ (diffs above):${NC}"
+    for file in $DRIFTED; do
+        echo "  $file"
+    done
+    echo "Port the changes into these files by hand, then run again."
+    exit 1
+fi
+
 echo ""
 echo -e "${GREEN}===================================${NC}"
 echo -e "${GREEN}Protocol generation complete!${NC}"
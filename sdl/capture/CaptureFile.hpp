@@ -0,0 +1,218 @@
+#pragma once
+
+/**
+ * @file CaptureFile.hpp
+ * @brief File-backed protocol recorder and replay source (desktop builds)
+ *
+ * - FileCaptureSink:   --capture <file>  records every frame of a live session
+ * - FileReplaySource:  --replay <file>   feeds the inbound frames back into
+ *                      BitwigContext at their recorded pace, no bridge needed
+ *
+ * The replay reports busy-time statistics once the capture is exhausted:
+ * per loop iteration, the time spent in BitwigContext::update() (dispatch of
+ * the replayed frames, state and view updates) plus the LVGL refresh that
+ * follows it. Idle time between iterations is not counted, so the UI
+ * pipeline can be compared across builds on the same traffic.
+ *
+ * @see protocol/Capture.hpp for the file format
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <lvgl.h>
+#include <oc/log/Log.hpp>
+
+#include "protocol/Capture.hpp"
+
+namespace sdl::capture {
+
+using Clock = std::chrono::steady_clock;
+
+inline uint32_t elapsedMs(Clock::time_point since) {
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - since).count());
+}
+
+/**
+ * @brief Appends timestamped frames to a capture file
+ */
+class FileCaptureSink : public bitwig::capture::Sink {
+public:
+    explicit FileCaptureSink(const char* path) : file_(std::fopen(path, "wb")), start_(Clock::now()) {
+        if (!file_) {
+            OC_LOG_ERROR("[Capture] cannot open {} for writing", path);
+            return;
+        }
+        std::fwrite(bitwig::capture::MAGIC, 1, sizeof(bitwig::capture::MAGIC), file_);
+        OC_LOG_INFO("[Capture] recording to {}", path);
+    }
+
+    ~FileCaptureSink() override {
+        if (file_) std::fclose(file_);
+    }
+
+    FileCaptureSink(const FileCaptureSink&) = delete;
+    FileCaptureSink& operator=(const FileCaptureSink&) = delete;
+
+    bool isOpen() const { return file_ != nullptr; }
+
+    void onFrame(bitwig::capture::Direction direction, const uint8_t* data, size_t len) override {
+        if (!file_) return;
+        uint8_t header[bitwig::capture::RECORD_HEADER_SIZE];
+        bitwig::capture::writeRecordHeader(header, elapsedMs(start_), direction, static_cast<uint16_t>(len));
+        std::fwrite(header, 1, sizeof(header), file_);
+        std::fwrite(data, 1, len, file_);
+    }
+
+private:
+    std::FILE* file_;
+    Clock::time_point start_;
+};
+
+/**
+ * @brief Yields the inbound frames of a capture file at their recorded pace
+ */
+class FileReplaySource : public bitwig::capture::Source {
+public:
+    explicit FileReplaySource(const char* path) {
+        std::FILE* file = std::fopen(path, "rb");
+        if (!file) {
+            OC_LOG_ERROR("[Replay] cannot open {}", path);
+            return;
+        }
+        uint8_t chunk[4096];
+        size_t read = 0;
+        while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+            data_.insert(data_.end(), chunk, chunk + read);
+        }
+        std::fclose(file);
+
+        if (!bitwig::capture::hasMagic(data_.data(), data_.size())) {
+            OC_LOG_ERROR("[Replay] {} is not a protocol capture", path);
+            data_.clear();
+            return;
+        }
+        cursor_ = sizeof(bitwig::capture::MAGIC);
+        OC_LOG_INFO("[Replay] {} ({} bytes)", path, data_.size());
+    }
+
+    ~FileReplaySource() override {
+        if (display_ && display_ == lv_display_get_default()) {
+            lv_display_remove_event_cb_with_user_data(display_, &onRefresh, this);
+        }
+    }
+
+    FileReplaySource(const FileReplaySource&) = delete;
+    FileReplaySource& operator=(const FileReplaySource&) = delete;
+
+    bool isOpen() const { return !data_.empty(); }
+
+    void beginUpdate() override {
+        if (done_ || data_.empty()) return;
+        watchRefresh();
+        closeIteration();  // Previous update() and the refresh after it
+        update_start_ = Clock::now();
+        in_update_ = true;
+    }
+
+    void endUpdate() override {
+        if (!in_update_) return;
+        in_update_ = false;
+        iteration_ms_ += msSince(update_start_);
+        iteration_open_ = true;
+    }
+
+    bool poll(bitwig::capture::Record& out) override {
+        if (done_ || data_.empty()) return false;
+
+        if (!started_) {
+            started_ = true;
+            start_ = Clock::now();
+        }
+
+        const uint8_t* end = data_.data() + data_.size();
+        while (true) {
+            const uint8_t* cursor = data_.data() + cursor_;
+            bitwig::capture::Record record;
+            if (!bitwig::capture::readRecord(cursor, end, record)) {
+                finish();
+                return false;
+            }
+            if (record.timeMs > elapsedMs(start_)) return false;
+            cursor_ = static_cast<size_t>(cursor - data_.data());
+            if (record.direction != bitwig::capture::Direction::INBOUND) continue;
+
+            ++frames_;
+            out = record;
+            return true;
+        }
+    }
+
+private:
+    static double msSince(Clock::time_point since) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+    }
+
+    /// Time the LVGL refresh of the default display (created after this source)
+    void watchRefresh() {
+        if (display_) return;
+        display_ = lv_display_get_default();
+        if (!display_) return;
+        lv_display_add_event_cb(display_, &onRefresh, LV_EVENT_REFR_START, this);
+        lv_display_add_event_cb(display_, &onRefresh, LV_EVENT_REFR_READY, this);
+    }
+
+    static void onRefresh(lv_event_t* e) {
+        auto* self = static_cast<FileReplaySource*>(lv_event_get_user_data(e));
+        if (self->done_) return;
+        if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+            self->refresh_start_ = Clock::now();
+            self->refreshing_ = true;
+        } else if (self->refreshing_) {
+            self->refreshing_ = false;
+            self->iteration_ms_ += msSince(self->refresh_start_);
+        }
+    }
+
+    void closeIteration() {
+        if (!iteration_open_) return;
+        iteration_open_ = false;
+        total_busy_ms_ += iteration_ms_;
+        if (iteration_ms_ > max_busy_ms_) max_busy_ms_ = iteration_ms_;
+        iteration_ms_ = 0.0;
+        ++ticks_;
+    }
+
+    void finish() {
+        done_ = true;
+        closeIteration();
+        double avg = ticks_ > 0 ? total_busy_ms_ / static_cast<double>(ticks_) : 0.0;
+        OC_LOG_INFO("[Replay] done: {} frames in {} ms, {} updates, busy avg {} ms / max {} ms",
+                    frames_, elapsedMs(start_), ticks_, avg, max_busy_ms_);
+    }
+
+    std::vector<uint8_t> data_;
+    size_t cursor_ = 0;
+    bool started_ = false;
+    bool done_ = false;
+    Clock::time_point start_{};
+
+    // Busy time of the current loop iteration: update() + LVGL refresh
+    lv_display_t* display_ = nullptr;
+    Clock::time_point update_start_{};
+    Clock::time_point refresh_start_{};
+    double iteration_ms_ = 0.0;
+    bool in_update_ = false;
+    bool refreshing_ = false;
+    bool iteration_open_ = false;
+
+    uint32_t frames_ = 0;
+    uint32_t ticks_ = 0;
+    double total_busy_ms_ = 0.0;
+    double max_busy_ms_ = 0.0;
+};
+
+}  // namespace sdl::capture
@@ -7,6 +7,10 @@
  * - Requires remote transport (UDP) to communicate with oc-bridge -> Bitwig
  *
  * Note: Skip boot/splash context for desktop builds (instant startup).
+ *
+ * Protocol capture (see capture/CaptureFile.hpp):
+ * - --capture <file>  record every frame exchanged with the host
+ * - --replay <file>   replay a capture's host frames instead of live traffic
  */
 
 #define SDL_MAIN_HANDLED
@@ -23,9 +27,21 @@
 #include <config/App.hpp>
 #include "app/AppLogic.hpp"
 
+#include "capture/CaptureFile.hpp"
+
+#include <cstring>
+#include <memory>
+
 namespace {
 constexpr int DEFAULT_NATIVE_BRIDGE_UDP_PORT = 8001;
+
+const char* argValue(int argc, char** argv, const char* name) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], name) == 0) return argv[i + 1];
+    }
+    return nullptr;
 }
+}  // namespace
 
 int main(int argc, char** argv) {
     // 1. Initialize SDL environment
@@ -47,6 +63,17 @@ int main(int argc, char** argv) {
         .controllers(env.inputMapper())
         .inputConfig(Config::Input::CONFIG);
 
+    // 2. Optional protocol capture / replay (must be set before the context starts)
+    std::unique_ptr<sdl::capture::FileCaptureSink> capture_sink;
+    std::unique_ptr<sdl::capture::FileReplaySource> replay_source;
+    if (const char* path = argValue(argc, argv, "--capture")) {
+        capture_sink = std::make_unique<sdl::capture::FileCaptureSink>(path);
+    }
+    if (const char* path = argValue(argc, argv, "--replay")) {
+        replay_source = std::make_unique<sdl::capture::FileReplaySource>(path);
+    }
+    bitwig::BitwigContext::setCapture(capture_sink.get(), replay_source.get());
+
     // 3. Register main context only (skip splash for desktop)
     // Note: Contexts use Screen::root() which is configured to HwSimulator's screenArea
     app.registerContext<bitwig::BitwigContext>(bitwig::ContextID::BITWIG, "Bitwig");
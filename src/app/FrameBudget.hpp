@@ -0,0 +1,82 @@
+#pragma once
+
+/**
+ * @file FrameBudget.hpp
+ * @brief Main loop load measurement, reported to the host as RENDER_STATS
+ *
+ * The platform loop records the busy time of each iteration and whether the
+ * display was refreshed. BitwigContext turns each window into a report so
+ * the host can pace remote-control batches to what the screen can show and
+ * back off when the controller runs out of headroom.
+ */
+
+#include <algorithm>
+#include <cstdint>
+
+namespace bitwig::app {
+
+class FrameBudget {
+public:
+    static constexpr uint32_t REPORT_INTERVAL_MS = 1000;
+
+    struct Report {
+        uint8_t renderHz;         ///< Display refreshes per second
+        uint16_t frameTimeUs;     ///< Average busy time per loop iteration
+        uint8_t headroomPercent;  ///< Idle share of the loop period
+    };
+
+    /// Loop period the busy time is measured against (1 / APP_HZ)
+    void setLoopPeriodUs(uint32_t periodUs) { period_us_ = periodUs; }
+
+    /// Record one loop iteration (called by the platform main loop)
+    void recordLoop(uint32_t busyUs, bool rendered) {
+        busy_us_ += busyUs;
+        ++loops_;
+        if (rendered) ++renders_;
+    }
+
+    /**
+     * @brief Close the window once REPORT_INTERVAL_MS elapsed
+     * @return false if the window is still open or nothing was recorded
+     */
+    bool report(uint32_t nowMs, Report& out) {
+        if (!started_) {
+            started_ = true;
+            window_start_ms_ = nowMs;
+            return false;
+        }
+        uint32_t elapsed = nowMs - window_start_ms_;
+        if (elapsed < REPORT_INTERVAL_MS) return false;
+
+        bool hasData = loops_ > 0 && period_us_ > 0;
+        if (hasData) {
+            uint32_t avgBusy = static_cast<uint32_t>(busy_us_ / loops_);
+            uint32_t load = std::min<uint32_t>(100, avgBusy * 100 / period_us_);
+            out.renderHz = static_cast<uint8_t>(std::min<uint32_t>(255, renders_ * 1000 / elapsed));
+            out.frameTimeUs = static_cast<uint16_t>(std::min<uint32_t>(UINT16_MAX, avgBusy));
+            out.headroomPercent = static_cast<uint8_t>(100 - load);
+        }
+
+        window_start_ms_ = nowMs;
+        busy_us_ = 0;
+        loops_ = 0;
+        renders_ = 0;
+        return hasData;
+    }
+
+private:
+    uint32_t period_us_ = 0;
+    uint64_t busy_us_ = 0;
+    uint32_t loops_ = 0;
+    uint32_t renders_ = 0;
+    uint32_t window_start_ms_ = 0;
+    bool started_ = false;
+};
+
+/// Instance shared by the platform loop (writer) and BitwigContext (reader)
+inline FrameBudget& frameBudget() {
+    static FrameBudget instance;
+    return instance;
+}
+
+}  // namespace bitwig::app
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+namespace bitwig::config::FlowControlConfig {
+
+// FLOW_CREDIT period (acknowledges received bytes, lets the host send more bulk)
+inline constexpr uint32_t CREDIT_INTERVAL_MS = 20;
+
+// Unacknowledged bytes the host may keep in flight before holding bulk back
+inline constexpr uint16_t WINDOW_BYTES = 4096;
+
+}  // namespace bitwig::config::FlowControlConfig
@@ -9,7 +9,10 @@
 #include <ms/ui/font/CoreFonts.hpp>
 
 #include <config/App.hpp>
+#include "app/FrameBudget.hpp"
+#include "config/FlowControlConfig.hpp"
 #include "protocol/MessageStructure.hpp"
+#include "state/StateTransaction.hpp"
 #include "ui/font/BitwigFonts.hpp"
 
 namespace bitwig {
@@ -50,9 +53,47 @@ oc::type::Result<void> BitwigContext::init() {
 }
 
 void BitwigContext::update() {
+    if (replay_source_) replay_source_->beginUpdate();
+
+    // Replay: feed captured frames that are due (instead of the bridge)
+    if (replay_source_ && protocol_) {
+        capture::Record record;
+        while (replay_source_->poll(record)) {
+            protocol_->receive(record.data, record.len);
+        }
+    }
+
     if (input_last_clicked_) {
         input_last_clicked_->flushPending();
     }
+
+    // Periodic receive credit (host paces bulk transfers against it)
+    if (protocol_ && state_.host.connected.get()) {
+        const uint32_t now = lv_tick_get();
+        if (now - last_credit_ms_ >= config::FlowControlConfig::CREDIT_INTERVAL_MS) {
+            last_credit_ms_ = now;
+            uint8_t batchLosses = 0;
+            if (host_remote_control_) {
+                const auto& batch = host_remote_control_->batchStats();
+                batchLosses = static_cast<uint8_t>(batch.gaps + batch.resyncs);
+            }
+            protocol_->sendFlowCredit(config::FlowControlConfig::WINDOW_BYTES, batchLosses);
+        }
+
+        // Render load report (host adapts its batch interval)
+        app::FrameBudget::Report load;
+        if (app::frameBudget().report(now, load)) {
+            protocol_->renderStats(load.renderHz, load.frameTimeUs, load.headroomPercent);
+            logBatchStats(true);
+        }
+    }
+
+    // One transport frame for everything queued during this tick
+    if (protocol_) {
+        protocol_->flush();
+    }
+
+    if (replay_source_) replay_source_->endUpdate();
 }
 
 void BitwigContext::onCleanup() {
@@ -112,23 +153,43 @@ void BitwigContext::onCleanup() {
 void BitwigContext::onConnected() {
     OC_LOG_INFO("BitwigContext activated");
 
-    // Request current state from Bitwig
-    protocol_->requestHostStatus();
-    protocol_->requestDeviceListWindow(0);
-    protocol_->requestTrackListWindow(0);
+    // Request current state from Bitwig (named frames until the host accepts compact)
+    protocol_->setCompactFrames(false);
+    if (host_remote_control_) host_remote_control_->resyncBatchSequence();
+    protocol_->requestHostStatus(true);
+    protocol_->requestDeviceListWindow(0, protocol_->listWindowSize());
+    protocol_->requestTrackListWindow(0, protocol_->listWindowSize());
 }
 
 void BitwigContext::onDisconnected() {
     OC_LOG_INFO("BitwigContext deactivated");
+    logBatchStats(false);
+    if (protocol_) protocol_->setCompactFrames(false);
     state_.resetAll();
 }
 
+// Batch sequence counters: at each render report while batches flow, and at disconnect
+void BitwigContext::logBatchStats(bool onlyIfChanged) {
+    if (!host_remote_control_) return;
+    const auto& batch = host_remote_control_->batchStats();
+    if (onlyIfChanged && batch.received == last_logged_batches_) return;
+    last_logged_batches_ = batch.received;
+    OC_LOG_INFO("[Link] batches received={} stale={} lost={} gaps={} resyncs={}",
+                batch.received, batch.stale, batch.lost, batch.gaps, batch.resyncs);
+}
+
 // =============================================================================
 // Factory Methods
 // =============================================================================
 
 void BitwigContext::createProtocol() {
     protocol_ = std::make_unique<BitwigProtocol>(frames());
+    protocol_->setCaptureSink(capture_sink_);
+
+    // One state transaction per inbound frame: handlers write freely, each
+    // list or flags signal notifies once when the frame is done
+    protocol_->onFrameBegin = [] { state::StateTransaction::begin(); };
+    protocol_->onFrameEnd = [] { state::StateTransaction::commit(); };
 }
 
 void BitwigContext::createHostHandlers() {
@@ -140,6 +201,9 @@ void BitwigContext::createHostHandlers() {
     host_page_ = std::make_unique<handler::PageHostHandler>(state_, *protocol_, encoders());
     host_remote_control_ = std::make_unique<handler::RemoteControlHostHandler>(state_, *protocol_, encoders());
     host_last_clicked_ = std::make_unique<handler::LastClickedHostHandler>(state_, *protocol_, encoders());
+    host_plugin_->onSessionRestart = [this] {
+        if (host_remote_control_) host_remote_control_->resyncBatchSequence();
+    };
 
     host_midi_ = std::make_unique<handler::MidiHostHandler>(state_);
     onMidiNoteOn([this](uint8_t ch, uint8_t note, uint8_t vel) {
@@ -102,6 +102,18 @@ public:
     // Static resource loading (called by ContextManager during registration)
     static void loadResources();
 
+    /**
+     * @brief Attach a protocol recorder and/or a replay source
+     *
+     * Must be called before the context is initialized (contexts are created
+     * by the app). Both objects must outlive the context. Desktop builds use
+     * this for --capture / --replay; firmware never sets them.
+     */
+    static void setCapture(capture::Sink* sink, capture::Source* replay) {
+        capture_sink_ = sink;
+        replay_source_ = replay;
+    }
+
     BitwigContext() = default;
     ~BitwigContext() override;
 
@@ -148,6 +160,7 @@ protected:
     void onCleanup() override;
 
 private:
+    void logBatchStats(bool onlyIfChanged);
     void createProtocol();
     void createHostHandlers();
     void createInputHandlers();
@@ -158,8 +171,13 @@ private:
     // Members
     // =========================================================================
 
+    static inline capture::Sink* capture_sink_ = nullptr;
+    static inline capture::Source* replay_source_ = nullptr;
+
     state::BitwigState state_;
     std::unique_ptr<BitwigProtocol> protocol_;
+    uint32_t last_credit_ms_ = 0;  // Last FLOW_CREDIT sent (see FlowControlConfig)
+    uint32_t last_logged_batches_ = 0;  // Batch count at the last link stats line
     std::unique_ptr<oc::context::OverlayManager<bitwig::ui::OverlayType>> overlay_controller_;
 
     // Host Handlers (protocol → state)
@@ -80,6 +80,5 @@ inline void configureEncoderForParameter(oc::api::EncoderAPI& encoders,
 // =============================================================================
 
 using oc::util::wrapIndex;
-using oc::util::shouldPrefetch;
 
 }  // namespace bitwig::handler
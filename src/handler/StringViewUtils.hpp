@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+namespace bitwig::utils {
+
+/**
+ * @brief Null-terminated stack copy of a protocol string view
+ *
+ * Decoded messages expose strings as views into the received frame, which are
+ * not null-terminated. Signal string types take a C string, so this copies the
+ * view into a fixed stack buffer (no heap) for the duration of the expression.
+ *
+ * ## Usage
+ * @code
+ * slot.displayValue.set(CString(msg.displayValue).c_str());
+ * @endcode
+ *
+ * Wire strings are length-prefixed with a uint8, so 256 bytes always fits.
+ */
+class CString {
+public:
+    static constexpr size_t CAPACITY = 256;
+
+    explicit CString(std::string_view view) {
+        size_t len = view.size() < CAPACITY - 1 ? view.size() : CAPACITY - 1;
+        std::memcpy(buffer_, view.data(), len);
+        buffer_[len] = '\0';
+    }
+
+    const char* c_str() const { return buffer_; }
+
+private:
+    char buffer_[CAPACITY];
+};
+
+}  // namespace bitwig::utils
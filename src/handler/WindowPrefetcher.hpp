@@ -0,0 +1,124 @@
+#pragma once
+
+/**
+ * @file WindowPrefetcher.hpp
+ * @brief Velocity-aware window prefetch for the page/device/track selectors
+ *
+ * Selector lists are loaded in windows, contiguously from index 0
+ * (loadedUpTo). The window size is chosen per request from the measured link
+ * throughput (BitwigProtocol::listWindowSize()), so it is passed on each move.
+ *
+ * The fixed rule "request the next window when the cursor gets within
+ * Threshold of loadedUpTo" is outrun by a fast encoder spin: the cursor
+ * reaches rows whose window is still on its way.
+ *
+ * The prefetcher keeps an estimate of the cursor speed (items/s, reset after
+ * a pause) and looks ahead by the distance the cursor covers in one window
+ * round trip, on top of Threshold:
+ *
+ *   lead = Threshold + speed * ASSUMED_LATENCY_MS   (capped to MAX_LEAD_WINDOWS windows)
+ *
+ * Moving backward only needs the rows up to the cursor (after a wrap to the
+ * end of the list). At most MAX_IN_FLIGHT windows are requested ahead of
+ * loadedUpTo; a request left unanswered for REQUEST_TIMEOUT_MS is sent again.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+namespace bitwig::handler {
+
+template <uint8_t Threshold>
+class WindowPrefetcher {
+public:
+    static constexpr uint8_t MAX_IN_FLIGHT = 2;
+    static constexpr uint32_t ASSUMED_LATENCY_MS = 120;  // Host schedules windows 80 ms out, plus transport
+    static constexpr uint32_t REQUEST_TIMEOUT_MS = 500;
+    static constexpr uint32_t IDLE_MS = 250;             // Longer pause: speed starts over
+    static constexpr int MAX_LEAD_WINDOWS = 4;
+
+    /**
+     * @brief Record a cursor move and request the windows it needs
+     *
+     * @param cursor New item index (negative = not a list item, e.g. back button)
+     * @param delta Encoder delta of this move (sign = direction)
+     * @param windowSize Items per request (0 is treated as 1)
+     * @param request Called as request(startIndex, windowSize) for each window to fetch
+     * @return Number of windows requested
+     */
+    template <typename RequestFn>
+    uint8_t navigate(int cursor, int delta, uint8_t loadedUpTo, uint8_t totalCount, uint8_t windowSize,
+                     uint32_t nowMs, RequestFn&& request) {
+        windowSize_ = std::max<uint8_t>(windowSize, 1);
+        trackSpeed(delta, nowMs);
+        syncRequests(loadedUpTo, totalCount, nowMs);
+        if (cursor < 0 || totalCount == 0) return 0;
+
+        // Rows [0, needUpTo) must be loaded or requested
+        int lead = forward_ ? leadItems() : 0;
+        int needUpTo = std::min(cursor + lead + 1, static_cast<int>(totalCount));
+
+        uint8_t issued = 0;
+        while (requestedUpTo_ < needUpTo && inFlight(loadedUpTo) < MAX_IN_FLIGHT) {
+            request(static_cast<uint8_t>(requestedUpTo_), windowSize_);
+            requestedUpTo_ = std::min(requestedUpTo_ + windowSize_, static_cast<int>(totalCount));
+            lastRequestMs_ = nowMs;
+            ++issued;
+        }
+        return issued;
+    }
+
+    /// Items loaded ahead of the cursor at the current speed
+    int leadItems() const {
+        int lead = Threshold + static_cast<int>(speed_ * ASSUMED_LATENCY_MS / 1000.0f + 0.5f);
+        return std::min(lead, MAX_LEAD_WINDOWS * windowSize_);
+    }
+
+    /// Cursor speed estimate (items per second)
+    float speed() const { return speed_; }
+
+private:
+    static constexpr float SMOOTHING = 0.5f;
+
+    void trackSpeed(int delta, uint32_t nowMs) {
+        if (delta == 0) return;
+
+        uint32_t elapsed = nowMs - lastMoveMs_;
+        lastMoveMs_ = nowMs;
+        forward_ = delta > 0;
+        if (!moved_ || elapsed > IDLE_MS) {
+            moved_ = true;
+            speed_ = 0.0f;
+            return;
+        }
+
+        float instant = std::abs(delta) * 1000.0f / std::max<uint32_t>(elapsed, 1);
+        speed_ += SMOOTHING * (instant - speed_);
+    }
+
+    void syncRequests(uint8_t loadedUpTo, uint8_t totalCount, uint32_t nowMs) {
+        bool listReset = loadedUpTo < lastLoadedUpTo_;
+        bool timedOut = requestedUpTo_ > loadedUpTo && nowMs - lastRequestMs_ > REQUEST_TIMEOUT_MS;
+        if (listReset || timedOut || requestedUpTo_ < loadedUpTo || requestedUpTo_ > totalCount) {
+            requestedUpTo_ = loadedUpTo;
+        }
+        lastLoadedUpTo_ = loadedUpTo;
+    }
+
+    int inFlight(uint8_t loadedUpTo) const {
+        int pending = requestedUpTo_ - loadedUpTo;
+        return pending > 0 ? (pending + windowSize_ - 1) / windowSize_ : 0;
+    }
+
+    int requestedUpTo_ = 0;
+    uint8_t windowSize_ = 1;
+    uint8_t lastLoadedUpTo_ = 0;
+    uint32_t lastRequestMs_ = 0;
+    uint32_t lastMoveMs_ = 0;
+    float speed_ = 0.0f;
+    bool forward_ = true;
+    bool moved_ = false;
+};
+
+}  // namespace bitwig::handler
@@ -1,11 +1,12 @@
 #include "DeviceHostHandler.hpp"
 
 #include <array>
-#include <vector>
 
 #include <oc/log/Log.hpp>
 
 #include "handler/NestedIndexUtils.hpp"
+#include "handler/StringViewUtils.hpp"
+#include "protocol/FrontCoding.hpp"
 #include "state/Constants.hpp"
 
 namespace bitwig::handler {
@@ -14,6 +15,29 @@ using namespace Protocol;
 using namespace bitwig::state;
 constexpr auto BACK_TO_PARENT = BACK_TO_PARENT_TEXT;
 
+namespace {
+
+// Selector list helpers shared by DEVICE_LIST_WINDOW and cached chains
+// (device flags are staged: callers commit them once the list is updated)
+
+void resizeDeviceList(DeviceSelectorState& ds, uint8_t displaySize) {
+    ds.names.resize(displaySize);
+    ds.deviceTypes.resize(displaySize);
+    ds.flags.resize(displaySize);
+}
+
+void setDeviceAt(DeviceSelectorState& ds, uint8_t displayIdx, const DeviceChainCache::Device& dev) {
+    ds.names.setAt(displayIdx, dev.name);
+    ds.deviceTypes.setAt(displayIdx, dev.deviceType);
+    ds.flags.set(displayIdx, dev.childFlags | (dev.isEnabled ? DEVICE_FLAG_ENABLED : 0));
+}
+
+void setBackButton(DeviceSelectorState& ds) {
+    setDeviceAt(ds, 0, DeviceChainCache::Device{BACK_TO_PARENT, DeviceType::UNKNOWN, false, 0});
+}
+
+}  // namespace
+
 DeviceHostHandler::DeviceHostHandler(state::BitwigState& state, BitwigProtocol& protocol)
     : state_(state), protocol_(protocol) {
     setupProtocolCallbacks();
@@ -28,10 +52,11 @@ void DeviceHostHandler::setupProtocolCallbacks() {
         bool hasChildren = (msg.childrenTypes[0] | msg.childrenTypes[1] |
                            msg.childrenTypes[2] | msg.childrenTypes[3]) != 0;
 
-        state_.device.name.set(msg.deviceName.c_str());
+        auto& strings = protocol_.strings();
+        state_.device.name.set(utils::CString(strings.resolve(msg.deviceName)).c_str());
         state_.device.deviceType.set(msg.deviceType);
         state_.device.enabled.set(msg.isEnabled);
-        state_.device.pageName.set(msg.pageInfo.devicePageName.c_str());
+        state_.device.pageName.set(utils::CString(strings.resolve(msg.pageInfo.devicePageName)).c_str());
         state_.device.hasChildren.set(hasChildren);
 
         // Mark all parameters as loading
@@ -40,13 +65,27 @@ void DeviceHostHandler::setupProtocolCallbacks() {
         }
 
         // Reset page selector state for new device (windowed loading)
-        state_.pageSelector.names.clear();
-        state_.pageSelector.totalCount.set(0);
-        state_.pageSelector.loadedUpTo.set(0);
+        auto& pages = state_.pageSelector;
+        pages.names.clear();
+        pages.totalCount.set(0);
+        pages.loadedUpTo.set(0);
+
+        // Device visited recently with the same page list: names come from the cache
+        uint8_t cached = pages.cache.activate(msg.deviceIdentity, msg.pageNamesHash,
+                                              [&pages](uint8_t index, std::string_view name) {
+                                                  pages.names.setAt(index, name);
+                                              });
+        if (cached > 0) {
+            uint8_t total = msg.pageInfo.devicePageCount;
+            pages.totalCount.set(total);
+            pages.loadedUpTo.set(cached < total ? cached : total);
+            pages.selectedIndex.set(msg.pageInfo.devicePageIndex);
+            return;
+        }
 
         // Preload first window of page names for immediate availability
         OC_LOG_INFO("[DeviceHostHandler] Sending RequestDevicePageNamesWindow(0)");
-        protocol_.requestDevicePageNamesWindow(0);
+        protocol_.requestDevicePageNamesWindow(0, protocol_.listWindowSize());
     };
 
     protocol_.onDeviceEnabledState = [this](const DeviceEnabledStateMessage& msg) {
@@ -56,8 +95,50 @@ void DeviceHostHandler::setupProtocolCallbacks() {
         }
 
         int displayIndex = utils::toDisplayIndex(msg.deviceIndex, state_.deviceSelector.isNested.get());
-        if (displayIndex >= 0 && displayIndex < MAX_DEVICES) {
-            state_.deviceSelector.deviceStates[displayIndex].set(msg.isEnabled);
+        if (displayIndex >= 0) {
+            auto& flags = state_.deviceSelector.flags;
+            flags.setFlag(static_cast<size_t>(displayIndex), DEVICE_FLAG_ENABLED, msg.isEnabled);
+            flags.commit();
+        }
+        state_.deviceSelector.cache.setEnabled(msg.deviceIndex, msg.isEnabled);
+    };
+
+    // Chain announced (track switch, chain edit, first window): rebuild the list
+    // from the cache if this version was seen recently, else wait for (or ask
+    // for) the first window
+    protocol_.onDeviceChainStamp = [this](const DeviceChainStampMessage& msg) {
+        auto& ds = state_.deviceSelector;
+        if (!ds.cache.activate(msg.chainIdentity, msg.chainStamp)) {
+            if (!msg.windowFollows) {
+                protocol_.requestDeviceListWindow(0, protocol_.listWindowSize());
+            }
+            return;
+        }
+
+        ds.loading.set(false);
+        ds.totalCount.set(msg.deviceCount);
+        ds.isNested.set(msg.isNested);
+        resizeDeviceList(ds, msg.deviceCount + (msg.isNested ? 1 : 0));
+        if (msg.isNested) setBackButton(ds);
+
+        bool activeHasChildren = false;
+        uint8_t cached = ds.cache.restore([&](uint8_t index, const DeviceChainCache::Device& dev) {
+            uint8_t displayIdx = msg.isNested ? index + 1 : index;
+            if (displayIdx < MAX_DEVICES) setDeviceAt(ds, displayIdx, dev);
+            if (index == msg.deviceIndex) activeHasChildren = dev.childFlags != 0;
+        });
+        ds.flags.commit();
+
+        uint8_t loadedUpTo = cached < msg.deviceCount ? cached : msg.deviceCount;
+        ds.loadedUpTo.set(loadedUpTo);
+        ds.currentIndex.set(msg.isNested ? msg.deviceIndex + 1 : msg.deviceIndex);
+        ds.activeDeviceIndex.set(msg.deviceIndex);
+        ds.showingChildren.set(false);
+        if (msg.deviceIndex < cached) state_.device.hasChildren.set(activeHasChildren);
+
+        // Cached part does not reach the active device (names overflowed the cache)
+        if (msg.deviceIndex >= loadedUpTo && loadedUpTo < msg.deviceCount) {
+            protocol_.requestDeviceListWindow(loadedUpTo, protocol_.listWindowSize());
         }
     };
 
@@ -77,19 +158,18 @@ void DeviceHostHandler::setupProtocolCallbacks() {
 
         // On first window, resize to truncate old data if new list is shorter
         if (startIdx == 0) {
-            uint8_t displaySize = msg.deviceCount + (msg.isNested ? 1 : 0);
-            state_.deviceSelector.names.resize(displaySize);
-            state_.deviceSelector.deviceTypes.resize(displaySize);
-            state_.deviceSelector.hasSlots.resize(displaySize);
-            state_.deviceSelector.hasLayers.resize(displaySize);
-            state_.deviceSelector.hasDrums.resize(displaySize);
+            resizeDeviceList(state_.deviceSelector, msg.deviceCount + (msg.isNested ? 1 : 0));
             state_.deviceSelector.loadedUpTo.set(0);  // Reset for new list
         }
 
-        // Accumulate data at absolute indices
-        for (uint8_t i = 0; i < LIST_WINDOW_SIZE; i++) {
+        // Accumulate data at absolute indices (names rebuilt if front coded)
+        frontcoding::NameDecoder names(msg.deviceNamePrefixes.begin(), msg.deviceNamePrefixes.size());
+        uint8_t received = 0;
+        for (uint8_t i = 0; i < msg.devices.size(); i++) {
             const auto& dev = msg.devices[i];
             if (dev.deviceName.empty()) break;  // End of valid data
+            received = i + 1;
+            std::string_view name = protocol_.strings().resolve(names.next(dev.deviceName));
 
             uint8_t absoluteIdx = startIdx + i;
 
@@ -97,29 +177,20 @@ void DeviceHostHandler::setupProtocolCallbacks() {
             uint8_t displayIdx = msg.isNested ? absoluteIdx + 1 : absoluteIdx;
             if (displayIdx >= MAX_DEVICES) continue;
 
-            // Accumulate at display index
-            state_.deviceSelector.names.setAt(displayIdx, dev.deviceName);
-            state_.deviceSelector.deviceTypes.setAt(displayIdx, dev.deviceType);
-            state_.deviceSelector.deviceStates[displayIdx].set(dev.isEnabled);
-
-            uint8_t flags = getChildTypeFlags(dev.childrenTypes);
-            state_.deviceSelector.hasSlots.setAt(displayIdx, (flags & CHILD_TYPE_SLOTS) != 0);
-            state_.deviceSelector.hasLayers.setAt(displayIdx, (flags & CHILD_TYPE_LAYERS) != 0);
-            state_.deviceSelector.hasDrums.setAt(displayIdx, (flags & CHILD_TYPE_DRUMS) != 0);
+            // Accumulate at display index, and in the chain cache (unresolved names are not cached)
+            DeviceChainCache::Device device{name, dev.deviceType, dev.isEnabled, getChildTypeFlags(dev.childrenTypes)};
+            setDeviceAt(state_.deviceSelector, displayIdx, device);
+            if (!name.empty()) state_.deviceSelector.cache.put(absoluteIdx, device);
         }
 
         // Add back button if nested and this is first window
         if (msg.isNested && startIdx == 0) {
-            state_.deviceSelector.names.setAt(0, BACK_TO_PARENT);
-            state_.deviceSelector.deviceTypes.setAt(0, DeviceType::UNKNOWN);
-            state_.deviceSelector.deviceStates[0].set(false);
-            state_.deviceSelector.hasSlots.setAt(0, false);
-            state_.deviceSelector.hasLayers.setAt(0, false);
-            state_.deviceSelector.hasDrums.setAt(0, false);
+            setBackButton(state_.deviceSelector);
         }
+        state_.deviceSelector.flags.commit();  // One notification for the whole window
 
-        // Update loadedUpTo (highest index we've received)
-        uint8_t newLoadedUpTo = startIdx + LIST_WINDOW_SIZE;
+        // Update loadedUpTo (highest index we've received, windows vary in size)
+        uint8_t newLoadedUpTo = startIdx + received;
         if (newLoadedUpTo > msg.deviceCount) {
             newLoadedUpTo = msg.deviceCount;  // Cap at total
         }
@@ -141,12 +212,12 @@ void DeviceHostHandler::setupProtocolCallbacks() {
         if (msg.deviceIndex >= currentLoadedUpTo &&
             currentLoadedUpTo < msg.deviceCount) {
             // Request next window to cover current selection
-            protocol_.requestDeviceListWindow(currentLoadedUpTo);
+            protocol_.requestDeviceListWindow(currentLoadedUpTo, protocol_.listWindowSize());
         }
 
         // Update hasChildren for active device
         if (msg.deviceIndex < msg.deviceCount && msg.deviceIndex >= startIdx &&
-            msg.deviceIndex < startIdx + LIST_WINDOW_SIZE) {
+            msg.deviceIndex < startIdx + received) {
             uint8_t localIdx = msg.deviceIndex - startIdx;
             uint8_t flags = getChildTypeFlags(msg.devices[localIdx].childrenTypes);
             bool hasChildren = (flags & (CHILD_TYPE_SLOTS | CHILD_TYPE_LAYERS | CHILD_TYPE_DRUMS)) != 0;
@@ -155,19 +226,20 @@ void DeviceHostHandler::setupProtocolCallbacks() {
     };
 
     protocol_.onDeviceChildren = [this](const DeviceChildrenMessage& msg) {
-        std::vector<std::string> names;
-        std::vector<uint8_t> types;
+        std::array<std::string_view, MAX_CHILDREN> names;
+        std::array<uint8_t, MAX_CHILDREN> types;
 
-        names.push_back(BACK_TO_PARENT_TEXT);
-        types.push_back(0);
+        size_t count = 0;
+        names[count] = BACK_TO_PARENT_TEXT;
+        types[count++] = 0;
 
-        for (uint8_t i = 0; i < msg.childrenCount; i++) {
-            names.emplace_back(msg.children[i].childName);
-            types.push_back(msg.children[i].itemType);
+        for (uint8_t i = 0; i < msg.childrenCount && count < MAX_CHILDREN; i++) {
+            names[count] = msg.children[i].childName;
+            types[count++] = msg.children[i].itemType;
         }
 
-        state_.deviceSelector.childrenNames.set(names.data(), names.size());
-        state_.deviceSelector.childrenTypes.set(types.data(), types.size());
+        state_.deviceSelector.childrenNames.set(names.data(), count);
+        state_.deviceSelector.childrenTypes.set(types.data(), count);
         state_.deviceSelector.currentIndex.set(1);  // Reset to first child (index 0 = back button)
         state_.deviceSelector.showingChildren.set(true);
         // NOTE: visibility is controlled by input handlers, not host handlers
@@ -5,6 +5,7 @@
 #include <config/App.hpp>
 #include "config/LastClickedConfig.hpp"
 #include "handler/InputUtils.hpp"
+#include "handler/StringViewUtils.hpp"
 
 namespace bitwig::handler {
 
@@ -32,9 +33,9 @@ void LastClickedHostHandler::setupProtocolCallbacks() {
 void LastClickedHostHandler::handleLastClickedUpdate(const LastClickedUpdateMessage& msg) {
     auto& lc = state_.lastClicked;
 
-    lc.name.set(msg.parameterName);
+    lc.name.set(utils::CString(msg.parameterName).c_str());
     lc.value.set(msg.parameterValue);
-    lc.displayValue.set(msg.displayValue);
+    lc.displayValue.set(utils::CString(msg.displayValue).c_str());
     lc.parameterType.set(msg.parameterType);
     lc.discreteCount.set(msg.discreteValueCount);
     lc.exists.set(msg.parameterExists);
@@ -52,7 +53,7 @@ void LastClickedHostHandler::handleLastClickedValueState(const LastClickedValueS
     const float previousValue = lc.value.get();
 
     lc.value.set(msg.parameterValue);
-    lc.displayValue.set(msg.displayValue);
+    lc.displayValue.set(utils::CString(msg.displayValue).c_str());
 
     if (std::abs(previousValue - msg.parameterValue) >= config::LastClickedConfig::POSITION_RESYNC_EPSILON) {
         encoders_.setPosition(EncoderID::OPT, msg.parameterValue);
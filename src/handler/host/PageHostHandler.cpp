@@ -3,6 +3,8 @@
 #include <array>
 
 #include "handler/InputUtils.hpp"
+#include "handler/StringViewUtils.hpp"
+#include "protocol/FrontCoding.hpp"
 #include "state/Constants.hpp"
 
 namespace bitwig::handler {
@@ -45,18 +47,23 @@ void PageHostHandler::setupProtocolCallbacks() {
         // Update total count
         state_.pageSelector.totalCount.set(msg.devicePageCount);
 
-        // Accumulate names at absolute indices
+        // Accumulate names at absolute indices (rebuilt if front coded)
         uint8_t startIdx = msg.pageStartIndex;
+        frontcoding::NameDecoder names(msg.pageNamePrefixes.begin(), msg.pageNamePrefixes.size());
+        uint8_t received = 0;
         for (size_t i = 0; i < msg.pageNames.size(); i++) {
             if (msg.pageNames[i].empty()) break;  // End of valid data
+            received = static_cast<uint8_t>(i + 1);
+            std::string_view name = protocol_.strings().resolve(names.next(msg.pageNames[i]));
             auto absoluteIdx = static_cast<uint8_t>(startIdx + i);
             if (absoluteIdx < MAX_PAGES) {
-                state_.pageSelector.names.setAt(absoluteIdx, msg.pageNames[i]);
+                state_.pageSelector.names.setAt(absoluteIdx, name);
+                if (!name.empty()) state_.pageSelector.cache.put(absoluteIdx, name);  // Unresolved: not cached
             }
         }
 
-        // Update loadedUpTo (highest index we've received)
-        uint8_t newLoadedUpTo = startIdx + LIST_WINDOW_SIZE;
+        // Update loadedUpTo (highest index we've received, windows vary in size)
+        uint8_t newLoadedUpTo = startIdx + received;
         if (newLoadedUpTo > msg.devicePageCount) {
             newLoadedUpTo = msg.devicePageCount;  // Cap at total
         }
@@ -74,27 +81,29 @@ void PageHostHandler::setupProtocolCallbacks() {
     protocol_.onDevicePageChange = [this](const DevicePageChangeMessage& msg) {
         updateRemoteControlEncoderModes(msg.remoteControls);
 
-        state_.device.pageName.set(msg.pageInfo.devicePageName.c_str());
+        auto& strings = protocol_.strings();
+        state_.device.pageName.set(utils::CString(strings.resolve(msg.pageInfo.devicePageName)).c_str());
 
         // Local buffer for discrete values (stack allocated, safe in single-threaded context)
         std::array<std::string, state::MAX_DISCRETE_VALUES> tempDiscreteValues;
 
         for (uint8_t i = 0; i < PARAMETER_COUNT && i < msg.remoteControls.size(); i++) {
             auto& slot = state_.parameters.slots[i];
+            auto& hot = state_.parameters.hot;
             const auto& rc = msg.remoteControls[i];
 
             // IMPORTANT: Set metadata BEFORE type!
             // When type changes, ensureWidgetForType() reads these values to create the widget.
             // If type is set first, discreteCount would still have old/default value.
             slot.discreteCount.set(rc.discreteValueCount);
-            slot.currentValueIndex.set(rc.currentValueIndex);
+            hot.setValueIndex(i, rc.currentValueIndex);
             slot.origin.set(rc.parameterOrigin);
 
             // Update discrete values BEFORE type (needed for LIST widgets)
             size_t count = 0;
             for (const auto& dv : rc.discreteValueNames) {
                 if (!dv.empty() && count < state::MAX_DISCRETE_VALUES) {
-                    tempDiscreteValues[count++] = dv;
+                    tempDiscreteValues[count++] = strings.resolve(dv);
                 }
             }
             slot.discreteValues.set(tempDiscreteValues.data(), count);
@@ -103,20 +112,20 @@ void PageHostHandler::setupProtocolCallbacks() {
             slot.type.set(rc.parameterType);
 
             // Set remaining display properties
-            slot.displayValue.set(rc.displayValue.c_str());
-            slot.value.set(rc.parameterValue);
-            slot.name.set(rc.parameterName.c_str());
+            slot.displayValue.set(utils::CString(rc.displayValue).c_str());
+            hot.setValue(i, rc.parameterValue);
+            slot.name.set(utils::CString(strings.resolve(rc.parameterName)).c_str());
             slot.visible.set(rc.parameterExists);
             slot.loading.set(false);
             slot.metadataSet.set(true);
 
             // Modulation state - controls ribbon visibility
             // Store offset (not absolute value) so ribbon follows optimistic updates
-            slot.isModulated.set(rc.isModulated);
-            slot.modulationOffset.set(rc.modulatedValue - rc.parameterValue);
+            hot.setModulated(i, rc.isModulated);
+            hot.setModulationOffset(i, rc.modulatedValue - rc.parameterValue);
 
             // Automation state
-            slot.hasAutomation.set(rc.hasAutomation);
+            hot.setAutomation(i, rc.hasAutomation);
         }
     };
 }
@@ -9,11 +9,18 @@ using namespace Protocol;
 PluginHostHandler::PluginHostHandler(state::BitwigState& state, BitwigProtocol& protocol)
     : state_(state), protocol_(protocol) {
     setupProtocolCallbacks();
-    protocol_.requestHostStatus();
+    protocol_.requestHostStatus(true);
 }
 
 void PluginHostHandler::setupProtocolCallbacks() {
     protocol_.onHostInitialized = [this](const HostInitializedMessage& msg) {
+        // Host confirms (or declines) compact framing - applies even on resync
+        protocol_.setCompactFrames(msg.compactFrames);
+
+        // Host restarts its string dictionary and batch sequence with every HOST_INITIALIZED
+        protocol_.strings().clear();
+        if (onSessionRestart) onSessionRestart();
+
         if (state_.host.connected.get()) {
             OC_LOG_WARN("[HostPlugin] Already connected, ignoring duplicate");
             return;
@@ -22,15 +29,20 @@ void PluginHostHandler::setupProtocolCallbacks() {
         OC_LOG_INFO("[HostPlugin] Host connected={}", msg.isHostActive);
         state_.host.connected.set(msg.isHostActive);
 
+        // New connection, possibly over another path: window sizes start from the default
+        protocol_.linkMeter().reset();
+
         if (msg.isHostActive) {
             // Reset all selector caches for fresh windowed loading
             state_.deviceSelector.names.clear();
             state_.deviceSelector.totalCount.set(0);
             state_.deviceSelector.loadedUpTo.set(0);
+            state_.deviceSelector.cache.clear();  // Host starts its mirror over too
 
             state_.pageSelector.names.clear();
             state_.pageSelector.totalCount.set(0);
             state_.pageSelector.loadedUpTo.set(0);
+            state_.pageSelector.cache.deactivate();  // Re-activated by the next DEVICE_CHANGE_HEADER
 
             state_.trackSelector.names.clear();
             state_.trackSelector.totalCount.set(0);
@@ -38,14 +50,16 @@ void PluginHostHandler::setupProtocolCallbacks() {
 
             // Request initial windows (uses windowed loading internally)
             OC_LOG_INFO("[HostPlugin] Requesting initial windows");
-            protocol_.requestDeviceListWindow(0);
-            protocol_.requestDevicePageNamesWindow(0);
-            protocol_.requestTrackListWindow(0);
+            protocol_.requestDeviceListWindow(0, protocol_.listWindowSize());
+            protocol_.requestDevicePageNamesWindow(0, protocol_.listWindowSize());
+            protocol_.requestTrackListWindow(0, protocol_.listWindowSize());
         }
     };
 
     protocol_.onHostDeactivated = [this](const HostDeactivatedMessage&) {
         OC_LOG_INFO("[HostPlugin] Host disconnected");
+        protocol_.setCompactFrames(false);
+        if (onSessionRestart) onSessionRestart();
         state_.host.connected.set(false);
         state_.resetAll();
     };
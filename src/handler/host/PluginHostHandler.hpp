@@ -21,7 +21,8 @@ namespace bitwig::handler {
  * - HostDeactivatedMessage
  *
  * Updates: state_.host.connected
- * Side effects: Requests initial data on connect, resets state on disconnect
+ * Side effects: Requests initial data on connect, resets state on disconnect,
+ * calls onSessionRestart on both (the host restarts its per-session counters)
  */
 class PluginHostHandler {
 public:
@@ -32,6 +33,9 @@ public:
     PluginHostHandler(const PluginHostHandler&) = delete;
     PluginHostHandler& operator=(const PluginHostHandler&) = delete;
 
+    /// HOST_INITIALIZED or HOST_DEACTIVATED (e.g. to resync the batch sequence)
+    Protocol::InlineCallback<void()> onSessionRestart;
+
 private:
     void setupProtocolCallbacks();
 
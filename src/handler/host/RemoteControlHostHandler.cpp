@@ -3,7 +3,10 @@
 #include <algorithm>
 #include <cmath>
 
+#include <oc/log/Log.hpp>
+
 #include "handler/InputUtils.hpp"
+#include "handler/StringViewUtils.hpp"
 
 namespace bitwig::handler {
 
@@ -21,18 +24,20 @@ void RemoteControlHostHandler::setupProtocolCallbacks() {
     protocol_.onDeviceRemoteControlUpdate = [this](const DeviceRemoteControlUpdateMessage& msg) {
         if (msg.remoteControlIndex >= PARAMETER_COUNT) return;
 
-        auto& slot = state_.parameters.slots[msg.remoteControlIndex];
+        uint8_t index = msg.remoteControlIndex;
+        auto& slot = state_.parameters.slots[index];
+        auto& hot = state_.parameters.hot;
 
         slot.type.set(msg.parameterType);
         slot.discreteCount.set(msg.discreteValueCount);
-        slot.currentValueIndex.set(msg.currentValueIndex);
+        hot.setValueIndex(index, msg.currentValueIndex);
         slot.origin.set(msg.parameterOrigin);
-        slot.displayValue.set(msg.displayValue.c_str());
-        slot.name.set(msg.parameterName.c_str());
-        slot.value.set(msg.parameterValue);
+        slot.displayValue.set(utils::CString(msg.displayValue).c_str());
+        slot.name.set(utils::CString(msg.parameterName).c_str());
+        hot.setValue(index, msg.parameterValue);
         slot.visible.set(msg.parameterExists);
         slot.loading.set(false);
-        slot.hasAutomation.set(msg.hasAutomation);
+        hot.setAutomation(index, msg.hasAutomation);
 
         // Configure encoder
         auto encoderId = getEncoderIdForParameter(msg.remoteControlIndex);
@@ -54,11 +59,11 @@ void RemoteControlHostHandler::setupProtocolCallbacks() {
         size_t count = 0;
         for (const auto& dv : msg.discreteValueNames) {
             if (!dv.empty() && count < state::MAX_DISCRETE_VALUES) {
-                tempValues[count++] = dv;
+                tempValues[count++] = protocol_.strings().resolve(dv);
             }
         }
         slot.discreteValues.set(tempValues.data(), count);
-        slot.currentValueIndex.set(msg.currentValueIndex);
+        state_.parameters.hot.setValueIndex(msg.remoteControlIndex, msg.currentValueIndex);
     };
 
     // Value state notification from host (confirmation with display value)
@@ -69,8 +74,8 @@ void RemoteControlHostHandler::setupProtocolCallbacks() {
         auto encoderId = getEncoderIdForParameter(msg.remoteControlIndex);
 
         // Update value and display
-        slot.value.set(msg.parameterValue);
-        slot.displayValue.set(msg.displayValue.c_str());
+        state_.parameters.hot.setValue(msg.remoteControlIndex, msg.parameterValue);
+        slot.displayValue.set(utils::CString(msg.displayValue).c_str());
 
         // Update encoder position
         if (encoderId != EncoderID{0}) {
@@ -80,7 +85,7 @@ void RemoteControlHostHandler::setupProtocolCallbacks() {
 
     protocol_.onDeviceRemoteControlNameChange = [this](const DeviceRemoteControlNameChangeMessage& msg) {
         if (msg.remoteControlIndex >= PARAMETER_COUNT) return;
-        state_.parameters.slots[msg.remoteControlIndex].name.set(msg.parameterName.c_str());
+        state_.parameters.slots[msg.remoteControlIndex].name.set(utils::CString(msg.parameterName).c_str());
     };
 
     protocol_.onDeviceRemoteControlOriginChange = [this](const DeviceRemoteControlOriginChangeMessage& msg) {
@@ -89,61 +94,99 @@ void RemoteControlHostHandler::setupProtocolCallbacks() {
     };
 
     // Combined batch: values + modulated values in single synchronized update
+    // Sparse: values/displayValues are packed for dirtyMask bits, modulatedValues
+    // for modulatedMask bits (ascending slot order). Only those slots are touched.
     protocol_.onDeviceRemoteControlsBatch =
         [this](const DeviceRemoteControlsBatchMessage& msg) {
+            // A reordered batch is applied only to the slots no newer batch has
+            // written: it may carry the only update of the others
+            bool stale = false;
+            switch (batch_sequence_.accept(msg.sequenceNumber)) {
+                case SequenceTracker::Verdict::STALE:
+                    OC_LOG_DEBUG("[RemoteControl] stale batch {}", msg.sequenceNumber);
+                    stale = true;
+                    break;
+                case SequenceTracker::Verdict::GAP:
+                    OC_LOG_DEBUG("[RemoteControl] batch gap before {} (lost total {})",
+                                 msg.sequenceNumber, batch_sequence_.stats().lost);
+                    break;
+                case SequenceTracker::Verdict::RESYNC:
+                    slot_sequences_.reset();
+                    break;
+                default: break;
+            }
 
-            for (size_t i = 0; i < PARAMETER_COUNT; ++i) {
-                auto& slot = state_.parameters.slots[i];
-
-                // Update automation state from host (source of truth)
-                bool hasAutomation = (msg.hasAutomationMask >> i) & 1;
-                slot.hasAutomation.set(hasAutomation);
-
-                // Update modulation offset (always, for ribbon display)
-                // Store offset so ribbon follows optimistic value updates
-                slot.modulationOffset.set(msg.modulatedValues[i] - slot.value.get());
+            // Numeric state goes to the dense hot block; slot metadata is only
+            // read (type, discrete count) except for the display string
+            auto& slots = state_.parameters.slots;
+            auto& hot = state_.parameters.hot;
+
+            // Update automation state from host (source of truth, whole mask: newest wins)
+            if (!stale) hot.setAutomationMask(msg.hasAutomationMask);
+
+            size_t valueIndex = 0;
+            size_t modulatedIndex = 0;
+            for (uint8_t bits = msg.dirtyMask | msg.modulatedMask; bits != 0; bits &= bits - 1) {
+                size_t i = __builtin_ctz(bits);
+                if (i >= PARAMETER_COUNT) break;
+                auto& slot = slots[i];
+                uint8_t bit = 1 << i;
+
+                // Written by a newer batch: skip its packed entries
+                if (!slot_sequences_.apply(i, msg.sequenceNumber)) {
+                    if (msg.dirtyMask & bit) ++valueIndex;
+                    if (msg.modulatedMask & bit) ++modulatedIndex;
+                    continue;
+                }
 
                 // Update value only if dirty in this batch
-                if (msg.dirtyMask & (1 << i)) {
-                    bool isEcho = msg.echoMask & (1 << i);
+                if ((msg.dirtyMask & bit) && valueIndex < msg.values.size()) {
+                    bool isEcho = msg.echoMask & bit;
+                    float value = msg.values[valueIndex];
+                    std::string_view displayValue =
+                        valueIndex < msg.displayValues.size() ? msg.displayValues[valueIndex] : std::string_view{};
+                    ++valueIndex;
 
                     // Always update the formatted display value from host when available.
                     // For KNOB echoes we keep the optimistic numeric value, but we still need
                     // the authoritative Bitwig-formatted string for the centered text.
-                    if (!msg.displayValues[i].empty()) {
-                        slot.displayValue.set(msg.displayValues[i].c_str());
+                    if (!displayValue.empty()) {
+                        slot.displayValue.set(utils::CString(displayValue).c_str());
                     }
 
-                    if (isEcho) {
-                        // Echo: skip value update for KNOB (optimistic already applied)
-                        if (slot.type.get() == ParameterType::KNOB) continue;
-                    }
-
-                    float value = msg.values[i];
-
-                    // Update value
-                    slot.value.set(value);
-
-                    // For LIST/BUTTON parameters: update currentValueIndex
-                    auto paramType = slot.type.get();
-                    if (paramType == ParameterType::LIST || paramType == ParameterType::BUTTON) {
-                        int16_t count = slot.discreteCount.get();
-                        if (count > 1) {
-                            // Calculate index from normalized value
-                            int index = static_cast<int>(std::round(value * (count - 1)));
-                            index = std::clamp(index, 0, count - 1);
-                            slot.currentValueIndex.set(static_cast<uint8_t>(index));
+                    // Echo: skip value update for KNOB (optimistic already applied)
+                    if (!isEcho || slot.type.get() != ParameterType::KNOB) {
+                        // Update value
+                        hot.setValue(i, value);
+
+                        // For LIST/BUTTON parameters: update currentValueIndex
+                        auto paramType = slot.type.get();
+                        if (paramType == ParameterType::LIST || paramType == ParameterType::BUTTON) {
+                            int16_t count = slot.discreteCount.get();
+                            if (count > 1) {
+                                // Calculate index from normalized value
+                                int index = static_cast<int>(std::round(value * (count - 1)));
+                                index = std::clamp(index, 0, count - 1);
+                                hot.setValueIndex(i, static_cast<uint8_t>(index));
+                            }
                         }
-                    }
 
-                    // Update encoder position for non-echo
-                    if (!isEcho) {
-                        auto encoderId = getEncoderIdForParameter(i);
-                        if (encoderId != EncoderID{0}) {
-                            encoders_.setPosition(encoderId, value);
+                        // Update encoder position for non-echo
+                        if (!isEcho) {
+                            auto encoderId = getEncoderIdForParameter(i);
+                            if (encoderId != EncoderID{0}) {
+                                encoders_.setPosition(encoderId, value);
+                            }
                         }
                     }
                 }
+
+                // Update modulation offset (after the value, for ribbon display)
+                // Store offset so ribbon follows optimistic value updates
+                if ((msg.modulatedMask & bit) && modulatedIndex < msg.modulatedValues.size()) {
+                    float modulated = msg.modulatedValues[modulatedIndex++];
+                    hot.setModulationOffset(i, modulated - hot.get().value(i));
+                }
             }
         };
 
@@ -151,7 +194,7 @@ void RemoteControlHostHandler::setupProtocolCallbacks() {
     protocol_.onDeviceRemoteControlIsModulatedChange =
         [this](const DeviceRemoteControlIsModulatedChangeMessage& msg) {
             if (msg.remoteControlIndex >= PARAMETER_COUNT) return;
-            state_.parameters.slots[msg.remoteControlIndex].isModulated.set(msg.isModulated);
+            state_.parameters.hot.setModulated(msg.remoteControlIndex, msg.isModulated);
         };
 
     // Note: hasAutomation and automationActive are now updated via batch message
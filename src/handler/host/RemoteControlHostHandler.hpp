@@ -11,6 +11,8 @@
  * - RemoteControlValueChange (value/display update from host)
  * - RemoteControlNameChange (parameter name update)
  * - RemoteControlModulatedValueChange (modulation offset for ribbon)
+ * - RemoteControlsBatch (sequence-checked per slot: a reordered batch only
+ *   applies the slots no newer batch wrote; gaps counted)
  *
  * @see PageHostHandler for bulk parameter init on page change
  * @see DeviceHostHandler for device info/list
@@ -19,6 +21,7 @@
 #include <oc/api/EncoderAPI.hpp>
 
 #include "protocol/BitwigProtocol.hpp"
+#include "protocol/SequenceTracker.hpp"
 #include "state/BitwigState.hpp"
 
 namespace bitwig::handler {
@@ -40,12 +43,23 @@ public:
     RemoteControlHostHandler(const RemoteControlHostHandler&) = delete;
     RemoteControlHostHandler& operator=(const RemoteControlHostHandler&) = delete;
 
+    /// Batch link counters (received / stale / lost), for debug output
+    const SequenceStats& batchStats() const { return batch_sequence_.stats(); }
+
+    /// Accept the next batch sequence as-is (host restarted its counter)
+    void resyncBatchSequence() {
+        batch_sequence_.resync();
+        slot_sequences_.reset();
+    }
+
 private:
     void setupProtocolCallbacks();
 
     state::BitwigState& state_;
     BitwigProtocol& protocol_;
     oc::api::EncoderAPI& encoders_;
+    SequenceTracker batch_sequence_;
+    SlotSequences<PARAMETER_COUNT> slot_sequences_;
 };
 
 }  // namespace bitwig::handler
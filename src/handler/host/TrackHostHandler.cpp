@@ -1,6 +1,8 @@
 #include "TrackHostHandler.hpp"
 
 #include "handler/NestedIndexUtils.hpp"
+#include "handler/StringViewUtils.hpp"
+#include "protocol/FrontCoding.hpp"
 #include "state/Constants.hpp"
 
 namespace bitwig::handler {
@@ -16,7 +18,7 @@ TrackHostHandler::TrackHostHandler(state::BitwigState& state, BitwigProtocol& pr
 
 void TrackHostHandler::setupProtocolCallbacks() {
     protocol_.onTrackChange = [this](const TrackChangeMessage& msg) {
-        state_.currentTrack.name.set(msg.trackName.c_str());
+        state_.currentTrack.name.set(utils::CString(msg.trackName).c_str());
         state_.currentTrack.color.set(msg.color);
         state_.currentTrack.trackType.set(msg.trackType);
     };
@@ -38,13 +40,18 @@ void TrackHostHandler::setupProtocolCallbacks() {
             state_.trackSelector.names.resize(displaySize);
             state_.trackSelector.trackTypes.resize(displaySize);
             state_.trackSelector.trackColors.resize(displaySize);
+            state_.trackSelector.flags.resize(displaySize);
             state_.trackSelector.loadedUpTo.set(0);  // Reset for new list
         }
 
-        // Accumulate data at absolute indices
-        for (uint8_t i = 0; i < LIST_WINDOW_SIZE; i++) {
+        // Accumulate data at absolute indices (names rebuilt if front coded)
+        frontcoding::NameDecoder names(msg.trackNamePrefixes.begin(), msg.trackNamePrefixes.size());
+        uint8_t received = 0;
+        for (uint8_t i = 0; i < msg.tracks.size(); i++) {
             const auto& trk = msg.tracks[i];
             if (trk.trackName.empty()) break;  // End of valid data
+            received = i + 1;
+            std::string_view name = protocol_.strings().resolve(names.next(trk.trackName));
 
             uint8_t absoluteIdx = startIdx + i;
 
@@ -53,11 +60,11 @@ void TrackHostHandler::setupProtocolCallbacks() {
             if (displayIdx >= MAX_TRACKS) continue;
 
             // Accumulate at display index
-            state_.trackSelector.names.setAt(displayIdx, trk.trackName);
+            state_.trackSelector.names.setAt(displayIdx, name);
             state_.trackSelector.trackTypes.setAt(displayIdx, trk.trackType);
             state_.trackSelector.trackColors.setAt(displayIdx, trk.color);
-            state_.trackSelector.muteStates[displayIdx].set(trk.isMute);
-            state_.trackSelector.soloStates[displayIdx].set(trk.isSolo);
+            state_.trackSelector.flags.set(
+                displayIdx, TrackFlags::pack(trk.isMute, trk.isSolo, trk.isMutedBySolo, trk.isArm));
         }
 
         // Add back button if nested and this is first window
@@ -65,12 +72,12 @@ void TrackHostHandler::setupProtocolCallbacks() {
             state_.trackSelector.names.setAt(0, BACK_TO_PARENT);
             state_.trackSelector.trackTypes.setAt(0, TrackType::AUDIO);
             state_.trackSelector.trackColors.setAt(0, 0xFFFFFF);
-            state_.trackSelector.muteStates[0].set(false);
-            state_.trackSelector.soloStates[0].set(false);
+            state_.trackSelector.flags.set(0, 0);
         }
+        state_.trackSelector.flags.commit();  // One notification for the whole window
 
-        // Update loadedUpTo (highest index we've received)
-        uint8_t newLoadedUpTo = startIdx + LIST_WINDOW_SIZE;
+        // Update loadedUpTo (highest index we've received, windows vary in size)
+        uint8_t newLoadedUpTo = startIdx + received;
         if (newLoadedUpTo > msg.trackCount) {
             newLoadedUpTo = msg.trackCount;  // Cap at total
         }
@@ -94,23 +101,36 @@ void TrackHostHandler::setupProtocolCallbacks() {
         if (msg.trackIndex >= currentLoadedUpTo &&
             currentLoadedUpTo < msg.trackCount) {
             // Request next window to cover current selection
-            protocol_.requestTrackListWindow(currentLoadedUpTo);
+            protocol_.requestTrackListWindow(currentLoadedUpTo, protocol_.listWindowSize());
         }
     };
 
     protocol_.onTrackMuteState = [this](const TrackMuteStateMessage& msg) {
-        int displayIndex = utils::toDisplayIndex(msg.trackIndex, state_.trackSelector.isNested.get());
-        if (displayIndex >= 0 && displayIndex < MAX_TRACKS) {
-            state_.trackSelector.muteStates[displayIndex].set(msg.isMute);
-        }
+        setTrackFlag(msg.trackIndex, TRACK_FLAG_MUTE, msg.isMute);
     };
 
     protocol_.onTrackSoloState = [this](const TrackSoloStateMessage& msg) {
-        int displayIndex = utils::toDisplayIndex(msg.trackIndex, state_.trackSelector.isNested.get());
-        if (displayIndex >= 0 && displayIndex < MAX_TRACKS) {
-            state_.trackSelector.soloStates[displayIndex].set(msg.isSolo);
-        }
+        setTrackFlag(msg.trackIndex, TRACK_FLAG_SOLO, msg.isSolo);
+    };
+
+    protocol_.onTrackMutedBySoloState = [this](const TrackMutedBySoloStateMessage& msg) {
+        setTrackFlag(msg.trackIndex, TRACK_FLAG_MUTED_BY_SOLO, msg.isMutedBySolo);
     };
+
+    // Arm observers follow the root track bank (mixer tracks), so the index is
+    // only a selector index when the selector is not inside a group
+    protocol_.onTrackArmState = [this](const TrackArmStateMessage& msg) {
+        if (state_.trackSelector.isNested.get()) return;
+        setTrackFlag(msg.trackIndex, TRACK_FLAG_ARM, msg.isArm);
+    };
+}
+
+void TrackHostHandler::setTrackFlag(uint8_t trackIndex, uint8_t flag, bool on) {
+    auto& ts = state_.trackSelector;
+    int displayIndex = utils::toDisplayIndex(trackIndex, ts.isNested.get());
+    if (displayIndex < 0) return;
+    ts.flags.setFlag(static_cast<size_t>(displayIndex), flag, on);
+    ts.flags.commit();
 }
 
 }  // namespace bitwig::handler
@@ -8,9 +8,11 @@
  * Handles:
  * - Track info changes (name, color, type)
  * - Track list for selector
- * - Mute/Solo state updates
+ * - Mute/Solo/Arm state updates (packed track flags)
  */
 
+#include <cstdint>
+
 #include "protocol/BitwigProtocol.hpp"
 #include "state/BitwigState.hpp"
 
@@ -32,6 +34,7 @@ public:
 
 private:
     void setupProtocolCallbacks();
+    void setTrackFlag(uint8_t trackIndex, uint8_t flag, bool on);
 
     state::BitwigState& state_;
     BitwigProtocol& protocol_;
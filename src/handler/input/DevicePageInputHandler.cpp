@@ -1,6 +1,7 @@
 #include "DevicePageInputHandler.hpp"
 
 #include <oc/debug/InvariantAssert.hpp>
+#include <oc/time/Time.hpp>
 #include <oc/ui/lvgl/Scope.hpp>
 
 #include <config/App.hpp>
@@ -86,12 +87,12 @@ void DevicePageInputHandler::navigate(float delta) {
     newIndex = wrapIndex(newIndex, static_cast<int>(totalCount));
     state_.pageSelector.selectedIndex.set(newIndex);
 
-    // Prefetch next window if approaching end of loaded data
-    uint8_t loadedUpTo = state_.pageSelector.loadedUpTo.get();
-    if (newIndex >= 0 &&
-        shouldPrefetch<state::PREFETCH_THRESHOLD>(newIndex, loadedUpTo, totalCount)) {
-        protocol_.requestDevicePageNamesWindow(loadedUpTo);
-    }
+    // Prefetch ahead of the cursor (further ahead the faster the encoder spins)
+    prefetcher_.navigate(newIndex, static_cast<int>(delta), state_.pageSelector.loadedUpTo.get(), totalCount,
+                         protocol_.listWindowSize(), oc::time::millis(),
+                         [this](uint8_t start, uint8_t size) {
+                             protocol_.requestDevicePageNamesWindow(start, size);
+                         });
 }
 
 void DevicePageInputHandler::confirmSelection() {
@@ -2,6 +2,7 @@
 
 #include <oc/debug/InvariantAssert.hpp>
 #include <oc/log/Log.hpp>
+#include <oc/time/Time.hpp>
 #include <oc/ui/lvgl/Scope.hpp>
 
 #include <config/App.hpp>
@@ -108,7 +109,7 @@ void DeviceSelectorInputHandler::requestDeviceList() {
         ds.loadedUpTo.set(0);
         ds.loading.set(true);  // Mark as loading until host responds
         // Request first window (windowed loading)
-        protocol_.requestDeviceListWindow(0);
+        protocol_.requestDeviceListWindow(0, protocol_.listWindowSize());
         requested_ = true;
     }
 }
@@ -143,16 +144,15 @@ void DeviceSelectorInputHandler::navigate(float delta) {
     newIndex = wrapIndex(newIndex, displayCount);
     ds.currentIndex.set(newIndex);
 
-    // Prefetch next window if approaching end of loaded data
-    uint8_t loadedUpTo = ds.loadedUpTo.get();
     // Convert display index to device index (for nested, display 0 is back button)
     int deviceIndex = ds.isNested.get() ? newIndex - 1 : newIndex;
 
-    // Only prefetch if we have a valid device index approaching the loaded boundary
-    if (deviceIndex >= 0 &&
-        shouldPrefetch<state::PREFETCH_THRESHOLD>(deviceIndex, loadedUpTo, totalCount)) {
-        protocol_.requestDeviceListWindow(loadedUpTo);
-    }
+    // Prefetch ahead of the cursor (further ahead the faster the encoder spins)
+    prefetcher_.navigate(deviceIndex, static_cast<int>(delta), ds.loadedUpTo.get(), totalCount,
+                         protocol_.listWindowSize(), oc::time::millis(),
+                         [this](uint8_t start, uint8_t size) {
+                             protocol_.requestDeviceListWindow(start, size);
+                         });
 }
 
 void DeviceSelectorInputHandler::selectAndDive() {
@@ -215,7 +215,7 @@ void DeviceSelectorInputHandler::enterChildAtIndex(int selectorIndex) {
         ds.names.clear();
         ds.totalCount.set(0);
         ds.loadedUpTo.set(0);
-        protocol_.requestDeviceListWindow(0);
+        protocol_.requestDeviceListWindow(0, protocol_.listWindowSize());
         return;
     }
 
@@ -260,7 +260,7 @@ void DeviceSelectorInputHandler::requestTrackList() {
     ts.loadedUpTo.set(0);
 
     // Request first window - data will populate in background
-    protocol_.requestTrackListWindow(0);
+    protocol_.requestTrackListWindow(0, protocol_.listWindowSize());
 }
 
 void DeviceSelectorInputHandler::close() {
@@ -276,13 +276,9 @@ void DeviceSelectorInputHandler::close() {
 
 bool DeviceSelectorInputHandler::hasChildrenAtDisplayIndex(int displayIndex) const {
     // displayIndex is the UI list index (includes back button when nested)
-    // hasSlots/hasLayers/hasDrums are also indexed by display index
-    auto& ds = state_.deviceSelector;
-    if (displayIndex < 0 || displayIndex >= static_cast<int>(ds.hasSlots.size())) return false;
-
-    return ds.hasSlots[displayIndex] ||
-           ds.hasLayers[displayIndex] ||
-           ds.hasDrums[displayIndex];
+    // Device flags are also indexed by display index
+    if (displayIndex < 0) return false;
+    return state_.deviceSelector.flags.get().hasChildren(static_cast<size_t>(displayIndex));
 }
 
 int DeviceSelectorInputHandler::getAdjustedDeviceIndex(int selectorIndex) const {
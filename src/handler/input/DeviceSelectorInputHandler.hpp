@@ -20,6 +20,7 @@
 #include <oc/state/Signal.hpp>
 #include <ms/ui/OverlayBindingContext.hpp>
 
+#include "handler/WindowPrefetcher.hpp"
 #include "protocol/BitwigProtocol.hpp"
 #include "state/BitwigState.hpp"
 
@@ -75,6 +76,9 @@ private:
     uint8_t current_device_index_ = 0;  // Device being navigated (for children mode)
     bool requested_ = false;
 
+    // Window requests ahead of the cursor (see WindowPrefetcher)
+    WindowPrefetcher<state::PREFETCH_THRESHOLD> prefetcher_;
+
     // Auto-reset local state when overlay hidden externally
     oc::state::Subscription visible_sub_;
 };
@@ -52,14 +52,14 @@ void RemoteControlInputHandler::setupBindings() {
 void RemoteControlInputHandler::handleValueChange(uint8_t index, float value) {
     if (index >= PARAMETER_COUNT) return;
 
-    auto& slot = state_.parameters.slots[index];
+    auto& hot = state_.parameters.hot;
 
     // Optimistic update for value
-    slot.value.set(value);
+    hot.setValue(index, value);
 
     // Hide modulation ribbon immediately when user moves the knob
     // This prevents visual latency while waiting for host roundtrip
-    slot.isModulated.set(false);
+    hot.setModulated(index, false);
 
     // Note: automationActive is now derived from host batch (touchedMask)
     // Host is source of truth to avoid race conditions
@@ -71,7 +71,7 @@ void RemoteControlInputHandler::handleValueChange(uint8_t index, float value) {
 void RemoteControlInputHandler::sendTouch(uint8_t index, bool touched) {
     if (index >= PARAMETER_COUNT) return;
 
-    state_.parameters.slots[index].showModulation.set(touched);
+    state_.parameters.hot.setShowModulation(index, touched);
     protocol_.deviceRemoteControlTouch(index, touched);
 }
 
@@ -2,6 +2,7 @@
 
 #include <oc/debug/InvariantAssert.hpp>
 #include <oc/log/Log.hpp>
+#include <oc/time/Time.hpp>
 #include <oc/ui/lvgl/Scope.hpp>
 
 #include "handler/InputUtils.hpp"
@@ -91,16 +92,15 @@ void TrackInputHandler::navigate(float delta) {
     newIndex = wrapIndex(newIndex, displayCount);
     ts.currentIndex.set(newIndex);
 
-    // Prefetch next window if approaching end of loaded data
-    uint8_t loadedUpTo = ts.loadedUpTo.get();
     // Convert display index to track index (for nested, display 0 is back button)
     int trackIndex = ts.isNested.get() ? newIndex - 1 : newIndex;
 
-    // Only prefetch if we have a valid track index approaching the loaded boundary
-    if (trackIndex >= 0 &&
-        shouldPrefetch<state::PREFETCH_THRESHOLD>(trackIndex, loadedUpTo, totalCount)) {
-        protocol_.requestTrackListWindow(loadedUpTo);
-    }
+    // Prefetch ahead of the cursor (further ahead the faster the encoder spins)
+    prefetcher_.navigate(trackIndex, static_cast<int>(delta), ts.loadedUpTo.get(), totalCount,
+                         protocol_.listWindowSize(), oc::time::millis(),
+                         [this](uint8_t start, uint8_t size) {
+                             protocol_.requestTrackListWindow(start, size);
+                         });
 }
 
 void TrackInputHandler::select() {
@@ -128,7 +128,7 @@ void TrackInputHandler::close() {
 
     // Request fresh device list - don't clear cache to avoid flash
     // Old data remains visible until new data arrives
-    protocol_.requestDeviceListWindow(0);
+    protocol_.requestDeviceListWindow(0, protocol_.listWindowSize());
 }
 
 void TrackInputHandler::selectAndDive() {
@@ -153,7 +153,7 @@ void TrackInputHandler::selectAndDive() {
     ts.names.clear();
     ts.totalCount.set(0);
     ts.loadedUpTo.set(0);
-    protocol_.requestTrackListWindow(0);
+    protocol_.requestTrackListWindow(0, protocol_.listWindowSize());
 }
 
 void TrackInputHandler::toggleMute() {
@@ -18,6 +18,7 @@
 #include <api/InputAPI.hpp>
 #include <ms/ui/OverlayBindingContext.hpp>
 
+#include "handler/WindowPrefetcher.hpp"
 #include "protocol/BitwigProtocol.hpp"
 #include "state/BitwigState.hpp"
 
@@ -62,6 +63,9 @@ private:
     OverlayCtx overlay_ctx_;
     BitwigProtocol& protocol_;
     core::api::InputAPI input_;
+
+    // Window requests ahead of the cursor (see WindowPrefetcher)
+    WindowPrefetcher<state::PREFETCH_THRESHOLD> prefetcher_;
 };
 
 }  // namespace bitwig::handler
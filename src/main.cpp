@@ -15,6 +15,7 @@
 #include <config/platform-teensy/Buffer.hpp>
 #include <config/platform-teensy/Hardware.hpp>
 #include "app/AppLogic.hpp"
+#include "app/FrameBudget.hpp"
 
 // =============================================================================
 // Debug: Memory monitoring for crash diagnosis
@@ -83,6 +84,10 @@ static void initApp() {
 // Arduino Entry Points
 // =============================================================================
 
+// Timing constants for main loop
+constexpr uint32_t APP_PERIOD_US = 1'000'000 / Config::Timing::APP_HZ;
+constexpr uint32_t LVGL_PERIOD_US = 1'000'000 / Config::Timing::LVGL_HZ;
+
 void setup() {
     // NOTE: Logging enabled temporarily for debug - may interfere with protocol
     oc::hal::teensy::initLogging();
@@ -93,11 +98,9 @@ void setup() {
     initLVGL();
     initMux();
     initApp();
-}
 
-// Timing constants for main loop
-constexpr uint32_t APP_PERIOD_US = 1'000'000 / Config::Timing::APP_HZ;
-constexpr uint32_t LVGL_PERIOD_US = 1'000'000 / Config::Timing::LVGL_HZ;
+    bitwig::app::frameBudget().setLoopPeriodUs(APP_PERIOD_US);
+}
 
 void loop() {
     static uint32_t lastMicros = 0;
@@ -117,9 +120,14 @@ void loop() {
     app->update();
 
     // Refresh LVGL at lower frequency to reduce CPU load
+    bool rendered = false;
     lvglAccumulator += APP_PERIOD_US;
     if (lvglAccumulator >= LVGL_PERIOD_US) {
         lvglAccumulator = 0;
         lvgl->refresh();
+        rendered = true;
     }
+
+    // Frame-time accounting, reported to the host (RENDER_STATS)
+    bitwig::app::frameBudget().recordLoop(micros() - now, rendered);
 }
@@ -22,6 +22,37 @@
  *     state_.transport.playing.set(msg.isPlaying);
  * };
  * ```
+ *
+ * ## Message lifetime
+ *
+ * Decoded messages are views over the received frame: string fields are
+ * std::string_view slices into the transport buffer, so no heap allocation
+ * happens on receive. Copy any string you need beyond the callback.
+ *
+ * ## Envelopes
+ *
+ * In compact mode, small messages are queued into an envelope frame and sent
+ * together by flush(), called once per tick from BitwigContext::update().
+ * Messages too large for a record flush the envelope first, so ordering holds.
+ *
+ * ## Coalescing
+ *
+ * Idempotent "set value" commands (remote control, track volume/pan/send,
+ * last clicked; see Coalesce<T> in Outbox.hpp) are last-writer-wins:
+ * only the latest value per target is sent at the next flush(). Any other
+ * message flushes them first.
+ *
+ * ## String dictionary
+ *
+ * Name fields may carry a reference to a string the host defined earlier
+ * (STRING_DEFINE, see StringDictionary.hpp). Handlers resolve them with
+ * strings().resolve(); unknown IDs are reported by the next flush().
+ *
+ * ## List windows
+ *
+ * REQUEST_XXX_WINDOW carries the number of items wanted. listWindowSize()
+ * picks it from the throughput measured over window request round trips
+ * (see LinkMeter.hpp).
  */
 
 #include <cstdint>
@@ -29,14 +60,31 @@
 
 #include <oc/interface/ITransport.hpp>
 #include <oc/log/Log.hpp>
+#include <oc/time/Time.hpp>
 
+#include "Capture.hpp"
 #include "DecoderRegistry.hpp"
+#include "Envelope.hpp"
+#include "Framing.hpp"
+#include "LinkMeter.hpp"
+#include "Outbox.hpp"
 #include "MessageID.hpp"
 #include "ProtocolCallbacks.hpp"
 #include "ProtocolConstants.hpp"
+#include "StringDictionary.hpp"
 
 namespace bitwig {
 
+/**
+ * @brief Receive-side counters (one per DispatchResult)
+ */
+struct DispatchStats {
+    uint32_t handled = 0;
+    uint32_t unhandled = 0;
+    uint32_t decodeFailed = 0;
+    uint32_t unknownId = 0;
+};
+
 /**
  * @brief Bitwig Binary protocol handler using open-control framework
  *
@@ -57,6 +105,9 @@ public:
         transport_.setOnReceive([this](const uint8_t* data, size_t len) {
             dispatch(data, len);
         });
+        onStringDefine = [this](const Protocol::StringDefineMessage& msg) {
+            strings_.define(msg.stringId, msg.text);
+        };
     }
 
     ~BitwigProtocol() = default;
@@ -72,8 +123,154 @@ public:
     // =========================================================================
 #include "ProtocolMethods.ipp"
 
+    // =========================================================================
+    // Framing
+    // =========================================================================
+
+    /**
+     * @brief Drop the MESSAGE_NAME prefix from outgoing frames
+     *
+     * Frames start named. Compact framing is advertised with
+     * requestHostStatus(true) and enabled once HOST_INITIALIZED confirms it.
+     * Incoming frames are accepted in either form regardless of this setting.
+     */
+    void setCompactFrames(bool compact) {
+        if (!compact) flush();  // Queued records are compact frames
+        compact_frames_ = compact;
+    }
+    bool compactFrames() const { return compact_frames_; }
+
+    /**
+     * @brief Send coalesced values, then queued messages as one envelope frame
+     *
+     * A single queued message goes out as a plain compact frame.
+     */
+    void flush() {
+        reportStringMisses();
+        flushOutbox();
+        if (envelope_.empty()) return;
+        transmit(envelope_.frame(), envelope_.frameSize());
+        envelope_.clear();
+    }
+
+    /// Coalesced values dropped because a newer one superseded them
+    uint32_t coalescedCount() const { return outbox_.supersededCount(); }
+
+    /// Received message counters, by dispatch outcome
+    const DispatchStats& dispatchStats() const { return dispatch_stats_; }
+
+    /// Strings defined by the host (resolves name fields; cleared on HOST_INITIALIZED)
+    StringDictionary& strings() { return strings_; }
+
+    /// Link throughput estimate (reset on HOST_INITIALIZED)
+    LinkMeter& linkMeter() { return link_meter_; }
+
+    /// windowSize for REQUEST_XXX_WINDOW, sized to the measured link throughput
+    uint8_t listWindowSize() const { return link_meter_.windowItems(); }
+
+    // =========================================================================
+    // Flow control
+    // =========================================================================
+
+    /**
+     * @brief Acknowledge received bytes and advertise the receive window
+     *
+     * The host holds bulk messages back while more than @p windowBytes are
+     * unacknowledged, so interactive traffic keeps bounded latency.
+     * @p batchLosses counts lost batches (mod 256): a change makes the host
+     * resend every remote control slot.
+     */
+    void sendFlowCredit(uint16_t windowBytes, uint8_t batchLosses) {
+        flowCredit(received_bytes_, windowBytes, batchLosses);
+    }
+
+    // =========================================================================
+    // Capture / replay
+    // =========================================================================
+
+    /// Record every inbound and outbound frame (nullptr to stop)
+    void setCaptureSink(capture::Sink* sink) { capture_sink_ = sink; }
+
+    // =========================================================================
+    // Frame scope
+    // =========================================================================
+
+    /// Called before / after the callbacks of each valid inbound frame (e.g.
+    /// to batch state notifications per message, see StateTransaction)
+    Protocol::InlineCallback<void()> onFrameBegin;
+    Protocol::InlineCallback<void()> onFrameEnd;
+
+    /**
+     * @brief Process a frame as if the transport had received it
+     *
+     * Used to replay captures without a bridge.
+     */
+    void receive(const uint8_t* data, size_t len) { dispatch(data, len); }
+
 private:
     oc::interface::ITransport& transport_;
+    bool compact_frames_ = false;
+    framing::Envelope envelope_;
+    Outbox outbox_;
+    DispatchStats dispatch_stats_;
+    StringDictionary strings_;
+    LinkMeter link_meter_;
+    uint16_t received_bytes_ = 0;  // Frame bytes dispatched (mod 65536, acknowledged by FLOW_CREDIT)
+    capture::Sink* capture_sink_ = nullptr;
+
+    /// Single exit point to the transport (COBS framing handled by transport)
+    void transmit(const uint8_t* data, size_t len) {
+        if (capture_sink_) capture_sink_->onFrame(capture::Direction::OUTBOUND, data, len);
+        transport_.send(data, len);
+    }
+
+    // Transmit buffer for frames sent on their own (sized for the largest
+    // Controller -> Host message, not MAX_MESSAGE_SIZE)
+    static constexpr size_t TX_FRAME_SIZE = framing::MAX_HEADER_SIZE + Protocol::MAX_TO_HOST_PAYLOAD_SIZE;
+    uint8_t tx_frame_[TX_FRAME_SIZE];
+
+    static constexpr bool isWindowRequest(Protocol::MessageID id) {
+        return id == Protocol::MessageID::REQUEST_DEVICE_LIST_WINDOW ||
+               id == Protocol::MessageID::REQUEST_DEVICE_PAGE_NAMES_WINDOW ||
+               id == Protocol::MessageID::REQUEST_TRACK_LIST_WINDOW;
+    }
+
+    static constexpr bool isWindowReply(Protocol::MessageID id) {
+        return id == Protocol::MessageID::DEVICE_LIST_WINDOW ||
+               id == Protocol::MessageID::DEVICE_PAGE_NAMES_WINDOW ||
+               id == Protocol::MessageID::TRACK_LIST_WINDOW;
+    }
+
+    void reportStringMisses() {
+        uint16_t id;
+        while (strings_.takeMiss(id)) stringMiss(id);
+    }
+
+    void flushOutbox() {
+        outbox_.drain([this](Protocol::MessageID id, const uint8_t* payload, size_t len) {
+            sendPayload(id, payload, len);
+        });
+    }
+
+    /// Frame an already encoded (coalesced) payload
+    void sendPayload(Protocol::MessageID id, const uint8_t* payload, size_t len) {
+        if (compact_frames_) {
+            uint8_t* record = envelope_.reserve(1 + len);
+            if (record == nullptr) {
+                transmit(envelope_.frame(), envelope_.frameSize());
+                envelope_.clear();
+                record = envelope_.reserve(1 + len);
+            }
+            size_t offset = framing::writeHeader(record, id, true);
+            std::memcpy(record + offset, payload, len);
+            envelope_.commit(offset + len);
+            return;
+        }
+
+        size_t offset = framing::writeHeader(tx_frame_, id, false);
+        std::memcpy(tx_frame_ + offset, payload, len);
+        transmit(tx_frame_, offset + len);
+    }
 
     /**
      * @brief Send a protocol message (internal use only)
@@ -82,25 +279,46 @@ private:
      */
     template <typename T>
     void send(const T& message) {
-        using Protocol::MAX_MESSAGE_SIZE;
-
         constexpr Protocol::MessageID messageId = T::MESSAGE_ID;
+        static_assert(T::MAX_PAYLOAD_SIZE <= Protocol::MAX_TO_HOST_PAYLOAD_SIZE,
+                      "Message does not fit in the transmit buffer");
 
-        // Encode payload
-        uint8_t payload[T::MAX_PAYLOAD_SIZE];
-        uint16_t payloadLen = message.encode(payload, sizeof(payload));
+        if constexpr (isWindowRequest(messageId)) link_meter_.onRequest(oc::time::millis());
 
-        // Build frame: [MessageID][payload...]
-        uint8_t frame[MAX_MESSAGE_SIZE];
-        uint16_t offset = 0;
+        if constexpr (Coalesce<T>::enabled) {
+            if (!outbox_.put(message)) {
+                flushOutbox();
+                outbox_.put(message);
+            }
+            return;
+        }
 
-        frame[offset++] = static_cast<uint8_t>(messageId);
+        // Coalesced values were issued before this message
+        flushOutbox();
+
+        if constexpr (framing::fitsEnvelopeRecord<T>()) {
+            if (compact_frames_) {
+                constexpr size_t maxRecord = 1 + T::MAX_PAYLOAD_SIZE;
+                uint8_t* record = envelope_.reserve(maxRecord);
+                if (record == nullptr) {
+                    flush();
+                    record = envelope_.reserve(maxRecord);
+                }
+                size_t len = framing::writeHeader(record, messageId, true);
+                len += message.encode(record + len, T::MAX_PAYLOAD_SIZE);
+                envelope_.commit(len);
+                return;
+            }
+        }
 
-        std::memcpy(frame + offset, payload, payloadLen);
-        offset += payloadLen;
+        // Sent on its own: anything queued must go first
+        flush();
 
-        // Send via transport (COBS framing handled by transport)
-        transport_.send(frame, offset);
+        // Build frame in place: [MessageID][name prefix unless compact][payload...]
+        size_t offset = framing::writeHeader(tx_frame_, messageId, compact_frames_);
+        offset += message.encode(tx_frame_ + offset, static_cast<uint16_t>(TX_FRAME_SIZE - offset));
+
+        transmit(tx_frame_, offset);
     }
 
     /**
@@ -109,23 +327,52 @@ private:
      * Called automatically by transport when a complete frame arrives.
      */
     void dispatch(const uint8_t* data, size_t len) {
-        using Protocol::MIN_MESSAGE_LENGTH;
-        using Protocol::MESSAGE_TYPE_OFFSET;
-        using Protocol::PAYLOAD_OFFSET;
-        using Protocol::MessageID;
-        using Protocol::DecoderRegistry;
-
-        if (data == nullptr || len < MIN_MESSAGE_LENGTH) {
-            OC_LOG_WARN("[Protocol] dispatch: invalid frame (null or too short: {})", len);
+        if (capture_sink_) capture_sink_->onFrame(capture::Direction::INBOUND, data, len);
+        received_bytes_ = static_cast<uint16_t>(received_bytes_ + len);
+        link_meter_.onReceive(len);
+
+        framing::Frame frame;
+        if (!framing::parse(data, len, frame)) {
+            OC_LOG_WARN("[Protocol] dispatch: invalid frame (null, too short or bad name prefix: {})", len);
+            return;
+        }
+
+        if (onFrameBegin) onFrameBegin();
+        dispatchFrame(data, len, frame);
+        if (onFrameEnd) onFrameEnd();
+    }
+
+    /// Dispatch a parsed frame: each record of an envelope, else the frame itself
+    void dispatchFrame(const uint8_t* data, size_t len, const framing::Frame& frame) {
+        if (framing::isEnvelope(data, len)) {
+            bool complete = framing::forEachRecord(data, len, [this](const uint8_t* record, size_t recordLen) {
+                framing::Frame inner;
+                if (!framing::parse(record, recordLen, inner) || !inner.compact ||
+                    framing::isEnvelope(record, recordLen)) {
+                    OC_LOG_WARN("[Protocol] dispatch: invalid envelope record ({})", recordLen);
+                    return;
+                }
+                dispatchMessage(inner);
+            });
+            if (!complete) OC_LOG_WARN("[Protocol] dispatch: truncated envelope ({})", len);
             return;
         }
 
-        MessageID messageId = static_cast<MessageID>(data[MESSAGE_TYPE_OFFSET]);
+        dispatchMessage(frame);
+    }
 
-        uint16_t payloadLen = len - PAYLOAD_OFFSET;
-        const uint8_t* payload = data + PAYLOAD_OFFSET;
+    /// Per-message hook: decode through the registry table and count the outcome
+    void dispatchMessage(const framing::Frame& frame) {
+        using Protocol::DispatchResult;
 
-        DecoderRegistry::dispatch(*this, messageId, payload, payloadLen);
+        if (isWindowReply(frame.id)) link_meter_.onReply(oc::time::millis());
+
+        switch (Protocol::DecoderRegistry::dispatch(*this, frame.id, frame.payload, frame.payloadLen)) {
+            case DispatchResult::HANDLED: ++dispatch_stats_.handled; break;
+            case DispatchResult::UNHANDLED: ++dispatch_stats_.unhandled; break;
+            case DispatchResult::DECODE_FAILED: ++dispatch_stats_.decodeFailed; break;
+            case DispatchResult::UNKNOWN_ID: ++dispatch_stats_.unknownId; break;
+        }
     }
 };
 
@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+ * BoundedList.hpp
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ */
+
+// Fixed-capacity list, used for dynamic (count-prefixed) arrays so decoded
+// messages never allocate.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Protocol {
+
+/**
+ * Bounded list of up to N items
+ *
+ * Replaces std::vector<T> in decoded messages: storage is inline, only the
+ * first count() items are meaningful.
+ */
+template <typename T, size_t N>
+struct BoundedList {
+    std::array<T, N> items{};
+    uint8_t count = 0;
+
+    bool push_back(T item) {
+        if (count >= N) return false;
+        items[count++] = item;
+        return true;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    static constexpr size_t capacity() { return N; }
+
+    T operator[](size_t i) const { return items[i]; }
+
+    const T* begin() const { return items.data(); }
+    const T* end() const { return items.data() + count; }
+};
+
+}  // namespace Protocol
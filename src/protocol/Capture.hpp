@@ -0,0 +1,106 @@
+#pragma once
+
+/**
+ * @file Capture.hpp
+ * @brief Protocol capture format and recorder/replay interfaces
+ *
+ * A capture is every frame crossing BitwigProtocol, timestamped:
+ *
+ *   [MAGIC (8 bytes)] { [timeMs u32 LE][direction u8][len u16 LE][frame...] }*
+ *
+ * Frames are stored exactly as they crossed the transport (named, compact or
+ * envelope), so a replay exercises the same dispatch path as a live session.
+ * Sinks and sources are platform code (e.g. files on the SDL build); the
+ * protocol only sees these interfaces.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace bitwig::capture {
+
+constexpr uint8_t MAGIC[8] = {'M', 'S', 'C', 'A', 'P', '0', '1', '\n'};
+constexpr size_t RECORD_HEADER_SIZE = 7;
+
+enum class Direction : uint8_t {
+    INBOUND = 0,   // Host -> Controller (dispatched)
+    OUTBOUND = 1,  // Controller -> Host (sent)
+};
+
+/**
+ * @brief One captured frame (data points into the capture buffer)
+ */
+struct Record {
+    uint32_t timeMs;
+    Direction direction;
+    const uint8_t* data;
+    uint16_t len;
+};
+
+/// Write a record header; the frame bytes follow it
+inline size_t writeRecordHeader(uint8_t* out, uint32_t timeMs, Direction direction, uint16_t len) {
+    out[0] = static_cast<uint8_t>(timeMs);
+    out[1] = static_cast<uint8_t>(timeMs >> 8);
+    out[2] = static_cast<uint8_t>(timeMs >> 16);
+    out[3] = static_cast<uint8_t>(timeMs >> 24);
+    out[4] = static_cast<uint8_t>(direction);
+    out[5] = static_cast<uint8_t>(len);
+    out[6] = static_cast<uint8_t>(len >> 8);
+    return RECORD_HEADER_SIZE;
+}
+
+/// True if @p data starts with the capture MAGIC
+inline bool hasMagic(const uint8_t* data, size_t len) {
+    return len >= sizeof(MAGIC) && std::memcmp(data, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+/**
+ * @brief Read the record at @p cursor and advance past it
+ *
+ * @return false at the end of the buffer or on a truncated record
+ */
+inline bool readRecord(const uint8_t*& cursor, const uint8_t* end, Record& out) {
+    if (end - cursor < static_cast<ptrdiff_t>(RECORD_HEADER_SIZE)) return false;
+
+    out.timeMs = static_cast<uint32_t>(cursor[0]) | (static_cast<uint32_t>(cursor[1]) << 8) |
+                 (static_cast<uint32_t>(cursor[2]) << 16) | (static_cast<uint32_t>(cursor[3]) << 24);
+    out.direction = static_cast<Direction>(cursor[4]);
+    out.len = static_cast<uint16_t>(cursor[5] | (cursor[6] << 8));
+    if (end - cursor < static_cast<ptrdiff_t>(RECORD_HEADER_SIZE + out.len)) return false;
+
+    out.data = cursor + RECORD_HEADER_SIZE;
+    cursor += RECORD_HEADER_SIZE + out.len;
+    return true;
+}
+
+/**
+ * @brief Recorder: receives every frame crossing the protocol
+ *
+ * Implementations timestamp frames themselves.
+ */
+class Sink {
+public:
+    virtual ~Sink() = default;
+    virtual void onFrame(Direction direction, const uint8_t* data, size_t len) = 0;
+};
+
+/**
+ * @brief Replay: yields captured inbound frames as they become due
+ *
+ * Polled once per BitwigContext::update(); pacing is up to the source.
+ * update() brackets its work with beginUpdate() / endUpdate() so a source
+ * can time what the replayed traffic costs.
+ */
+class Source {
+public:
+    virtual ~Source() = default;
+
+    /// Next due inbound frame, or false if none is due yet (or the capture ended)
+    virtual bool poll(Record& out) = 0;
+
+    virtual void beginUpdate() {}
+    virtual void endUpdate() {}
+};
+
+}  // namespace bitwig::capture
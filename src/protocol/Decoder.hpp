@@ -3,7 +3,7 @@
 /**
  * Decoder.hpp
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  */
 
 // Binary Decoder - 8-bit binary
@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <string_view>
 #include <cstddef>
 
 namespace Protocol {
@@ -152,6 +153,29 @@ static bool decodeString(
     return true;
 }
 
+/**
+ * Decode string view (variable length, zero-copy)
+ * Same wire format as decodeString, but exposes the bytes in place instead of copying
+ *
+ * Format: [length] [char0] [char1] ... [charN-1]
+ * The view points into the input buffer and is only valid while that buffer is alive.
+ */
+static bool decodeStringView(
+    const uint8_t*& buf, size_t& remaining, std::string_view& out) {
+
+    if (remaining < 1) return false;
+
+    uint8_t len = *buf++ & 0xFF;
+    remaining -= 1;
+
+    if (remaining < len) return false;
+
+    out = std::string_view(reinterpret_cast<const char*>(buf), len);
+    buf += len;
+    remaining -= len;
+    return true;
+}
+
 /**
  * Decode uint16 (2 bytes)
  * 16-bit unsigned integer (0-65535) (2 bytes, little-endian)
@@ -3,7 +3,7 @@
 /**
  * Encoder.hpp
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  */
 
 // Binary Encoder - 8-bit binary
@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <string_view>
 #include <cmath>
 
 namespace Protocol {
@@ -97,8 +98,9 @@ static void encodeNorm8(uint8_t*& buf, float val) {
  *
  * Format: [length] [char0] [char1] ... [charN-1]
  * Max length: 255 chars
+ * Accepts std::string and decoded string views alike
  */
-static void encodeString(uint8_t*& buf, const std::string& str) {
+static void encodeString(uint8_t*& buf, std::string_view str) {
     uint8_t len = static_cast<uint8_t>(str.length()) & 0xFF;
     *buf++ = len;
 
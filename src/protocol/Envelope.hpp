@@ -0,0 +1,101 @@
+#pragma once
+
+/**
+ * @file Envelope.hpp
+ * @brief Multi-message envelope frames (several compact records, one transport frame)
+ *
+ * Bursts of small messages (isModulated x 8 after a batch, restore automation
+ * x 8, ...) would otherwise cost one COBS frame and one USB transaction each.
+ * An envelope packs them:
+ *
+ *   [ENVELOPE_MESSAGE_ID | COMPACT_FRAME_FLAG] { [recordLen][compact frame] }*
+ *
+ * Each record is a regular compact frame ([MessageID | flag][payload]), so the
+ * receiver dispatches it exactly like a standalone frame. Envelopes are only
+ * produced in compact mode; records never nest.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ProtocolConstants.hpp"
+
+namespace bitwig::framing {
+
+/// Whether message type T always fits in one envelope record
+template <typename T>
+constexpr bool fitsEnvelopeRecord() {
+    return 1 + T::MAX_PAYLOAD_SIZE <= Protocol::MAX_ENVELOPE_RECORD_SIZE;
+}
+
+/**
+ * @brief Fixed-size envelope being filled between flushes
+ *
+ * Records are written in place: reserve() returns the record slot, the caller
+ * writes a compact frame there and commit()s its length.
+ */
+class Envelope {
+public:
+    Envelope() { buffer_[0] = Protocol::ENVELOPE_MESSAGE_ID | Protocol::COMPACT_FRAME_FLAG; }
+
+    /**
+     * @brief Reserve a record slot of up to @p maxLen bytes
+     * @return Write pointer for the compact frame, or nullptr if the envelope is full
+     */
+    uint8_t* reserve(size_t maxLen) {
+        if (maxLen > Protocol::MAX_ENVELOPE_RECORD_SIZE) return nullptr;
+        if (size_ + 1 + maxLen > sizeof(buffer_)) return nullptr;
+        return buffer_ + size_ + 1;
+    }
+
+    /// Close the record written at the last reserve() slot
+    void commit(size_t len) {
+        if (count_ == 0) first_ = size_;
+        buffer_[size_] = static_cast<uint8_t>(len);
+        size_ += 1 + len;
+        ++count_;
+    }
+
+    bool empty() const { return count_ == 0; }
+    size_t recordCount() const { return count_; }
+
+    /// Frame to transmit: a lone record goes out as a plain compact frame
+    const uint8_t* frame() const { return count_ == 1 ? buffer_ + first_ + 1 : buffer_; }
+    size_t frameSize() const { return count_ == 1 ? buffer_[first_] : size_; }
+
+    void clear() {
+        size_ = 1;
+        count_ = 0;
+    }
+
+private:
+    uint8_t buffer_[Protocol::MAX_ENVELOPE_SIZE];
+    size_t size_ = 1;
+    size_t count_ = 0;
+    size_t first_ = 1;
+};
+
+/// True if @p data is an envelope frame (compact type byte with the reserved ID)
+inline bool isEnvelope(const uint8_t* data, size_t len) {
+    return data != nullptr && len >= 1 &&
+           data[0] == (Protocol::ENVELOPE_MESSAGE_ID | Protocol::COMPACT_FRAME_FLAG);
+}
+
+/**
+ * @brief Call @p fn(record, recordLen) for each record of an envelope frame
+ *
+ * @return false if a record overruns the frame (records before it were delivered)
+ */
+template <typename Fn>
+bool forEachRecord(const uint8_t* data, size_t len, Fn&& fn) {
+    size_t offset = 1;
+    while (offset < len) {
+        size_t recordLen = data[offset];
+        if (offset + 1 + recordLen > len) return false;
+        fn(data + offset + 1, recordLen);
+        offset += 1 + recordLen;
+    }
+    return true;
+}
+
+}  // namespace bitwig::framing
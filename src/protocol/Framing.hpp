@@ -0,0 +1,91 @@
+#pragma once
+
+/**
+ * @file Framing.hpp
+ * @brief Frame header layout shared by BitwigProtocol send/dispatch
+ *
+ * Two header forms coexist on the wire:
+ *
+ * - Named:   [MessageID][nameLen][name...][payload...]
+ * - Compact: [MessageID | COMPACT_FRAME_FLAG][payload...]
+ *
+ * Named frames keep the MESSAGE_NAME prefix so a bridge can log traffic
+ * without knowing the protocol. Compact frames drop it once both sides have
+ * negotiated it (REQUEST_HOST_STATUS / HOST_INITIALIZED); loggers then resolve
+ * names with Protocol::messageName(). Receivers accept both forms at any time,
+ * so switching mode never races with frames already in flight.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "MessageID.hpp"
+#include "MessageNames.hpp"
+#include "ProtocolConstants.hpp"
+
+namespace bitwig::framing {
+
+/// Largest header a frame can carry (named form with the longest name)
+constexpr size_t MAX_HEADER_SIZE = 2 + Protocol::MAX_MESSAGE_NAME_LENGTH;
+
+/**
+ * @brief Write the frame header for a message
+ *
+ * @param out Output buffer (must have >= MAX_HEADER_SIZE bytes)
+ * @param id Message identifier
+ * @param compact Drop the MESSAGE_NAME prefix
+ * @return Number of header bytes written (payload starts there)
+ */
+inline size_t writeHeader(uint8_t* out, Protocol::MessageID id, bool compact) {
+    uint8_t idByte = static_cast<uint8_t>(id);
+    if (compact) {
+        out[0] = idByte | Protocol::COMPACT_FRAME_FLAG;
+        return 1;
+    }
+
+    const char* name = Protocol::messageName(id);
+    size_t nameLen = name ? std::strlen(name) : 0;
+    out[0] = idByte;
+    out[1] = static_cast<uint8_t>(nameLen);
+    if (nameLen > 0) std::memcpy(out + 2, name, nameLen);
+    return 2 + nameLen;
+}
+
+/**
+ * @brief Parsed frame: message identifier and payload slice
+ */
+struct Frame {
+    Protocol::MessageID id;
+    const uint8_t* payload;
+    uint16_t payloadLen;
+    bool compact;
+};
+
+/**
+ * @brief Parse a received frame header (named or compact)
+ *
+ * @return false if the frame is too short or the name prefix overruns it
+ */
+inline bool parse(const uint8_t* data, size_t len, Frame& out) {
+    if (data == nullptr || len < Protocol::MIN_MESSAGE_LENGTH) return false;
+
+    uint8_t idByte = data[Protocol::MESSAGE_TYPE_OFFSET];
+    out.id = static_cast<Protocol::MessageID>(idByte & Protocol::MESSAGE_ID_MASK);
+    out.compact = (idByte & Protocol::COMPACT_FRAME_FLAG) != 0;
+
+    size_t offset = Protocol::PAYLOAD_OFFSET;
+    if (!out.compact) {
+        // Named frame: skip [nameLen][name...]
+        if (len < offset + 1) return false;
+        size_t nameLen = data[offset];
+        if (len < offset + 1 + nameLen) return false;
+        offset += 1 + nameLen;
+    }
+
+    out.payload = data + offset;
+    out.payloadLen = static_cast<uint16_t>(len - offset);
+    return true;
+}
+
+}  // namespace bitwig::framing
@@ -0,0 +1,94 @@
+#pragma once
+
+/**
+ * @file FrontCoding.hpp
+ * @brief Shared-prefix (front) coding of windowed name lists
+ *
+ * Names in one window often share long prefixes ("Synth Bus 1", "Synth Bus 2",
+ * "Osc 1 Pitch", "Osc 1 Shape"). DEVICE_PAGE_NAMES_WINDOW, DEVICE_LIST_WINDOW
+ * and TRACK_LIST_WINDOW carry an optional prefix-length array next to the
+ * names; each name is then sent as the suffix after the characters it shares
+ * with the previous name:
+ *
+ *   name[i] = name[i-1][0, prefix[i]) + suffix[i]
+ *
+ * An empty prefix array means the names are sent whole (the host only front
+ * codes a window when it saves bytes). A non-empty name always keeps at least
+ * one character in its suffix, so an empty entry still marks the end of the
+ * window for the handlers.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace bitwig::frontcoding {
+
+/// Longest name a wire string can carry (8-bit length)
+constexpr size_t MAX_NAME_LENGTH = 255;
+
+/**
+ * @brief Characters @p name takes from @p previous
+ *
+ * Capped so that a non-empty name keeps a non-empty suffix.
+ */
+inline uint8_t sharedPrefix(std::string_view previous, std::string_view name) {
+    size_t limit = std::min({previous.size(), name.empty() ? size_t{0} : name.size() - 1, MAX_NAME_LENGTH});
+    size_t n = 0;
+    while (n < limit && previous[n] == name[n]) ++n;
+    return static_cast<uint8_t>(n);
+}
+
+/**
+ * @brief Front code @p count names into @p suffixes / @p prefixes
+ *
+ * Suffixes are views into the input names (the host does the same in Java).
+ *
+ * @return Bytes saved on the wire, net of the prefix array (may be <= 0)
+ */
+inline int encode(const std::string_view* names, size_t count, std::string_view* suffixes, uint8_t* prefixes) {
+    int saved = -static_cast<int>(count);  // One prefix byte per name
+    std::string_view previous;
+    for (size_t i = 0; i < count; ++i) {
+        prefixes[i] = sharedPrefix(previous, names[i]);
+        suffixes[i] = names[i].substr(prefixes[i]);
+        saved += prefixes[i];
+        previous = names[i];
+    }
+    return saved;
+}
+
+/**
+ * @brief Rebuilds the full names of a window, in order
+ *
+ * Without prefixes (plain window) next() returns the suffix unchanged.
+ * Otherwise the returned view points into the decoder and stays valid until
+ * the next call; handlers copy it into their selector cache right away.
+ */
+class NameDecoder {
+public:
+    NameDecoder(const uint8_t* prefixes, size_t count) : prefixes_(prefixes), count_(count) {}
+
+    std::string_view next(std::string_view suffix) {
+        if (count_ == 0) return suffix;
+
+        size_t prefix = index_ < count_ ? std::min<size_t>(prefixes_[index_], length_) : 0;
+        ++index_;
+
+        size_t copied = std::min(suffix.size(), sizeof(buffer_) - prefix);
+        std::memcpy(buffer_ + prefix, suffix.data(), copied);
+        length_ = prefix + copied;
+        return {buffer_, length_};
+    }
+
+private:
+    const uint8_t* prefixes_;
+    size_t count_;
+    size_t index_ = 0;
+    size_t length_ = 0;
+    char buffer_[MAX_NAME_LENGTH];
+};
+
+}  // namespace bitwig::frontcoding
@@ -0,0 +1,78 @@
+#pragma once
+
+/**
+ * InlineCallback.hpp
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ */
+
+// Fixed-size delegate used for ProtocolCallbacks: the callable is stored
+// inline (no heap, no fallback) and invoked through one function pointer.
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Protocol {
+
+template <typename Signature, size_t Capacity = 2 * sizeof(void*)>
+class InlineCallback;
+
+/**
+ * Non-allocating replacement for std::function
+ *
+ * Accepts any trivially copyable callable up to Capacity bytes (a lambda
+ * capturing `this` plus one pointer by default). Oversized or non-trivial
+ * captures are rejected at compile time instead of spilling to the heap.
+ */
+template <typename R, typename... Args, size_t Capacity>
+class InlineCallback<R(Args...), Capacity> {
+public:
+    InlineCallback() = default;
+    InlineCallback(std::nullptr_t) {}
+
+    template <typename F,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineCallback>>>
+    InlineCallback(F&& callable) {
+        assign(std::forward<F>(callable));
+    }
+
+    template <typename F,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineCallback>>>
+    InlineCallback& operator=(F&& callable) {
+        assign(std::forward<F>(callable));
+        return *this;
+    }
+
+    InlineCallback& operator=(std::nullptr_t) {
+        invoke_ = nullptr;
+        return *this;
+    }
+
+    explicit operator bool() const { return invoke_ != nullptr; }
+
+    R operator()(Args... args) const { return invoke_(storage_, std::forward<Args>(args)...); }
+
+private:
+    using Invoker = R (*)(const void*, Args...);
+
+    template <typename F>
+    void assign(F&& callable) {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= Capacity, "Callback capture too large for InlineCallback");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t), "Callback alignment not supported");
+        static_assert(std::is_trivially_copyable_v<Fn> && std::is_trivially_destructible_v<Fn>,
+                      "InlineCallback requires a trivially copyable callable (capture pointers, not objects)");
+
+        ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(callable));
+        invoke_ = [](const void* storage, Args... args) -> R {
+            return (*std::launder(static_cast<const Fn*>(storage)))(std::forward<Args>(args)...);
+        };
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[Capacity] = {};
+    Invoker invoke_ = nullptr;
+};
+
+}  // namespace Protocol
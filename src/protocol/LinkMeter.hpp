@@ -0,0 +1,92 @@
+#pragma once
+
+/**
+ * @file LinkMeter.hpp
+ * @brief Receive throughput estimate, used to size list window requests
+ *
+ * Selector lists are requested REQUEST_XXX_WINDOW(start, windowSize). Over
+ * USB a 64-item first load costs a few milliseconds; over a serial bridge
+ * the same request holds the link (and every value update behind it) for
+ * hundreds. The controller picks windowSize from what the link has shown it
+ * can deliver:
+ *
+ *   windowItems = bytesPerSecond * WINDOW_BUDGET_MS / BYTES_PER_ITEM
+ *
+ * rounded down to a multiple of MIN_WINDOW_ITEMS and capped to
+ * [MIN_WINDOW_ITEMS, MAX_WINDOW_ITEMS]. Until a sample exists the fixed
+ * LIST_WINDOW_SIZE is used.
+ *
+ * Only window requests are timed: from REQUEST_XXX_WINDOW (onRequest()) to
+ * the first list window that answers it (onReply()), the bytes received
+ * over the round trip give one sample. Traffic outside a request says how
+ * much the host had to send, not what the link can carry, so it is ignored:
+ * light traffic on a fast link keeps the default window. Round trips below
+ * BUSY_BYTES (short lists) or slower than TIMEOUT_MS (reply lost, host
+ * busy) are ignored too. The estimate is the best sample since the last
+ * reset(); the path only changes across a reconnect, and HOST_INITIALIZED
+ * resets the meter.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace bitwig {
+
+class LinkMeter {
+public:
+    static constexpr uint32_t TIMEOUT_MS = 1000;
+    static constexpr uint32_t BUSY_BYTES = 256;
+
+    static constexpr uint8_t DEFAULT_WINDOW_ITEMS = 16;   // Not measured yet (state LIST_WINDOW_SIZE)
+    static constexpr uint8_t MIN_WINDOW_ITEMS = 8;
+    static constexpr uint8_t MAX_WINDOW_ITEMS = 64;       // Must match BitwigConfig.MAX_LIST_WINDOW_SIZE
+    static constexpr uint32_t BYTES_PER_ITEM = 40;        // Typical device/track entry with its name
+    static constexpr uint32_t WINDOW_BUDGET_MS = 50;      // Link time one request may take
+
+    /// A window request was sent (the first one outstanding starts the round trip)
+    void onRequest(uint32_t nowMs) {
+        if (outstanding_ && nowMs - requestMs_ <= TIMEOUT_MS) return;
+        outstanding_ = true;
+        requestMs_ = nowMs;
+        roundTripBytes_ = 0;
+    }
+
+    /// Account a received frame (counted only while a request is outstanding)
+    void onReceive(size_t bytes) {
+        if (outstanding_) roundTripBytes_ += static_cast<uint32_t>(bytes);
+    }
+
+    /// A list window arrived (after its own onReceive()): closes the round trip
+    void onReply(uint32_t nowMs) {
+        if (!outstanding_) return;
+        outstanding_ = false;
+
+        uint32_t elapsed = std::max<uint32_t>(nowMs - requestMs_, 1);
+        if (roundTripBytes_ < BUSY_BYTES || elapsed > TIMEOUT_MS) return;
+        bytesPerSecond_ = std::max(bytesPerSecond_, roundTripBytes_ * 1000.0f / elapsed);
+    }
+
+    /// Throughput estimate (0 = not measured yet)
+    uint32_t bytesPerSecond() const { return static_cast<uint32_t>(bytesPerSecond_); }
+
+    /// windowSize for the next REQUEST_XXX_WINDOW
+    uint8_t windowItems() const {
+        if (bytesPerSecond_ <= 0.0f) return DEFAULT_WINDOW_ITEMS;
+
+        float items = bytesPerSecond_ * WINDOW_BUDGET_MS / 1000.0f / BYTES_PER_ITEM;
+        uint32_t rounded = static_cast<uint32_t>(std::min(items, static_cast<float>(MAX_WINDOW_ITEMS)));
+        rounded -= rounded % MIN_WINDOW_ITEMS;
+        return static_cast<uint8_t>(std::max<uint32_t>(rounded, MIN_WINDOW_ITEMS));
+    }
+
+    void reset() { *this = LinkMeter(); }
+
+private:
+    float bytesPerSecond_ = 0.0f;
+    uint32_t requestMs_ = 0;
+    uint32_t roundTripBytes_ = 0;
+    bool outstanding_ = false;
+};
+
+}  // namespace bitwig
@@ -0,0 +1,136 @@
+/**
+ * MessageNames.hpp - MessageID to message name table
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ *
+ * Resolves message names from their MessageID for logging, so names do not
+ * have to travel on the wire (compact framing).
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "MessageID.hpp"
+
+namespace Protocol {
+
+/**
+ * Longest message name in characters (sizes the named frame prefix)
+ */
+constexpr uint8_t MAX_MESSAGE_NAME_LENGTH = 48;
+
+/**
+ * Message names indexed by MessageID value
+ */
+inline constexpr const char* MESSAGE_NAMES[MESSAGE_COUNT] = {
+    "DeviceChainStamp",  // 0x00
+    "DeviceChange",  // 0x01
+    "DeviceChangeHeader",  // 0x02
+    "DeviceChildren",  // 0x03
+    "DeviceEnabledState",  // 0x04
+    "DeviceListWindow",  // 0x05
+    "DevicePageChange",  // 0x06
+    "DevicePageNamesWindow",  // 0x07
+    "DevicePageSelect",  // 0x08
+    "DeviceRemoteControlsBatch",  // 0x09
+    "DeviceRemoteControlDiscreteValues",  // 0x0A
+    "DeviceRemoteControlHasAutomationChange",  // 0x0B
+    "DeviceRemoteControlIsModulatedChange",  // 0x0C
+    "DeviceRemoteControlNameChange",  // 0x0D
+    "DeviceRemoteControlOriginChange",  // 0x0E
+    "DeviceRemoteControlRestoreAutomation",  // 0x0F
+    "DeviceRemoteControlTouch",  // 0x10
+    "DeviceRemoteControlUpdate",  // 0x11
+    "DeviceSelect",  // 0x12
+    "DeviceState",  // 0x13
+    "EnterDeviceChild",  // 0x14
+    "EnterTrackGroup",  // 0x15
+    "ExitToParent",  // 0x16
+    "ExitTrackGroup",  // 0x17
+    "FlowCredit",  // 0x18
+    "HostDeactivated",  // 0x19
+    "HostInitialized",  // 0x1A
+    "LastClickedTouch",  // 0x1B
+    "LastClickedUpdate",  // 0x1C
+    "LastClickedValue",  // 0x1D
+    "LastClickedValueState",  // 0x1E
+    "RemoteControlValue",  // 0x1F
+    "RemoteControlValueState",  // 0x20
+    "RenderStats",  // 0x21
+    "RequestDeviceChildren",  // 0x22
+    "RequestDeviceListWindow",  // 0x23
+    "RequestDevicePageNamesWindow",  // 0x24
+    "RequestHostStatus",  // 0x25
+    "RequestSendDestinations",  // 0x26
+    "RequestTrackListWindow",  // 0x27
+    "RequestTrackSendList",  // 0x28
+    "ResetAutomationOverrides",  // 0x29
+    "SelectMixSend",  // 0x2A
+    "SendDestinationsList",  // 0x2B
+    "StringDefine",  // 0x2C
+    "StringMiss",  // 0x2D
+    "TrackActivate",  // 0x2E
+    "TrackArm",  // 0x2F
+    "TrackArmState",  // 0x30
+    "TrackChange",  // 0x31
+    "TrackListWindow",  // 0x32
+    "TrackMute",  // 0x33
+    "TrackMutedBySoloState",  // 0x34
+    "TrackMuteState",  // 0x35
+    "TrackPan",  // 0x36
+    "TrackPanHasAutomationState",  // 0x37
+    "TrackPanModulatedValueState",  // 0x38
+    "TrackPanState",  // 0x39
+    "TrackPanTouch",  // 0x3A
+    "TrackSelect",  // 0x3B
+    "TrackSendEnabled",  // 0x3C
+    "TrackSendEnabledState",  // 0x3D
+    "TrackSendHasAutomationState",  // 0x3E
+    "TrackSendList",  // 0x3F
+    "TrackSendMode",  // 0x40
+    "TrackSendModeState",  // 0x41
+    "TrackSendModulatedValueState",  // 0x42
+    "TrackSendPreFaderState",  // 0x43
+    "TrackSendTouch",  // 0x44
+    "TrackSendValue",  // 0x45
+    "TrackSendValueState",  // 0x46
+    "TrackSolo",  // 0x47
+    "TrackSoloState",  // 0x48
+    "TrackVolume",  // 0x49
+    "TrackVolumeHasAutomationState",  // 0x4A
+    "TrackVolumeModulatedValueState",  // 0x4B
+    "TrackVolumeState",  // 0x4C
+    "TrackVolumeTouch",  // 0x4D
+    "TransportArrangerAutomationWriteEnabled",  // 0x4E
+    "TransportArrangerAutomationWriteEnabledState",  // 0x4F
+    "TransportArrangerOverdubEnabled",  // 0x50
+    "TransportArrangerOverdubEnabledState",  // 0x51
+    "TransportAutomationOverrideActiveState",  // 0x52
+    "TransportAutomationWriteMode",  // 0x53
+    "TransportAutomationWriteModeState",  // 0x54
+    "TransportClipLauncherAutomationWriteEnabled",  // 0x55
+    "TransportClipLauncherAutomationWriteEnabledState",  // 0x56
+    "TransportClipLauncherOverdubEnabled",  // 0x57
+    "TransportClipLauncherOverdubEnabledState",  // 0x58
+    "TransportPlay",  // 0x59
+    "TransportPlayingState",  // 0x5A
+    "TransportRecord",  // 0x5B
+    "TransportRecordingState",  // 0x5C
+    "TransportStop",  // 0x5D
+    "TransportTempo",  // 0x5E
+    "TransportTempoState",  // 0x5F
+    "ViewState",  // 0x60
+};
+
+/**
+ * Get the message name for a MessageID
+ *
+ * @return Message name, or nullptr if the ID is out of range
+ */
+constexpr const char* messageName(MessageID id) {
+    uint8_t index = static_cast<uint8_t>(id);
+    return index < MESSAGE_COUNT ? MESSAGE_NAMES[index] : nullptr;
+}
+
+}  // namespace Protocol
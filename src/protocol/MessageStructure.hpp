@@ -1,7 +1,7 @@
 /**
  * MessageStructure.hpp - Umbrella header for all protocol messages
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  *
  * This file includes all message struct definitions.
  * Use this single include in your code instead of including individual structs.
@@ -18,6 +18,7 @@
 // IWYU pragma: begin_exports
 #include "struct/DeviceChangeMessage.hpp"
 #include "struct/DeviceChangeHeaderMessage.hpp"
+#include "struct/DeviceChainStampMessage.hpp"
 #include "struct/DeviceChildrenMessage.hpp"
 #include "struct/DeviceEnabledStateMessage.hpp"
 #include "struct/DeviceListWindowMessage.hpp"
@@ -47,9 +48,13 @@
 #include "struct/LastClickedUpdateMessage.hpp"
 #include "struct/LastClickedValueMessage.hpp"
 #include "struct/LastClickedValueStateMessage.hpp"
+#include "struct/FlowCreditMessage.hpp"
 #include "struct/HostDeactivatedMessage.hpp"
 #include "struct/HostInitializedMessage.hpp"
+#include "struct/RenderStatsMessage.hpp"
 #include "struct/RequestHostStatusMessage.hpp"
+#include "struct/StringDefineMessage.hpp"
+#include "struct/StringMissMessage.hpp"
 #include "struct/EnterTrackGroupMessage.hpp"
 #include "struct/ExitTrackGroupMessage.hpp"
 #include "struct/RequestSendDestinationsMessage.hpp"
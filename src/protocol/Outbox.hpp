@@ -0,0 +1,134 @@
+#pragma once
+
+/**
+ * @file Outbox.hpp
+ * @brief Last-writer-wins queue for idempotent "set value" commands
+ *
+ * Encoders emit a value per tick; only the latest one per target matters.
+ * BitwigProtocol parks these commands here, keyed by (MessageID, index), and
+ * sends each surviving entry once per update(). Other messages flush the
+ * outbox first, so a value never overtakes the touch release that follows it.
+ *
+ * A message opts in with a Coalesce<T> specialization giving its key. Only
+ * absolute values qualify: relative commands such as TRANSPORT_TEMPO (a
+ * tempo delta the host adds with incRaw) must all reach the host.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "MessageID.hpp"
+#include "MessageStructure.hpp"
+
+namespace bitwig {
+
+/**
+ * @brief Coalescing trait: enabled messages are queued in the Outbox
+ *
+ * key() identifies the target (parameter, track, send) within the MessageID.
+ */
+template <typename T>
+struct Coalesce {
+    static constexpr bool enabled = false;
+};
+
+template <>
+struct Coalesce<Protocol::RemoteControlValueMessage> {
+    static constexpr bool enabled = true;
+    static uint16_t key(const Protocol::RemoteControlValueMessage& m) { return m.remoteControlIndex; }
+};
+
+template <>
+struct Coalesce<Protocol::LastClickedValueMessage> {
+    static constexpr bool enabled = true;
+    static uint16_t key(const Protocol::LastClickedValueMessage&) { return 0; }
+};
+
+template <>
+struct Coalesce<Protocol::TrackVolumeMessage> {
+    static constexpr bool enabled = true;
+    static uint16_t key(const Protocol::TrackVolumeMessage& m) { return m.trackIndex; }
+};
+
+template <>
+struct Coalesce<Protocol::TrackPanMessage> {
+    static constexpr bool enabled = true;
+    static uint16_t key(const Protocol::TrackPanMessage& m) { return m.trackIndex; }
+};
+
+template <>
+struct Coalesce<Protocol::TrackSendValueMessage> {
+    static constexpr bool enabled = true;
+    static uint16_t key(const Protocol::TrackSendValueMessage& m) {
+        return static_cast<uint16_t>((m.trackIndex << 8) | m.sendIndex);
+    }
+};
+
+/**
+ * @brief Fixed-capacity (MessageID, key) -> latest encoded payload
+ *
+ * Entries keep first-insertion order; a newer value overwrites in place.
+ */
+class Outbox {
+public:
+    static constexpr size_t CAPACITY = 32;
+    static constexpr size_t MAX_PAYLOAD = 8;
+
+    /**
+     * @brief Queue or overwrite the pending value for the message's target
+     * @return false if the outbox is full (caller flushes and retries)
+     */
+    template <typename T>
+    bool put(const T& message) {
+        static_assert(Coalesce<T>::enabled, "Message type is not coalescable");
+        static_assert(T::MAX_PAYLOAD_SIZE <= MAX_PAYLOAD, "Coalesced payload too large");
+
+        Entry* entry = find(T::MESSAGE_ID, Coalesce<T>::key(message));
+        if (entry == nullptr) {
+            if (count_ >= CAPACITY) return false;
+            entry = &entries_[count_++];
+            entry->id = T::MESSAGE_ID;
+            entry->key = Coalesce<T>::key(message);
+        } else {
+            ++superseded_;
+        }
+        entry->len = static_cast<uint8_t>(message.encode(entry->payload, MAX_PAYLOAD));
+        return true;
+    }
+
+    /// Hand every pending entry to fn(id, payload, len) in insertion order, then clear
+    template <typename Fn>
+    void drain(Fn&& fn) {
+        for (size_t i = 0; i < count_; ++i) {
+            fn(entries_[i].id, entries_[i].payload, entries_[i].len);
+        }
+        count_ = 0;
+    }
+
+    bool empty() const { return count_ == 0; }
+    size_t size() const { return count_; }
+
+    /// Values dropped because a newer one replaced them before a flush
+    uint32_t supersededCount() const { return superseded_; }
+
+private:
+    struct Entry {
+        Protocol::MessageID id;
+        uint16_t key;
+        uint8_t len;
+        uint8_t payload[MAX_PAYLOAD];
+    };
+
+    Entry* find(Protocol::MessageID id, uint16_t key) {
+        for (size_t i = 0; i < count_; ++i) {
+            if (entries_[i].id == id && entries_[i].key == key) return &entries_[i];
+        }
+        return nullptr;
+    }
+
+    Entry entries_[CAPACITY];
+    size_t count_ = 0;
+    uint32_t superseded_ = 0;
+};
+
+}  // namespace bitwig
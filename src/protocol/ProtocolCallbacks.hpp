@@ -1,10 +1,11 @@
 /**
  * ProtocolCallbacks.hpp - Typed callbacks for all messages
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  *
  * Base class providing typed callbacks for each message type.
  * Protocol inherits this and DecoderRegistry calls these callbacks.
+ * Callbacks are InlineCallbacks: registering one never allocates.
  *
  * Usage:
  *   protocol.onTransportPlay = [](const TransportPlayMessage& msg) {
@@ -14,8 +15,8 @@
 
 #pragma once
 
+#include "InlineCallback.hpp"
 #include "MessageStructure.hpp"
-#include <functional>
 
 namespace Protocol {
 
@@ -28,98 +29,103 @@ public:
     // Typed callbacks (one per message)
     // ========================================================================
 
-    std::function<void(const DeviceChangeMessage&)> onDeviceChange;
-    std::function<void(const DeviceChangeHeaderMessage&)> onDeviceChangeHeader;
-    std::function<void(const DeviceChildrenMessage&)> onDeviceChildren;
-    std::function<void(const DeviceEnabledStateMessage&)> onDeviceEnabledState;
-    std::function<void(const DeviceListWindowMessage&)> onDeviceListWindow;
-    std::function<void(const DevicePageChangeMessage&)> onDevicePageChange;
-    std::function<void(const DevicePageNamesWindowMessage&)> onDevicePageNamesWindow;
-    std::function<void(const DevicePageSelectMessage&)> onDevicePageSelect;
-    std::function<void(const DeviceRemoteControlsBatchMessage&)> onDeviceRemoteControlsBatch;
-    std::function<void(const DeviceRemoteControlDiscreteValuesMessage&)> onDeviceRemoteControlDiscreteValues;
-    std::function<void(const DeviceRemoteControlHasAutomationChangeMessage&)> onDeviceRemoteControlHasAutomationChange;
-    std::function<void(const DeviceRemoteControlIsModulatedChangeMessage&)> onDeviceRemoteControlIsModulatedChange;
-    std::function<void(const DeviceRemoteControlNameChangeMessage&)> onDeviceRemoteControlNameChange;
-    std::function<void(const DeviceRemoteControlOriginChangeMessage&)> onDeviceRemoteControlOriginChange;
-    std::function<void(const DeviceRemoteControlRestoreAutomationMessage&)> onDeviceRemoteControlRestoreAutomation;
-    std::function<void(const DeviceRemoteControlTouchMessage&)> onDeviceRemoteControlTouch;
-    std::function<void(const DeviceRemoteControlUpdateMessage&)> onDeviceRemoteControlUpdate;
-    std::function<void(const DeviceSelectMessage&)> onDeviceSelect;
-    std::function<void(const DeviceStateMessage&)> onDeviceState;
-    std::function<void(const EnterDeviceChildMessage&)> onEnterDeviceChild;
-    std::function<void(const ExitToParentMessage&)> onExitToParent;
-    std::function<void(const RemoteControlValueMessage&)> onRemoteControlValue;
-    std::function<void(const RemoteControlValueStateMessage&)> onRemoteControlValueState;
-    std::function<void(const RequestDeviceChildrenMessage&)> onRequestDeviceChildren;
-    std::function<void(const RequestDeviceListWindowMessage&)> onRequestDeviceListWindow;
-    std::function<void(const RequestDevicePageNamesWindowMessage&)> onRequestDevicePageNamesWindow;
-    std::function<void(const ViewStateMessage&)> onViewState;
-    std::function<void(const LastClickedTouchMessage&)> onLastClickedTouch;
-    std::function<void(const LastClickedUpdateMessage&)> onLastClickedUpdate;
-    std::function<void(const LastClickedValueMessage&)> onLastClickedValue;
-    std::function<void(const LastClickedValueStateMessage&)> onLastClickedValueState;
-    std::function<void(const HostDeactivatedMessage&)> onHostDeactivated;
-    std::function<void(const HostInitializedMessage&)> onHostInitialized;
-    std::function<void(const RequestHostStatusMessage&)> onRequestHostStatus;
-    std::function<void(const EnterTrackGroupMessage&)> onEnterTrackGroup;
-    std::function<void(const ExitTrackGroupMessage&)> onExitTrackGroup;
-    std::function<void(const RequestSendDestinationsMessage&)> onRequestSendDestinations;
-    std::function<void(const RequestTrackListWindowMessage&)> onRequestTrackListWindow;
-    std::function<void(const RequestTrackSendListMessage&)> onRequestTrackSendList;
-    std::function<void(const SelectMixSendMessage&)> onSelectMixSend;
-    std::function<void(const SendDestinationsListMessage&)> onSendDestinationsList;
-    std::function<void(const TrackActivateMessage&)> onTrackActivate;
-    std::function<void(const TrackArmMessage&)> onTrackArm;
-    std::function<void(const TrackArmStateMessage&)> onTrackArmState;
-    std::function<void(const TrackChangeMessage&)> onTrackChange;
-    std::function<void(const TrackListWindowMessage&)> onTrackListWindow;
-    std::function<void(const TrackMuteMessage&)> onTrackMute;
-    std::function<void(const TrackMutedBySoloStateMessage&)> onTrackMutedBySoloState;
-    std::function<void(const TrackMuteStateMessage&)> onTrackMuteState;
-    std::function<void(const TrackPanMessage&)> onTrackPan;
-    std::function<void(const TrackPanHasAutomationStateMessage&)> onTrackPanHasAutomationState;
-    std::function<void(const TrackPanModulatedValueStateMessage&)> onTrackPanModulatedValueState;
-    std::function<void(const TrackPanStateMessage&)> onTrackPanState;
-    std::function<void(const TrackPanTouchMessage&)> onTrackPanTouch;
-    std::function<void(const TrackSelectMessage&)> onTrackSelect;
-    std::function<void(const TrackSendEnabledMessage&)> onTrackSendEnabled;
-    std::function<void(const TrackSendEnabledStateMessage&)> onTrackSendEnabledState;
-    std::function<void(const TrackSendHasAutomationStateMessage&)> onTrackSendHasAutomationState;
-    std::function<void(const TrackSendListMessage&)> onTrackSendList;
-    std::function<void(const TrackSendModeMessage&)> onTrackSendMode;
-    std::function<void(const TrackSendModeStateMessage&)> onTrackSendModeState;
-    std::function<void(const TrackSendModulatedValueStateMessage&)> onTrackSendModulatedValueState;
-    std::function<void(const TrackSendPreFaderStateMessage&)> onTrackSendPreFaderState;
-    std::function<void(const TrackSendTouchMessage&)> onTrackSendTouch;
-    std::function<void(const TrackSendValueMessage&)> onTrackSendValue;
-    std::function<void(const TrackSendValueStateMessage&)> onTrackSendValueState;
-    std::function<void(const TrackSoloMessage&)> onTrackSolo;
-    std::function<void(const TrackSoloStateMessage&)> onTrackSoloState;
-    std::function<void(const TrackVolumeMessage&)> onTrackVolume;
-    std::function<void(const TrackVolumeHasAutomationStateMessage&)> onTrackVolumeHasAutomationState;
-    std::function<void(const TrackVolumeModulatedValueStateMessage&)> onTrackVolumeModulatedValueState;
-    std::function<void(const TrackVolumeStateMessage&)> onTrackVolumeState;
-    std::function<void(const TrackVolumeTouchMessage&)> onTrackVolumeTouch;
-    std::function<void(const ResetAutomationOverridesMessage&)> onResetAutomationOverrides;
-    std::function<void(const TransportArrangerAutomationWriteEnabledMessage&)> onTransportArrangerAutomationWriteEnabled;
-    std::function<void(const TransportArrangerAutomationWriteEnabledStateMessage&)> onTransportArrangerAutomationWriteEnabledState;
-    std::function<void(const TransportArrangerOverdubEnabledMessage&)> onTransportArrangerOverdubEnabled;
-    std::function<void(const TransportArrangerOverdubEnabledStateMessage&)> onTransportArrangerOverdubEnabledState;
-    std::function<void(const TransportAutomationOverrideActiveStateMessage&)> onTransportAutomationOverrideActiveState;
-    std::function<void(const TransportAutomationWriteModeMessage&)> onTransportAutomationWriteMode;
-    std::function<void(const TransportAutomationWriteModeStateMessage&)> onTransportAutomationWriteModeState;
-    std::function<void(const TransportClipLauncherAutomationWriteEnabledMessage&)> onTransportClipLauncherAutomationWriteEnabled;
-    std::function<void(const TransportClipLauncherAutomationWriteEnabledStateMessage&)> onTransportClipLauncherAutomationWriteEnabledState;
-    std::function<void(const TransportClipLauncherOverdubEnabledMessage&)> onTransportClipLauncherOverdubEnabled;
-    std::function<void(const TransportClipLauncherOverdubEnabledStateMessage&)> onTransportClipLauncherOverdubEnabledState;
-    std::function<void(const TransportPlayMessage&)> onTransportPlay;
-    std::function<void(const TransportPlayingStateMessage&)> onTransportPlayingState;
-    std::function<void(const TransportRecordMessage&)> onTransportRecord;
-    std::function<void(const TransportRecordingStateMessage&)> onTransportRecordingState;
-    std::function<void(const TransportStopMessage&)> onTransportStop;
-    std::function<void(const TransportTempoMessage&)> onTransportTempo;
-    std::function<void(const TransportTempoStateMessage&)> onTransportTempoState;
+    InlineCallback<void(const DeviceChangeMessage&)> onDeviceChange;
+    InlineCallback<void(const DeviceChangeHeaderMessage&)> onDeviceChangeHeader;
+    InlineCallback<void(const DeviceChainStampMessage&)> onDeviceChainStamp;
+    InlineCallback<void(const DeviceChildrenMessage&)> onDeviceChildren;
+    InlineCallback<void(const DeviceEnabledStateMessage&)> onDeviceEnabledState;
+    InlineCallback<void(const DeviceListWindowMessage&)> onDeviceListWindow;
+    InlineCallback<void(const DevicePageChangeMessage&)> onDevicePageChange;
+    InlineCallback<void(const DevicePageNamesWindowMessage&)> onDevicePageNamesWindow;
+    InlineCallback<void(const DevicePageSelectMessage&)> onDevicePageSelect;
+    InlineCallback<void(const DeviceRemoteControlsBatchMessage&)> onDeviceRemoteControlsBatch;
+    InlineCallback<void(const DeviceRemoteControlDiscreteValuesMessage&)> onDeviceRemoteControlDiscreteValues;
+    InlineCallback<void(const DeviceRemoteControlHasAutomationChangeMessage&)> onDeviceRemoteControlHasAutomationChange;
+    InlineCallback<void(const DeviceRemoteControlIsModulatedChangeMessage&)> onDeviceRemoteControlIsModulatedChange;
+    InlineCallback<void(const DeviceRemoteControlNameChangeMessage&)> onDeviceRemoteControlNameChange;
+    InlineCallback<void(const DeviceRemoteControlOriginChangeMessage&)> onDeviceRemoteControlOriginChange;
+    InlineCallback<void(const DeviceRemoteControlRestoreAutomationMessage&)> onDeviceRemoteControlRestoreAutomation;
+    InlineCallback<void(const DeviceRemoteControlTouchMessage&)> onDeviceRemoteControlTouch;
+    InlineCallback<void(const DeviceRemoteControlUpdateMessage&)> onDeviceRemoteControlUpdate;
+    InlineCallback<void(const DeviceSelectMessage&)> onDeviceSelect;
+    InlineCallback<void(const DeviceStateMessage&)> onDeviceState;
+    InlineCallback<void(const EnterDeviceChildMessage&)> onEnterDeviceChild;
+    InlineCallback<void(const ExitToParentMessage&)> onExitToParent;
+    InlineCallback<void(const RemoteControlValueMessage&)> onRemoteControlValue;
+    InlineCallback<void(const RemoteControlValueStateMessage&)> onRemoteControlValueState;
+    InlineCallback<void(const RequestDeviceChildrenMessage&)> onRequestDeviceChildren;
+    InlineCallback<void(const RequestDeviceListWindowMessage&)> onRequestDeviceListWindow;
+    InlineCallback<void(const RequestDevicePageNamesWindowMessage&)> onRequestDevicePageNamesWindow;
+    InlineCallback<void(const ViewStateMessage&)> onViewState;
+    InlineCallback<void(const LastClickedTouchMessage&)> onLastClickedTouch;
+    InlineCallback<void(const LastClickedUpdateMessage&)> onLastClickedUpdate;
+    InlineCallback<void(const LastClickedValueMessage&)> onLastClickedValue;
+    InlineCallback<void(const LastClickedValueStateMessage&)> onLastClickedValueState;
+    InlineCallback<void(const FlowCreditMessage&)> onFlowCredit;
+    InlineCallback<void(const HostDeactivatedMessage&)> onHostDeactivated;
+    InlineCallback<void(const HostInitializedMessage&)> onHostInitialized;
+    InlineCallback<void(const RenderStatsMessage&)> onRenderStats;
+    InlineCallback<void(const RequestHostStatusMessage&)> onRequestHostStatus;
+    InlineCallback<void(const StringDefineMessage&)> onStringDefine;
+    InlineCallback<void(const StringMissMessage&)> onStringMiss;
+    InlineCallback<void(const EnterTrackGroupMessage&)> onEnterTrackGroup;
+    InlineCallback<void(const ExitTrackGroupMessage&)> onExitTrackGroup;
+    InlineCallback<void(const RequestSendDestinationsMessage&)> onRequestSendDestinations;
+    InlineCallback<void(const RequestTrackListWindowMessage&)> onRequestTrackListWindow;
+    InlineCallback<void(const RequestTrackSendListMessage&)> onRequestTrackSendList;
+    InlineCallback<void(const SelectMixSendMessage&)> onSelectMixSend;
+    InlineCallback<void(const SendDestinationsListMessage&)> onSendDestinationsList;
+    InlineCallback<void(const TrackActivateMessage&)> onTrackActivate;
+    InlineCallback<void(const TrackArmMessage&)> onTrackArm;
+    InlineCallback<void(const TrackArmStateMessage&)> onTrackArmState;
+    InlineCallback<void(const TrackChangeMessage&)> onTrackChange;
+    InlineCallback<void(const TrackListWindowMessage&)> onTrackListWindow;
+    InlineCallback<void(const TrackMuteMessage&)> onTrackMute;
+    InlineCallback<void(const TrackMutedBySoloStateMessage&)> onTrackMutedBySoloState;
+    InlineCallback<void(const TrackMuteStateMessage&)> onTrackMuteState;
+    InlineCallback<void(const TrackPanMessage&)> onTrackPan;
+    InlineCallback<void(const TrackPanHasAutomationStateMessage&)> onTrackPanHasAutomationState;
+    InlineCallback<void(const TrackPanModulatedValueStateMessage&)> onTrackPanModulatedValueState;
+    InlineCallback<void(const TrackPanStateMessage&)> onTrackPanState;
+    InlineCallback<void(const TrackPanTouchMessage&)> onTrackPanTouch;
+    InlineCallback<void(const TrackSelectMessage&)> onTrackSelect;
+    InlineCallback<void(const TrackSendEnabledMessage&)> onTrackSendEnabled;
+    InlineCallback<void(const TrackSendEnabledStateMessage&)> onTrackSendEnabledState;
+    InlineCallback<void(const TrackSendHasAutomationStateMessage&)> onTrackSendHasAutomationState;
+    InlineCallback<void(const TrackSendListMessage&)> onTrackSendList;
+    InlineCallback<void(const TrackSendModeMessage&)> onTrackSendMode;
+    InlineCallback<void(const TrackSendModeStateMessage&)> onTrackSendModeState;
+    InlineCallback<void(const TrackSendModulatedValueStateMessage&)> onTrackSendModulatedValueState;
+    InlineCallback<void(const TrackSendPreFaderStateMessage&)> onTrackSendPreFaderState;
+    InlineCallback<void(const TrackSendTouchMessage&)> onTrackSendTouch;
+    InlineCallback<void(const TrackSendValueMessage&)> onTrackSendValue;
+    InlineCallback<void(const TrackSendValueStateMessage&)> onTrackSendValueState;
+    InlineCallback<void(const TrackSoloMessage&)> onTrackSolo;
+    InlineCallback<void(const TrackSoloStateMessage&)> onTrackSoloState;
+    InlineCallback<void(const TrackVolumeMessage&)> onTrackVolume;
+    InlineCallback<void(const TrackVolumeHasAutomationStateMessage&)> onTrackVolumeHasAutomationState;
+    InlineCallback<void(const TrackVolumeModulatedValueStateMessage&)> onTrackVolumeModulatedValueState;
+    InlineCallback<void(const TrackVolumeStateMessage&)> onTrackVolumeState;
+    InlineCallback<void(const TrackVolumeTouchMessage&)> onTrackVolumeTouch;
+    InlineCallback<void(const ResetAutomationOverridesMessage&)> onResetAutomationOverrides;
+    InlineCallback<void(const TransportArrangerAutomationWriteEnabledMessage&)> onTransportArrangerAutomationWriteEnabled;
+    InlineCallback<void(const TransportArrangerAutomationWriteEnabledStateMessage&)> onTransportArrangerAutomationWriteEnabledState;
+    InlineCallback<void(const TransportArrangerOverdubEnabledMessage&)> onTransportArrangerOverdubEnabled;
+    InlineCallback<void(const TransportArrangerOverdubEnabledStateMessage&)> onTransportArrangerOverdubEnabledState;
+    InlineCallback<void(const TransportAutomationOverrideActiveStateMessage&)> onTransportAutomationOverrideActiveState;
+    InlineCallback<void(const TransportAutomationWriteModeMessage&)> onTransportAutomationWriteMode;
+    InlineCallback<void(const TransportAutomationWriteModeStateMessage&)> onTransportAutomationWriteModeState;
+    InlineCallback<void(const TransportClipLauncherAutomationWriteEnabledMessage&)> onTransportClipLauncherAutomationWriteEnabled;
+    InlineCallback<void(const TransportClipLauncherAutomationWriteEnabledStateMessage&)> onTransportClipLauncherAutomationWriteEnabledState;
+    InlineCallback<void(const TransportClipLauncherOverdubEnabledMessage&)> onTransportClipLauncherOverdubEnabled;
+    InlineCallback<void(const TransportClipLauncherOverdubEnabledStateMessage&)> onTransportClipLauncherOverdubEnabledState;
+    InlineCallback<void(const TransportPlayMessage&)> onTransportPlay;
+    InlineCallback<void(const TransportPlayingStateMessage&)> onTransportPlayingState;
+    InlineCallback<void(const TransportRecordMessage&)> onTransportRecord;
+    InlineCallback<void(const TransportRecordingStateMessage&)> onTransportRecordingState;
+    InlineCallback<void(const TransportStopMessage&)> onTransportStop;
+    InlineCallback<void(const TransportTempoMessage&)> onTransportTempo;
+    InlineCallback<void(const TransportTempoStateMessage&)> onTransportTempoState;
 
 protected:
     ProtocolCallbacks() = default;
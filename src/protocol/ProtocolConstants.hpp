@@ -1,7 +1,7 @@
 /**
  * ProtocolConstants.hpp - Protocol Configuration Constants (Binary)
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: BinaryConfig
  *
  * This file contains all protocol constants including message structure
@@ -25,6 +25,9 @@ namespace Protocol {
 constexpr uint8_t MESSAGE_TYPE_OFFSET = 0;  // Position of MessageID byte
 constexpr uint8_t PAYLOAD_OFFSET = 1;          // Start of payload data
 constexpr uint8_t MIN_MESSAGE_LENGTH = 1;  // Minimum valid message size
+constexpr uint8_t COMPACT_FRAME_FLAG = 0x80;  // MessageID byte flag: no MESSAGE_NAME prefix
+constexpr uint8_t MESSAGE_ID_MASK = 0x7F;     // MessageID bits of the type byte
+constexpr uint8_t ENVELOPE_MESSAGE_ID = 0x7F; // Reserved ID: frame packs several compact records
 
 // ============================================================================
 // ENCODING LIMITS
@@ -34,6 +37,9 @@ constexpr uint8_t STRING_MAX_LENGTH = 32;  // Max chars per string (8-bit length
 constexpr uint8_t ARRAY_MAX_ITEMS = 32;    // Max items per array (8-bit count)
 constexpr uint16_t MAX_PAYLOAD_SIZE = 10000;  // Max payload bytes
 constexpr uint16_t MAX_MESSAGE_SIZE = 16000;  // Max total message bytes
+constexpr uint16_t MAX_TO_HOST_PAYLOAD_SIZE = 35;  // Largest Controller -> Host payload
+constexpr uint16_t MAX_ENVELOPE_SIZE = 512;   // Max envelope frame bytes
+constexpr uint8_t MAX_ENVELOPE_RECORD_SIZE = 255;  // Max record bytes (8-bit length)
 
 
 }  // namespace Protocol
@@ -1,7 +1,7 @@
 /**
  * ProtocolMethods.ipp - Explicit Protocol API (inline include)
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  *
  * This file provides explicit send methods for TO_HOST messages.
  * Include this file inside your Protocol class definition.
@@ -58,12 +58,12 @@
         send(Protocol::RequestDeviceChildrenMessage{deviceIndex, childType});
     }
 
-    void requestDeviceListWindow(uint8_t deviceStartIndex) {
-        send(Protocol::RequestDeviceListWindowMessage{deviceStartIndex});
+    void requestDeviceListWindow(uint8_t deviceStartIndex, uint8_t windowSize) {
+        send(Protocol::RequestDeviceListWindowMessage{deviceStartIndex, windowSize});
     }
 
-    void requestDevicePageNamesWindow(uint8_t pageStartIndex) {
-        send(Protocol::RequestDevicePageNamesWindowMessage{pageStartIndex});
+    void requestDevicePageNamesWindow(uint8_t pageStartIndex, uint8_t windowSize) {
+        send(Protocol::RequestDevicePageNamesWindowMessage{pageStartIndex, windowSize});
     }
 
     void viewState(ViewType viewType, bool selectorActive) {
@@ -78,8 +78,20 @@
         send(Protocol::LastClickedValueMessage{parameterValue});
     }
 
-    void requestHostStatus() {
-        send(Protocol::RequestHostStatusMessage{});
+    void flowCredit(uint16_t receivedBytes, uint16_t windowBytes, uint8_t batchLosses) {
+        send(Protocol::FlowCreditMessage{receivedBytes, windowBytes, batchLosses});
+    }
+
+    void renderStats(uint8_t renderHz, uint16_t frameTimeUs, uint8_t headroomPercent) {
+        send(Protocol::RenderStatsMessage{renderHz, frameTimeUs, headroomPercent});
+    }
+
+    void requestHostStatus(bool compactFrames) {
+        send(Protocol::RequestHostStatusMessage{compactFrames});
+    }
+
+    void stringMiss(uint16_t stringId) {
+        send(Protocol::StringMissMessage{stringId});
     }
 
     void enterTrackGroup(uint8_t trackIndex) {
@@ -94,8 +106,8 @@
         send(Protocol::RequestSendDestinationsMessage{});
     }
 
-    void requestTrackListWindow(uint8_t trackStartIndex) {
-        send(Protocol::RequestTrackListWindowMessage{trackStartIndex});
+    void requestTrackListWindow(uint8_t trackStartIndex, uint8_t windowSize) {
+        send(Protocol::RequestTrackListWindowMessage{trackStartIndex, windowSize});
     }
 
     void requestTrackSendList() {
@@ -134,7 +146,7 @@
         send(Protocol::TrackSendEnabledMessage{trackIndex, sendIndex, sendIsEnabled});
     }
 
-    void trackSendMode(uint8_t trackIndex, uint8_t sendIndex, const std::string& sendMode) {
+    void trackSendMode(uint8_t trackIndex, uint8_t sendIndex, std::string_view sendMode) {
         send(Protocol::TrackSendModeMessage{trackIndex, sendIndex, sendMode});
     }
 
@@ -0,0 +1,115 @@
+#pragma once
+
+/**
+ * @file SequenceTracker.hpp
+ * @brief Stale-drop and loss accounting for sequence-numbered streams
+ *
+ * DEVICE_REMOTE_CONTROLS_BATCH carries a uint8 sequence number incremented by
+ * the host on every batch. Compared modulo 256 against the next expected one:
+ *
+ * - diff == 0                    in order
+ * - 0 < diff <= MAX_GAP          (diff) batches lost in transit, accept
+ * - -STALE_WINDOW <= diff < 0    older than the newest frame (reordered)
+ * - anything else                host restarted its counter, resync and accept
+ *
+ * Batches are sparse deltas: a reordered batch may carry the only update of
+ * a slot the newer one did not touch. SlotSequences keeps the sequence last
+ * applied per slot, so a stale batch still applies the slots no newer batch
+ * has written. Lost batches are reported to the host (FLOW_CREDIT), which
+ * resends every slot.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bitwig {
+
+/**
+ * @brief Link-quality counters for one sequenced stream
+ */
+struct SequenceStats {
+    uint32_t received = 0;  ///< Frames seen (accepted + stale)
+    uint32_t stale = 0;     ///< Dropped as older than the last accepted frame
+    uint32_t lost = 0;      ///< Frames skipped by forward gaps
+    uint32_t gaps = 0;      ///< Number of forward gaps (loss events)
+    uint32_t resyncs = 0;   ///< Counter restarts (host reconnect, jump out of range)
+};
+
+class SequenceTracker {
+public:
+    static constexpr int STALE_WINDOW = 32;
+    static constexpr int MAX_GAP = 64;
+
+    enum class Verdict : uint8_t { IN_ORDER, GAP, STALE, RESYNC };
+
+    /// Classify @p sequence and update the counters
+    Verdict accept(uint8_t sequence) {
+        ++stats_.received;
+
+        if (!synced_) {
+            synced_ = true;
+            expected_ = static_cast<uint8_t>(sequence + 1);
+            return Verdict::IN_ORDER;
+        }
+
+        int diff = static_cast<int8_t>(static_cast<uint8_t>(sequence - expected_));
+        if (diff == 0) {
+            expected_ = static_cast<uint8_t>(sequence + 1);
+            return Verdict::IN_ORDER;
+        }
+        if (diff > 0 && diff <= MAX_GAP) {
+            stats_.lost += static_cast<uint32_t>(diff);
+            ++stats_.gaps;
+            expected_ = static_cast<uint8_t>(sequence + 1);
+            return Verdict::GAP;
+        }
+        if (diff < 0 && diff >= -STALE_WINDOW) {
+            ++stats_.stale;
+            return Verdict::STALE;
+        }
+
+        ++stats_.resyncs;
+        expected_ = static_cast<uint8_t>(sequence + 1);
+        return Verdict::RESYNC;
+    }
+
+    /// Forget the expected sequence (next frame is accepted as-is)
+    void resync() { synced_ = false; }
+
+    const SequenceStats& stats() const { return stats_; }
+
+private:
+    SequenceStats stats_;
+    uint8_t expected_ = 0;
+    bool synced_ = false;
+};
+
+/**
+ * @brief Sequence last applied to each slot of a sparse stream
+ */
+template <size_t Slots>
+class SlotSequences {
+public:
+    static_assert(Slots <= 32, "Written slots are stored on 32 bits");
+
+    /// Record @p sequence for @p slot; false if a newer frame already wrote it
+    bool apply(size_t slot, uint8_t sequence) {
+        uint32_t bit = uint32_t{1} << slot;
+        int diff = static_cast<int8_t>(static_cast<uint8_t>(sequence - last_[slot]));
+        if ((written_ & bit) && diff < 0) {
+            return false;
+        }
+        last_[slot] = sequence;
+        written_ |= bit;
+        return true;
+    }
+
+    /// Forget every slot (counter restart: any sequence applies)
+    void reset() { written_ = 0; }
+
+private:
+    uint8_t last_[Slots] = {};
+    uint32_t written_ = 0;
+};
+
+}  // namespace bitwig
@@ -0,0 +1,126 @@
+#pragma once
+
+/**
+ * @file StringDictionary.hpp
+ * @brief Controller side of the host-assigned string dictionary
+ *
+ * Device, page, track and parameter names are re-sent by DEVICE_CHANGE_HEADER,
+ * DEVICE_PAGE_CHANGE and the selector windows after every navigation. The
+ * host sends each such name once with STRING_DEFINE(stringId, text); later
+ * messages carry a 3-byte reference in the name field instead of the text:
+ *
+ *   [REFERENCE_MARKER][stringId lo][stringId hi]
+ *
+ * Handlers pass name fields through resolve(), which returns plain strings
+ * unchanged, so hosts that never define strings keep working.
+ *
+ * The host owns eviction: it keeps the CAPACITY most recently used names and
+ * builds IDs as (generation << SLOT_BITS) | slot. Reusing a slot bumps its
+ * generation, so a reference to an evicted or lost definition is detected
+ * here as a miss (reported back with STRING_MISS) instead of resolving to
+ * another name. The host answers a miss with the definition and the message
+ * that carried the reference again, so a lost STRING_DEFINE only blanks the
+ * name for a round trip. Memory is fixed: CAPACITY slots of STRING_MAX_LENGTH
+ * chars.
+ *
+ * Both sides start over empty at every HOST_INITIALIZED.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "ProtocolConstants.hpp"
+
+namespace bitwig {
+
+class StringDictionary {
+public:
+    static constexpr uint8_t SLOT_BITS = 7;
+    static constexpr size_t CAPACITY = size_t{1} << SLOT_BITS;  // Must match StringDictionary.java
+    static constexpr size_t MAX_LENGTH = Protocol::STRING_MAX_LENGTH;
+    static constexpr char REFERENCE_MARKER = '\x1F';  // ASCII unit separator, never in names
+    static constexpr size_t REFERENCE_LENGTH = 3;
+    static constexpr size_t MAX_PENDING_MISSES = 8;
+
+    struct Stats {
+        uint32_t defined = 0;
+        uint32_t resolved = 0;
+        uint32_t misses = 0;
+    };
+
+    static bool isReference(std::string_view s) {
+        return s.size() == REFERENCE_LENGTH && s[0] == REFERENCE_MARKER;
+    }
+
+    /// Store (or replace) the string of @p id's slot
+    void define(uint16_t id, std::string_view text) {
+        Entry& entry = slots_[id & SLOT_MASK];
+        entry.id = id;
+        entry.valid = true;
+        entry.length = static_cast<uint8_t>(std::min(text.size(), MAX_LENGTH));
+        std::memcpy(entry.text, text.data(), entry.length);
+        ++stats_.defined;
+    }
+
+    /**
+     * @brief Text of a name field
+     *
+     * @return @p s itself if it is not a reference, the dictionary text
+     *         (valid until the slot is redefined), or an empty view on a miss
+     */
+    std::string_view resolve(std::string_view s) {
+        if (!isReference(s)) return s;
+
+        uint16_t id = static_cast<uint16_t>(static_cast<uint8_t>(s[1]) | (static_cast<uint8_t>(s[2]) << 8));
+        const Entry& entry = slots_[id & SLOT_MASK];
+        if (entry.valid && entry.id == id) {
+            ++stats_.resolved;
+            return {entry.text, entry.length};
+        }
+
+        ++stats_.misses;
+        queueMiss(id);
+        return {};
+    }
+
+    /// Next unknown ID to report with STRING_MISS (each reported once)
+    bool takeMiss(uint16_t& id) {
+        if (miss_count_ == 0) return false;
+        id = pending_misses_[--miss_count_];
+        return true;
+    }
+
+    void clear() {
+        for (auto& entry : slots_) entry.valid = false;
+        miss_count_ = 0;
+    }
+
+    const Stats& stats() const { return stats_; }
+
+private:
+    static constexpr uint16_t SLOT_MASK = CAPACITY - 1;
+
+    struct Entry {
+        uint16_t id;
+        uint8_t length;
+        bool valid;
+        char text[MAX_LENGTH];
+    };
+
+    void queueMiss(uint16_t id) {
+        for (size_t i = 0; i < miss_count_; ++i) {
+            if (pending_misses_[i] == id) return;
+        }
+        if (miss_count_ < MAX_PENDING_MISSES) pending_misses_[miss_count_++] = id;
+    }
+
+    Entry slots_[CAPACITY] = {};
+    uint16_t pending_misses_[MAX_PENDING_MISSES] = {};
+    size_t miss_count_ = 0;
+    Stats stats_;
+};
+
+}  // namespace bitwig
@@ -0,0 +1,28 @@
+#pragma once
+
+/**
+ * ViewList.hpp
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ */
+
+// Fixed-capacity list of string views, used for variable-length string arrays
+// when the protocol is generated in view decode mode.
+
+#include <cstddef>
+#include <string_view>
+
+#include "BoundedList.hpp"
+
+namespace Protocol {
+
+/**
+ * Bounded list of string views into a received payload
+ *
+ * Replaces std::vector<std::string> in decoded messages: no heap allocation,
+ * items point into the frame and are only valid during the callback.
+ */
+template <size_t N>
+using ViewList = BoundedList<std::string_view, N>;
+
+}  // namespace Protocol
@@ -0,0 +1,108 @@
+/**
+ * DeviceChainStampMessage.hpp - Auto-generated Protocol Struct
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ * Generated from: types.yaml
+ *
+ * Description: DEVICE_CHAIN_STAMP message
+ *
+ * This struct uses encode/decode functions from Protocol namespace.
+ * All encoding is 8-bit binary (Binary). Performance is identical to inline
+ * code due to static inline + compiler optimization.
+ */
+
+#pragma once
+
+#include "../Encoder.hpp"
+#include "../Decoder.hpp"
+#include "../MessageID.hpp"
+#include "../ProtocolConstants.hpp"
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+namespace Protocol {
+
+
+
+struct DeviceChainStampMessage {
+    // Auto-detected MessageID for protocol.send()
+    static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_CHAIN_STAMP;
+
+    // Message name for logging (framed by the protocol layer, not the codec)
+    static constexpr const char* MESSAGE_NAME = "DeviceChainStamp";
+
+    uint32_t chainIdentity;
+    uint32_t chainStamp;
+    uint8_t deviceCount;
+    uint8_t deviceIndex;
+    bool isNested;
+    bool windowFollows;
+
+    /**
+     * Maximum payload size in bytes (8-bit encoded)
+     */
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 12;
+
+    /**
+     * Minimum payload size in bytes (with empty strings)
+     */
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 12;
+
+    /**
+     * Encode struct to MIDI-safe bytes
+     *
+     * @param buffer Output buffer (must have >= MAX_PAYLOAD_SIZE bytes)
+     * @param bufferSize Size of output buffer
+     * @return Number of bytes written, or 0 if buffer too small
+     */
+    uint16_t encode(uint8_t* buffer, uint16_t bufferSize) const {
+        if (bufferSize < MAX_PAYLOAD_SIZE) return 0;
+
+        uint8_t* ptr = buffer;
+
+        Encoder::encodeUint32(ptr, chainIdentity);
+        Encoder::encodeUint32(ptr, chainStamp);
+        Encoder::encodeUint8(ptr, deviceCount);
+        Encoder::encodeUint8(ptr, deviceIndex);
+        Encoder::encodeBool(ptr, isNested);
+        Encoder::encodeBool(ptr, windowFollows);
+
+        return ptr - buffer;
+    }
+
+    /**
+     * Decode struct from MIDI-safe bytes
+     *
+     * @param data Input buffer with encoded data
+     * @param len Length of input buffer
+     * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     */
+    static std::optional<DeviceChainStampMessage> decode(
+        const uint8_t* data, uint16_t len) {
+
+        if (len < MIN_PAYLOAD_SIZE) return std::nullopt;
+
+        const uint8_t* ptr = data;
+        size_t remaining = len;
+
+        // Decode fields
+        uint32_t chainIdentity;
+        if (!Decoder::decodeUint32(ptr, remaining, chainIdentity)) return std::nullopt;
+        uint32_t chainStamp;
+        if (!Decoder::decodeUint32(ptr, remaining, chainStamp)) return std::nullopt;
+        uint8_t deviceCount;
+        if (!Decoder::decodeUint8(ptr, remaining, deviceCount)) return std::nullopt;
+        uint8_t deviceIndex;
+        if (!Decoder::decodeUint8(ptr, remaining, deviceIndex)) return std::nullopt;
+        bool isNested;
+        if (!Decoder::decodeBool(ptr, remaining, isNested)) return std::nullopt;
+        bool windowFollows;
+        if (!Decoder::decodeBool(ptr, remaining, windowFollows)) return std::nullopt;
+
+        return DeviceChainStampMessage{chainIdentity, chainStamp, deviceCount, deviceIndex, isNested, windowFollows};
+    }
+
+};
+
+}  // namespace Protocol
@@ -1,7 +1,7 @@
 /**
  * DeviceChangeHeaderMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_CHANGE_HEADER message
@@ -22,7 +22,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -33,7 +33,7 @@ namespace Protocol {
 struct PageInfo {
     uint8_t devicePageIndex;
     uint8_t devicePageCount;
-    std::string devicePageName;
+    std::string_view devicePageName;
 };
 
 #endif // PROTOCOL_PAGEINFO_STRUCT
@@ -42,24 +42,26 @@ struct DeviceChangeHeaderMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_CHANGE_HEADER;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "DeviceChangeHeader";
 
-    std::string deviceName;
+    std::string_view deviceName;
     bool isEnabled;
     DeviceType deviceType;
     PageInfo pageInfo;
     std::array<uint8_t, 4> childrenTypes;
+    uint32_t deviceIdentity;
+    uint32_t pageNamesHash;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 94;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 83;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 26;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 15;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -73,12 +75,6 @@ struct DeviceChangeHeaderMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeString(ptr, deviceName);
         Encoder::encodeBool(ptr, isEnabled);
         Encoder::encodeUint8(ptr, static_cast<uint8_t>(deviceType));
@@ -89,6 +85,8 @@ struct DeviceChangeHeaderMessage {
         for (const auto& item : childrenTypes) {
             Encoder::encodeUint8(ptr, item);
         }
+        Encoder::encodeUint32(ptr, deviceIdentity);
+        Encoder::encodeUint32(ptr, pageNamesHash);
 
         return ptr - buffer;
     }
@@ -99,6 +97,8 @@ struct DeviceChangeHeaderMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<DeviceChangeHeaderMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -108,15 +108,9 @@ struct DeviceChangeHeaderMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
-        std::string deviceName;
-        if (!Decoder::decodeString(ptr, remaining, deviceName)) return std::nullopt;
+        std::string_view deviceName;
+        if (!Decoder::decodeStringView(ptr, remaining, deviceName)) return std::nullopt;
         bool isEnabled;
         if (!Decoder::decodeBool(ptr, remaining, isEnabled)) return std::nullopt;
         uint8_t deviceType_raw;
@@ -125,15 +119,19 @@ struct DeviceChangeHeaderMessage {
         PageInfo pageInfo_data;
         if (!Decoder::decodeUint8(ptr, remaining, pageInfo_data.devicePageIndex)) return std::nullopt;
         if (!Decoder::decodeUint8(ptr, remaining, pageInfo_data.devicePageCount)) return std::nullopt;
-        if (!Decoder::decodeString(ptr, remaining, pageInfo_data.devicePageName)) return std::nullopt;
+        if (!Decoder::decodeStringView(ptr, remaining, pageInfo_data.devicePageName)) return std::nullopt;
         std::array<uint8_t, 4> childrenTypes_data;
         uint8_t count_childrenTypes;
         if (!Decoder::decodeUint8(ptr, remaining, count_childrenTypes)) return std::nullopt;
         for (uint8_t i = 0; i < count_childrenTypes && i < 4; ++i) {
             if (!Decoder::decodeUint8(ptr, remaining, childrenTypes_data[i])) return std::nullopt;
         }
+        uint32_t deviceIdentity;
+        if (!Decoder::decodeUint32(ptr, remaining, deviceIdentity)) return std::nullopt;
+        uint32_t pageNamesHash;
+        if (!Decoder::decodeUint32(ptr, remaining, pageNamesHash)) return std::nullopt;
 
-        return DeviceChangeHeaderMessage{deviceName, isEnabled, deviceType, pageInfo_data, childrenTypes_data};
+        return DeviceChangeHeaderMessage{deviceName, isEnabled, deviceType, pageInfo_data, childrenTypes_data, deviceIdentity, pageNamesHash};
     }
 
 };
@@ -1,7 +1,7 @@
 /**
  * DeviceChangeMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_CHANGE message
@@ -17,13 +17,13 @@
 #include "../Decoder.hpp"
 #include "../MessageID.hpp"
 #include "../ProtocolConstants.hpp"
+#include "../ViewList.hpp"
 #include "../ParameterType.hpp"
 #include <array>
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
-#include <vector>
+#include <string_view>
 
 namespace Protocol {
 
@@ -34,7 +34,7 @@ namespace Protocol {
 struct PageInfo {
     uint8_t devicePageIndex;
     uint8_t devicePageCount;
-    std::string devicePageName;
+    std::string_view devicePageName;
 };
 
 #endif // PROTOCOL_PAGEINFO_STRUCT
@@ -45,13 +45,13 @@ struct PageInfo {
 struct RemoteControls {
     uint8_t remoteControlIndex;
     float parameterValue;
-    std::string parameterName;
+    std::string_view parameterName;
     float parameterOrigin;
     bool parameterExists;
     int16_t discreteValueCount;
-    std::string displayValue;
+    std::string_view displayValue;
     ParameterType parameterType;
-    std::vector<std::string> discreteValueNames;
+    ViewList<32> discreteValueNames;
     uint8_t currentValueIndex;
     bool hasAutomation;
     float modulatedValue;
@@ -64,11 +64,11 @@ struct DeviceChangeMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_CHANGE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "DeviceChange";
 
-    std::string deviceTrackName;
-    std::string deviceName;
+    std::string_view deviceTrackName;
+    std::string_view deviceName;
     bool isEnabled;
     PageInfo pageInfo;
     std::array<RemoteControls, 8> remoteControls;
@@ -76,12 +76,12 @@ struct DeviceChangeMessage {
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 9260;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 9247;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 20;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 7;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -95,12 +95,6 @@ struct DeviceChangeMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeString(ptr, deviceTrackName);
         Encoder::encodeString(ptr, deviceName);
         Encoder::encodeBool(ptr, isEnabled);
@@ -136,6 +130,8 @@ struct DeviceChangeMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<DeviceChangeMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -145,23 +141,17 @@ struct DeviceChangeMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
-        std::string deviceTrackName;
-        if (!Decoder::decodeString(ptr, remaining, deviceTrackName)) return std::nullopt;
-        std::string deviceName;
-        if (!Decoder::decodeString(ptr, remaining, deviceName)) return std::nullopt;
+        std::string_view deviceTrackName;
+        if (!Decoder::decodeStringView(ptr, remaining, deviceTrackName)) return std::nullopt;
+        std::string_view deviceName;
+        if (!Decoder::decodeStringView(ptr, remaining, deviceName)) return std::nullopt;
         bool isEnabled;
         if (!Decoder::decodeBool(ptr, remaining, isEnabled)) return std::nullopt;
         PageInfo pageInfo_data;
         if (!Decoder::decodeUint8(ptr, remaining, pageInfo_data.devicePageIndex)) return std::nullopt;
         if (!Decoder::decodeUint8(ptr, remaining, pageInfo_data.devicePageCount)) return std::nullopt;
-        if (!Decoder::decodeString(ptr, remaining, pageInfo_data.devicePageName)) return std::nullopt;
+        if (!Decoder::decodeStringView(ptr, remaining, pageInfo_data.devicePageName)) return std::nullopt;
         uint8_t count_remoteControls;
         if (!Decoder::decodeUint8(ptr, remaining, count_remoteControls)) return std::nullopt;
         std::array<RemoteControls, 8> remoteControls_data;
@@ -169,19 +159,19 @@ struct DeviceChangeMessage {
             RemoteControls item;
             if (!Decoder::decodeUint8(ptr, remaining, item.remoteControlIndex)) return std::nullopt;
             if (!Decoder::decodeFloat32(ptr, remaining, item.parameterValue)) return std::nullopt;
-            if (!Decoder::decodeString(ptr, remaining, item.parameterName)) return std::nullopt;
+            if (!Decoder::decodeStringView(ptr, remaining, item.parameterName)) return std::nullopt;
             if (!Decoder::decodeFloat32(ptr, remaining, item.parameterOrigin)) return std::nullopt;
             if (!Decoder::decodeBool(ptr, remaining, item.parameterExists)) return std::nullopt;
             if (!Decoder::decodeInt16(ptr, remaining, item.discreteValueCount)) return std::nullopt;
-            if (!Decoder::decodeString(ptr, remaining, item.displayValue)) return std::nullopt;
+            if (!Decoder::decodeStringView(ptr, remaining, item.displayValue)) return std::nullopt;
             uint8_t parameterType_raw;
             if (!Decoder::decodeUint8(ptr, remaining, parameterType_raw)) return std::nullopt;
             item.parameterType = static_cast<ParameterType>(parameterType_raw);
             uint8_t count_discreteValueNames;
             if (!Decoder::decodeUint8(ptr, remaining, count_discreteValueNames)) return std::nullopt;
             for (uint8_t j = 0; j < count_discreteValueNames && j < 32; ++j) {
-                std::string temp_discreteValueNames;
-                if (!Decoder::decodeString(ptr, remaining, temp_discreteValueNames)) return std::nullopt;
+                std::string_view temp_discreteValueNames;
+                if (!Decoder::decodeStringView(ptr, remaining, temp_discreteValueNames)) return std::nullopt;
                 item.discreteValueNames.push_back(temp_discreteValueNames);
             }
             if (!Decoder::decodeUint8(ptr, remaining, item.currentValueIndex)) return std::nullopt;
@@ -1,7 +1,7 @@
 /**
  * DeviceChildrenMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_CHILDREN message
@@ -22,7 +22,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -32,7 +32,7 @@ namespace Protocol {
 
 struct Children {
     uint8_t childIndex;
-    std::string childName;
+    std::string_view childName;
     uint8_t itemType;
 };
 
@@ -42,7 +42,7 @@ struct DeviceChildrenMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_CHILDREN;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "DeviceChildren";
 
     uint8_t deviceIndex;
@@ -53,12 +53,12 @@ struct DeviceChildrenMessage {
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 579;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 564;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 19;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 4;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -72,12 +72,6 @@ struct DeviceChildrenMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, deviceIndex);
         Encoder::encodeUint8(ptr, static_cast<uint8_t>(childType));
         Encoder::encodeUint8(ptr, childrenCount);
@@ -97,6 +91,8 @@ struct DeviceChildrenMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<DeviceChildrenMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -106,12 +102,6 @@ struct DeviceChildrenMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t deviceIndex;
         if (!Decoder::decodeUint8(ptr, remaining, deviceIndex)) return std::nullopt;
@@ -125,7 +115,7 @@ struct DeviceChildrenMessage {
         for (uint8_t i = 0; i < count_children && i < 16; ++i) {
             Children item;
             if (!Decoder::decodeUint8(ptr, remaining, item.childIndex)) return std::nullopt;
-            if (!Decoder::decodeString(ptr, remaining, item.childName)) return std::nullopt;
+            if (!Decoder::decodeStringView(ptr, remaining, item.childName)) return std::nullopt;
             if (!Decoder::decodeUint8(ptr, remaining, item.itemType)) return std::nullopt;
             children_data[i] = item;
         }
@@ -1,7 +1,7 @@
 /**
  * DeviceEnabledStateMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_ENABLED_STATE message
@@ -29,7 +29,7 @@ struct DeviceEnabledStateMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_ENABLED_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "DeviceEnabledState";
 
     uint8_t deviceIndex;
@@ -38,12 +38,12 @@ struct DeviceEnabledStateMessage {
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 21;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 2;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 21;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 2;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -57,12 +57,6 @@ struct DeviceEnabledStateMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, deviceIndex);
         Encoder::encodeBool(ptr, isEnabled);
 
@@ -84,12 +78,6 @@ struct DeviceEnabledStateMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t deviceIndex;
         if (!Decoder::decodeUint8(ptr, remaining, deviceIndex)) return std::nullopt;
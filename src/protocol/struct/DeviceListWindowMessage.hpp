@@ -1,7 +1,7 @@
 /**
  * DeviceListWindowMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_LIST_WINDOW message
@@ -17,12 +17,13 @@
 #include "../Decoder.hpp"
 #include "../MessageID.hpp"
 #include "../ProtocolConstants.hpp"
+#include "../BoundedList.hpp"
 #include "../DeviceType.hpp"
 #include <array>
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -32,7 +33,7 @@ namespace Protocol {
 
 struct Devices {
     uint8_t deviceIndex;
-    std::string deviceName;
+    std::string_view deviceName;
     bool isEnabled;
     DeviceType deviceType;
     std::array<uint8_t, 4> childrenTypes;
@@ -44,15 +45,16 @@ struct DeviceListWindowMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_LIST_WINDOW;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "DeviceListWindow";
 
     uint8_t deviceCount;
     uint8_t deviceStartIndex;
     uint8_t deviceIndex;
     bool isNested;
-    std::string parentName;
+    std::string_view parentName;
     std::array<Devices, 16> devices;
+    BoundedList<uint8_t, 16> deviceNamePrefixes;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
@@ -62,7 +64,7 @@ struct DeviceListWindowMessage {
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 23;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 7;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -76,12 +78,6 @@ struct DeviceListWindowMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, deviceCount);
         Encoder::encodeUint8(ptr, deviceStartIndex);
         Encoder::encodeUint8(ptr, deviceIndex);
@@ -98,6 +94,10 @@ struct DeviceListWindowMessage {
                 Encoder::encodeUint8(ptr, type);
             }
         }
+        Encoder::encodeUint8(ptr, deviceNamePrefixes.size());
+        for (const auto& item : deviceNamePrefixes) {
+            Encoder::encodeUint8(ptr, item);
+        }
 
         return ptr - buffer;
     }
@@ -108,6 +108,8 @@ struct DeviceListWindowMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<DeviceListWindowMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -117,12 +119,6 @@ struct DeviceListWindowMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t deviceCount;
         if (!Decoder::decodeUint8(ptr, remaining, deviceCount)) return std::nullopt;
@@ -132,15 +128,15 @@ struct DeviceListWindowMessage {
         if (!Decoder::decodeUint8(ptr, remaining, deviceIndex)) return std::nullopt;
         bool isNested;
         if (!Decoder::decodeBool(ptr, remaining, isNested)) return std::nullopt;
-        std::string parentName;
-        if (!Decoder::decodeString(ptr, remaining, parentName)) return std::nullopt;
+        std::string_view parentName;
+        if (!Decoder::decodeStringView(ptr, remaining, parentName)) return std::nullopt;
         uint8_t count_devices;
         if (!Decoder::decodeUint8(ptr, remaining, count_devices)) return std::nullopt;
         std::array<Devices, 16> devices_data;
         for (uint8_t i = 0; i < count_devices && i < 16; ++i) {
             Devices item;
             if (!Decoder::decodeUint8(ptr, remaining, item.deviceIndex)) return std::nullopt;
-            if (!Decoder::decodeString(ptr, remaining, item.deviceName)) return std::nullopt;
+            if (!Decoder::decodeStringView(ptr, remaining, item.deviceName)) return std::nullopt;
             if (!Decoder::decodeBool(ptr, remaining, item.isEnabled)) return std::nullopt;
             uint8_t deviceType_raw;
             if (!Decoder::decodeUint8(ptr, remaining, deviceType_raw)) return std::nullopt;
@@ -152,8 +148,16 @@ struct DeviceListWindowMessage {
             }
             devices_data[i] = item;
         }
+        BoundedList<uint8_t, 16> deviceNamePrefixes_data;
+        uint8_t count_deviceNamePrefixes;
+        if (!Decoder::decodeUint8(ptr, remaining, count_deviceNamePrefixes)) return std::nullopt;
+        for (uint8_t i = 0; i < count_deviceNamePrefixes && i < 16; ++i) {
+            uint8_t temp_item;
+            if (!Decoder::decodeUint8(ptr, remaining, temp_item)) return std::nullopt;
+            deviceNamePrefixes_data.push_back(temp_item);
+        }
 
-        return DeviceListWindowMessage{deviceCount, deviceStartIndex, deviceIndex, isNested, parentName, devices_data};
+        return DeviceListWindowMessage{deviceCount, deviceStartIndex, deviceIndex, isNested, parentName, devices_data, deviceNamePrefixes_data};
     }
 
 };
@@ -1,7 +1,7 @@
 /**
  * DevicePageNamesWindowMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_PAGE_NAMES_WINDOW message
@@ -17,11 +17,12 @@
 #include "../Decoder.hpp"
 #include "../MessageID.hpp"
 #include "../ProtocolConstants.hpp"
+#include "../BoundedList.hpp"
 #include <array>
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -31,23 +32,24 @@ struct DevicePageNamesWindowMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_PAGE_NAMES_WINDOW;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "DevicePageNamesWindow";
 
     uint8_t devicePageCount;
     uint8_t pageStartIndex;
     uint8_t devicePageIndex;
-    std::array<std::string, 16> pageNames;
+    std::array<std::string_view, 16> pageNames;
+    BoundedList<uint8_t, 16> pageNamePrefixes;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 554;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 549;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 26;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 5;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -61,12 +63,6 @@ struct DevicePageNamesWindowMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, devicePageCount);
         Encoder::encodeUint8(ptr, pageStartIndex);
         Encoder::encodeUint8(ptr, devicePageIndex);
@@ -74,6 +70,10 @@ struct DevicePageNamesWindowMessage {
         for (const auto& item : pageNames) {
             Encoder::encodeString(ptr, item);
         }
+        Encoder::encodeUint8(ptr, pageNamePrefixes.size());
+        for (const auto& item : pageNamePrefixes) {
+            Encoder::encodeUint8(ptr, item);
+        }
 
         return ptr - buffer;
     }
@@ -84,6 +84,8 @@ struct DevicePageNamesWindowMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<DevicePageNamesWindowMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -93,12 +95,6 @@ struct DevicePageNamesWindowMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t devicePageCount;
         if (!Decoder::decodeUint8(ptr, remaining, devicePageCount)) return std::nullopt;
@@ -106,14 +102,22 @@ struct DevicePageNamesWindowMessage {
         if (!Decoder::decodeUint8(ptr, remaining, pageStartIndex)) return std::nullopt;
         uint8_t devicePageIndex;
         if (!Decoder::decodeUint8(ptr, remaining, devicePageIndex)) return std::nullopt;
-        std::array<std::string, 16> pageNames_data;
+        std::array<std::string_view, 16> pageNames_data;
         uint8_t count_pageNames;
         if (!Decoder::decodeUint8(ptr, remaining, count_pageNames)) return std::nullopt;
         for (uint8_t i = 0; i < count_pageNames && i < 16; ++i) {
-            if (!Decoder::decodeString(ptr, remaining, pageNames_data[i])) return std::nullopt;
+            if (!Decoder::decodeStringView(ptr, remaining, pageNames_data[i])) return std::nullopt;
+        }
+        BoundedList<uint8_t, 16> pageNamePrefixes_data;
+        uint8_t count_pageNamePrefixes;
+        if (!Decoder::decodeUint8(ptr, remaining, count_pageNamePrefixes)) return std::nullopt;
+        for (uint8_t i = 0; i < count_pageNamePrefixes && i < 16; ++i) {
+            uint8_t temp_item;
+            if (!Decoder::decodeUint8(ptr, remaining, temp_item)) return std::nullopt;
+            pageNamePrefixes_data.push_back(temp_item);
         }
 
-        return DevicePageNamesWindowMessage{devicePageCount, pageStartIndex, devicePageIndex, pageNames_data};
+        return DevicePageNamesWindowMessage{devicePageCount, pageStartIndex, devicePageIndex, pageNames_data, pageNamePrefixes_data};
     }
 
 };
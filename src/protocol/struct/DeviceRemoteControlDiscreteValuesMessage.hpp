@@ -1,7 +1,7 @@
 /**
  * DeviceRemoteControlDiscreteValuesMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_REMOTE_CONTROL_DISCRETE_VALUES message
@@ -17,11 +17,11 @@
 #include "../Decoder.hpp"
 #include "../MessageID.hpp"
 #include "../ProtocolConstants.hpp"
+#include "../ViewList.hpp"
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
-#include <vector>
+#include <string_view>
 
 namespace Protocol {
 
@@ -31,22 +31,22 @@ struct DeviceRemoteControlDiscreteValuesMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_REMOTE_CONTROL_DISCRETE_VALUES;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "DeviceRemoteControlDiscreteValues";
 
     uint8_t remoteControlIndex;
-    std::vector<std::string> discreteValueNames;
+    ViewList<32> discreteValueNames;
     uint8_t currentValueIndex;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 1093;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 1059;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 37;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 3;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -60,12 +60,6 @@ struct DeviceRemoteControlDiscreteValuesMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, remoteControlIndex);
         Encoder::encodeUint8(ptr, discreteValueNames.size());
         for (const auto& item : discreteValueNames) {
@@ -82,6 +76,8 @@ struct DeviceRemoteControlDiscreteValuesMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<DeviceRemoteControlDiscreteValuesMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -91,21 +87,15 @@ struct DeviceRemoteControlDiscreteValuesMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t remoteControlIndex;
         if (!Decoder::decodeUint8(ptr, remaining, remoteControlIndex)) return std::nullopt;
-        std::vector<std::string> discreteValueNames_data;
+        ViewList<32> discreteValueNames_data;
         uint8_t count_discreteValueNames;
         if (!Decoder::decodeUint8(ptr, remaining, count_discreteValueNames)) return std::nullopt;
         for (uint8_t i = 0; i < count_discreteValueNames && i < 32; ++i) {
-            std::string temp_item;
-            if (!Decoder::decodeString(ptr, remaining, temp_item)) return std::nullopt;
+            std::string_view temp_item;
+            if (!Decoder::decodeStringView(ptr, remaining, temp_item)) return std::nullopt;
             discreteValueNames_data.push_back(temp_item);
         }
         uint8_t currentValueIndex;
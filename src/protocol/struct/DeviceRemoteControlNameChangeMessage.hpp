@@ -1,7 +1,7 @@
 /**
  * DeviceRemoteControlNameChangeMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_REMOTE_CONTROL_NAME_CHANGE message
@@ -20,7 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -30,21 +30,21 @@ struct DeviceRemoteControlNameChangeMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_REMOTE_CONTROL_NAME_CHANGE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "DeviceRemoteControlNameChange";
 
     uint8_t remoteControlIndex;
-    std::string parameterName;
+    std::string_view parameterName;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 64;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 34;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 32;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 2;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -58,12 +58,6 @@ struct DeviceRemoteControlNameChangeMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, remoteControlIndex);
         Encoder::encodeString(ptr, parameterName);
 
@@ -76,6 +70,8 @@ struct DeviceRemoteControlNameChangeMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<DeviceRemoteControlNameChangeMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -85,17 +81,11 @@ struct DeviceRemoteControlNameChangeMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t remoteControlIndex;
         if (!Decoder::decodeUint8(ptr, remaining, remoteControlIndex)) return std::nullopt;
-        std::string parameterName;
-        if (!Decoder::decodeString(ptr, remaining, parameterName)) return std::nullopt;
+        std::string_view parameterName;
+        if (!Decoder::decodeStringView(ptr, remaining, parameterName)) return std::nullopt;
 
         return DeviceRemoteControlNameChangeMessage{remoteControlIndex, parameterName};
     }
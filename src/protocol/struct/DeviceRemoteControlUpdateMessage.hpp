@@ -1,7 +1,7 @@
 /**
  * DeviceRemoteControlUpdateMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_REMOTE_CONTROL_UPDATE message
@@ -21,7 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -31,13 +31,13 @@ struct DeviceRemoteControlUpdateMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_REMOTE_CONTROL_UPDATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "DeviceRemoteControlUpdate";
 
     uint8_t remoteControlIndex;
-    std::string parameterName;
+    std::string_view parameterName;
     float parameterValue;
-    std::string displayValue;
+    std::string_view displayValue;
     float parameterOrigin;
     bool parameterExists;
     ParameterType parameterType;
@@ -49,12 +49,12 @@ struct DeviceRemoteControlUpdateMessage {
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 111;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 85;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 47;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 21;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -68,12 +68,6 @@ struct DeviceRemoteControlUpdateMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, remoteControlIndex);
         Encoder::encodeString(ptr, parameterName);
         Encoder::encodeFloat32(ptr, parameterValue);
@@ -95,6 +89,8 @@ struct DeviceRemoteControlUpdateMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<DeviceRemoteControlUpdateMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -104,21 +100,15 @@ struct DeviceRemoteControlUpdateMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t remoteControlIndex;
         if (!Decoder::decodeUint8(ptr, remaining, remoteControlIndex)) return std::nullopt;
-        std::string parameterName;
-        if (!Decoder::decodeString(ptr, remaining, parameterName)) return std::nullopt;
+        std::string_view parameterName;
+        if (!Decoder::decodeStringView(ptr, remaining, parameterName)) return std::nullopt;
         float parameterValue;
         if (!Decoder::decodeFloat32(ptr, remaining, parameterValue)) return std::nullopt;
-        std::string displayValue;
-        if (!Decoder::decodeString(ptr, remaining, displayValue)) return std::nullopt;
+        std::string_view displayValue;
+        if (!Decoder::decodeStringView(ptr, remaining, displayValue)) return std::nullopt;
         float parameterOrigin;
         if (!Decoder::decodeFloat32(ptr, remaining, parameterOrigin)) return std::nullopt;
         bool parameterExists;
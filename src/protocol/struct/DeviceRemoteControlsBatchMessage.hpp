@@ -1,7 +1,7 @@
 /**
  * DeviceRemoteControlsBatchMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: DEVICE_REMOTE_CONTROLS_BATCH message
@@ -17,11 +17,12 @@
 #include "../Decoder.hpp"
 #include "../MessageID.hpp"
 #include "../ProtocolConstants.hpp"
-#include <array>
+#include "../BoundedList.hpp"
+#include "../ViewList.hpp"
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -31,26 +32,27 @@ struct DeviceRemoteControlsBatchMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::DEVICE_REMOTE_CONTROLS_BATCH;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "DeviceRemoteControlsBatch";
 
     uint8_t sequenceNumber;
     uint8_t dirtyMask;
     uint8_t echoMask;
     uint8_t hasAutomationMask;
-    std::array<float, 8> values;
-    std::array<float, 8> modulatedValues;
-    std::array<std::string, 8> displayValues;
+    uint8_t modulatedMask;
+    BoundedList<float, 8> values;
+    BoundedList<float, 8> modulatedValues;
+    ViewList<8> displayValues;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 313;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 288;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 33;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 8;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -64,16 +66,11 @@ struct DeviceRemoteControlsBatchMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, sequenceNumber);
         Encoder::encodeUint8(ptr, dirtyMask);
         Encoder::encodeUint8(ptr, echoMask);
         Encoder::encodeUint8(ptr, hasAutomationMask);
+        Encoder::encodeUint8(ptr, modulatedMask);
         Encoder::encodeUint8(ptr, values.size());
         for (const auto& item : values) {
             Encoder::encodeNorm8(ptr, item);
@@ -96,6 +93,8 @@ struct DeviceRemoteControlsBatchMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<DeviceRemoteControlsBatchMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -105,12 +104,6 @@ struct DeviceRemoteControlsBatchMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t sequenceNumber;
         if (!Decoder::decodeUint8(ptr, remaining, sequenceNumber)) return std::nullopt;
@@ -120,26 +113,34 @@ struct DeviceRemoteControlsBatchMessage {
         if (!Decoder::decodeUint8(ptr, remaining, echoMask)) return std::nullopt;
         uint8_t hasAutomationMask;
         if (!Decoder::decodeUint8(ptr, remaining, hasAutomationMask)) return std::nullopt;
-        std::array<float, 8> values_data;
+        uint8_t modulatedMask;
+        if (!Decoder::decodeUint8(ptr, remaining, modulatedMask)) return std::nullopt;
+        BoundedList<float, 8> values_data;
         uint8_t count_values;
         if (!Decoder::decodeUint8(ptr, remaining, count_values)) return std::nullopt;
         for (uint8_t i = 0; i < count_values && i < 8; ++i) {
-            if (!Decoder::decodeNorm8(ptr, remaining, values_data[i])) return std::nullopt;
+            float temp_item;
+            if (!Decoder::decodeNorm8(ptr, remaining, temp_item)) return std::nullopt;
+            values_data.push_back(temp_item);
         }
-        std::array<float, 8> modulatedValues_data;
+        BoundedList<float, 8> modulatedValues_data;
         uint8_t count_modulatedValues;
         if (!Decoder::decodeUint8(ptr, remaining, count_modulatedValues)) return std::nullopt;
         for (uint8_t i = 0; i < count_modulatedValues && i < 8; ++i) {
-            if (!Decoder::decodeNorm8(ptr, remaining, modulatedValues_data[i])) return std::nullopt;
+            float temp_item;
+            if (!Decoder::decodeNorm8(ptr, remaining, temp_item)) return std::nullopt;
+            modulatedValues_data.push_back(temp_item);
         }
-        std::array<std::string, 8> displayValues_data;
+        ViewList<8> displayValues_data;
         uint8_t count_displayValues;
         if (!Decoder::decodeUint8(ptr, remaining, count_displayValues)) return std::nullopt;
         for (uint8_t i = 0; i < count_displayValues && i < 8; ++i) {
-            if (!Decoder::decodeString(ptr, remaining, displayValues_data[i])) return std::nullopt;
+            std::string_view temp_item;
+            if (!Decoder::decodeStringView(ptr, remaining, temp_item)) return std::nullopt;
+            displayValues_data.push_back(temp_item);
         }
 
-        return DeviceRemoteControlsBatchMessage{sequenceNumber, dirtyMask, echoMask, hasAutomationMask, values_data, modulatedValues_data, displayValues_data};
+        return DeviceRemoteControlsBatchMessage{sequenceNumber, dirtyMask, echoMask, hasAutomationMask, modulatedMask, values_data, modulatedValues_data, displayValues_data};
     }
 
 };
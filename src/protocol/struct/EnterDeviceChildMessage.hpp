@@ -1,7 +1,7 @@
 /**
  * EnterDeviceChildMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: ENTER_DEVICE_CHILD message
@@ -30,7 +30,7 @@ struct EnterDeviceChildMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::ENTER_DEVICE_CHILD;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "EnterDeviceChild";
 
     uint8_t deviceIndex;
@@ -40,12 +40,12 @@ struct EnterDeviceChildMessage {
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 20;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 3;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 20;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 3;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -59,12 +59,6 @@ struct EnterDeviceChildMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, deviceIndex);
         Encoder::encodeUint8(ptr, static_cast<uint8_t>(childType));
         Encoder::encodeUint8(ptr, childIndex);
@@ -87,12 +81,6 @@ struct EnterDeviceChildMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t deviceIndex;
         if (!Decoder::decodeUint8(ptr, remaining, deviceIndex)) return std::nullopt;
@@ -1,7 +1,7 @@
 /**
  * EnterTrackGroupMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: ENTER_TRACK_GROUP message
@@ -29,7 +29,7 @@ struct EnterTrackGroupMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::ENTER_TRACK_GROUP;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "EnterTrackGroup";
 
     uint8_t trackIndex;
@@ -37,12 +37,12 @@ struct EnterTrackGroupMessage {
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 17;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 1;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 17;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 1;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -56,12 +56,6 @@ struct EnterTrackGroupMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, trackIndex);
 
         return ptr - buffer;
@@ -82,12 +76,6 @@ struct EnterTrackGroupMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t trackIndex;
         if (!Decoder::decodeUint8(ptr, remaining, trackIndex)) return std::nullopt;
@@ -1,7 +1,7 @@
 /**
  * ExitToParentMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: EXIT_TO_PARENT message
@@ -29,54 +29,40 @@ struct ExitToParentMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::EXIT_TO_PARENT;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "ExitToParent";
 
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 13;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 0;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 13;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 0;
 
     /**
-     * Encode struct to MIDI-safe bytes (message name only, no fields)
+     * Encode struct to MIDI-safe bytes (no fields, empty payload)
      *
-     * @param buffer Output buffer (must have >= MAX_PAYLOAD_SIZE bytes)
-     * @param bufferSize Size of output buffer
-     * @return Number of bytes written, or 0 if buffer too small
+     * @param buffer Output buffer (unused)
+     * @param bufferSize Size of output buffer (unused)
+     * @return Number of bytes written (always 0)
      */
     uint16_t encode(uint8_t* buffer, uint16_t bufferSize) const {
-        if (bufferSize < MAX_PAYLOAD_SIZE) return 0;
-
-        uint8_t* ptr = buffer;
-
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
-        return ptr - buffer;
+        (void)buffer;
+        (void)bufferSize;
+        return 0;
     }
 
     /**
-     * Decode struct from MIDI-safe bytes (empty message with name prefix)
-     * @return Always returns empty struct after skipping name prefix
+     * Decode struct from MIDI-safe bytes (empty message)
+     * @return Always returns empty struct
      */
     static std::optional<ExitToParentMessage> decode(const uint8_t* data, uint16_t len) {
-        if (len < MIN_PAYLOAD_SIZE) return std::nullopt;
-        const uint8_t* ptr = data;
-        size_t remaining = len;
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
+        (void)data;
+        (void)len;
         return ExitToParentMessage{};
     }
 
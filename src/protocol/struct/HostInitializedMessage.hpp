@@ -1,7 +1,7 @@
 /**
  * HostInitializedMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: HOST_INITIALIZED message
@@ -29,20 +29,21 @@ struct HostInitializedMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::HOST_INITIALIZED;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "HostInitialized";
 
     bool isHostActive;
+    bool compactFrames;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 17;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 2;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 17;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 2;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -56,13 +57,8 @@ struct HostInitializedMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeBool(ptr, isHostActive);
+        Encoder::encodeBool(ptr, compactFrames);
 
         return ptr - buffer;
     }
@@ -82,17 +78,13 @@ struct HostInitializedMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         bool isHostActive;
         if (!Decoder::decodeBool(ptr, remaining, isHostActive)) return std::nullopt;
+        bool compactFrames;
+        if (!Decoder::decodeBool(ptr, remaining, compactFrames)) return std::nullopt;
 
-        return HostInitializedMessage{isHostActive};
+        return HostInitializedMessage{isHostActive, compactFrames};
     }
 
 };
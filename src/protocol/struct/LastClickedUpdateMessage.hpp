@@ -1,7 +1,7 @@
 /**
  * LastClickedUpdateMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: LAST_CLICKED_UPDATE message
@@ -21,7 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -31,12 +31,12 @@ struct LastClickedUpdateMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::LAST_CLICKED_UPDATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "LastClickedUpdate";
 
-    std::string parameterName;
+    std::string_view parameterName;
     float parameterValue;
-    std::string displayValue;
+    std::string_view displayValue;
     float parameterOrigin;
     bool parameterExists;
     ParameterType parameterType;
@@ -46,12 +46,12 @@ struct LastClickedUpdateMessage {
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 97;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 79;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 33;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 15;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -65,12 +65,6 @@ struct LastClickedUpdateMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeString(ptr, parameterName);
         Encoder::encodeFloat32(ptr, parameterValue);
         Encoder::encodeString(ptr, displayValue);
@@ -89,6 +83,8 @@ struct LastClickedUpdateMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<LastClickedUpdateMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -98,19 +94,13 @@ struct LastClickedUpdateMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
-        std::string parameterName;
-        if (!Decoder::decodeString(ptr, remaining, parameterName)) return std::nullopt;
+        std::string_view parameterName;
+        if (!Decoder::decodeStringView(ptr, remaining, parameterName)) return std::nullopt;
         float parameterValue;
         if (!Decoder::decodeFloat32(ptr, remaining, parameterValue)) return std::nullopt;
-        std::string displayValue;
-        if (!Decoder::decodeString(ptr, remaining, displayValue)) return std::nullopt;
+        std::string_view displayValue;
+        if (!Decoder::decodeStringView(ptr, remaining, displayValue)) return std::nullopt;
         float parameterOrigin;
         if (!Decoder::decodeFloat32(ptr, remaining, parameterOrigin)) return std::nullopt;
         bool parameterExists;
@@ -1,7 +1,7 @@
 /**
  * LastClickedValueStateMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: LAST_CLICKED_VALUE_STATE message
@@ -20,7 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -30,21 +30,21 @@ struct LastClickedValueStateMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::LAST_CLICKED_VALUE_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "LastClickedValueState";
 
     float parameterValue;
-    std::string displayValue;
+    std::string_view displayValue;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 59;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 37;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 27;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 5;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -58,12 +58,6 @@ struct LastClickedValueStateMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeFloat32(ptr, parameterValue);
         Encoder::encodeString(ptr, displayValue);
 
@@ -76,6 +70,8 @@ struct LastClickedValueStateMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<LastClickedValueStateMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -85,17 +81,11 @@ struct LastClickedValueStateMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         float parameterValue;
         if (!Decoder::decodeFloat32(ptr, remaining, parameterValue)) return std::nullopt;
-        std::string displayValue;
-        if (!Decoder::decodeString(ptr, remaining, displayValue)) return std::nullopt;
+        std::string_view displayValue;
+        if (!Decoder::decodeStringView(ptr, remaining, displayValue)) return std::nullopt;
 
         return LastClickedValueStateMessage{parameterValue, displayValue};
     }
@@ -1,7 +1,7 @@
 /**
  * RemoteControlValueStateMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: REMOTE_CONTROL_VALUE_STATE message
@@ -20,7 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -30,22 +30,22 @@ struct RemoteControlValueStateMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::REMOTE_CONTROL_VALUE_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "RemoteControlValueState";
 
     uint8_t remoteControlIndex;
     float parameterValue;
-    std::string displayValue;
+    std::string_view displayValue;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 62;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 38;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 30;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 6;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -59,12 +59,6 @@ struct RemoteControlValueStateMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, remoteControlIndex);
         Encoder::encodeFloat32(ptr, parameterValue);
         Encoder::encodeString(ptr, displayValue);
@@ -78,6 +72,8 @@ struct RemoteControlValueStateMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<RemoteControlValueStateMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -87,19 +83,13 @@ struct RemoteControlValueStateMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t remoteControlIndex;
         if (!Decoder::decodeUint8(ptr, remaining, remoteControlIndex)) return std::nullopt;
         float parameterValue;
         if (!Decoder::decodeFloat32(ptr, remaining, parameterValue)) return std::nullopt;
-        std::string displayValue;
-        if (!Decoder::decodeString(ptr, remaining, displayValue)) return std::nullopt;
+        std::string_view displayValue;
+        if (!Decoder::decodeStringView(ptr, remaining, displayValue)) return std::nullopt;
 
         return RemoteControlValueStateMessage{remoteControlIndex, parameterValue, displayValue};
     }
@@ -0,0 +1,96 @@
+/**
+ * RenderStatsMessage.hpp - Auto-generated Protocol Struct
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ * Generated from: types.yaml
+ *
+ * Description: RENDER_STATS message
+ *
+ * This struct uses encode/decode functions from Protocol namespace.
+ * All encoding is 8-bit binary (Binary). Performance is identical to inline
+ * code due to static inline + compiler optimization.
+ */
+
+#pragma once
+
+#include "../Encoder.hpp"
+#include "../Decoder.hpp"
+#include "../MessageID.hpp"
+#include "../ProtocolConstants.hpp"
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+namespace Protocol {
+
+
+
+struct RenderStatsMessage {
+    // Auto-detected MessageID for protocol.send()
+    static constexpr MessageID MESSAGE_ID = MessageID::RENDER_STATS;
+
+    // Message name for logging (framed by the protocol layer, not the codec)
+    static constexpr const char* MESSAGE_NAME = "RenderStats";
+
+    uint8_t renderHz;
+    uint16_t frameTimeUs;
+    uint8_t headroomPercent;
+
+    /**
+     * Maximum payload size in bytes (8-bit encoded)
+     */
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 4;
+
+    /**
+     * Minimum payload size in bytes (with empty strings)
+     */
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 4;
+
+    /**
+     * Encode struct to MIDI-safe bytes
+     *
+     * @param buffer Output buffer (must have >= MAX_PAYLOAD_SIZE bytes)
+     * @param bufferSize Size of output buffer
+     * @return Number of bytes written, or 0 if buffer too small
+     */
+    uint16_t encode(uint8_t* buffer, uint16_t bufferSize) const {
+        if (bufferSize < MAX_PAYLOAD_SIZE) return 0;
+
+        uint8_t* ptr = buffer;
+
+        Encoder::encodeUint8(ptr, renderHz);
+        Encoder::encodeUint16(ptr, frameTimeUs);
+        Encoder::encodeUint8(ptr, headroomPercent);
+
+        return ptr - buffer;
+    }
+
+    /**
+     * Decode struct from MIDI-safe bytes
+     *
+     * @param data Input buffer with encoded data
+     * @param len Length of input buffer
+     * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     */
+    static std::optional<RenderStatsMessage> decode(
+        const uint8_t* data, uint16_t len) {
+
+        if (len < MIN_PAYLOAD_SIZE) return std::nullopt;
+
+        const uint8_t* ptr = data;
+        size_t remaining = len;
+
+        // Decode fields
+        uint8_t renderHz;
+        if (!Decoder::decodeUint8(ptr, remaining, renderHz)) return std::nullopt;
+        uint16_t frameTimeUs;
+        if (!Decoder::decodeUint16(ptr, remaining, frameTimeUs)) return std::nullopt;
+        uint8_t headroomPercent;
+        if (!Decoder::decodeUint8(ptr, remaining, headroomPercent)) return std::nullopt;
+
+        return RenderStatsMessage{renderHz, frameTimeUs, headroomPercent};
+    }
+
+};
+
+}  // namespace Protocol
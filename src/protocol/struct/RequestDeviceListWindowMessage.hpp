@@ -1,7 +1,7 @@
 /**
  * RequestDeviceListWindowMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: REQUEST_DEVICE_LIST_WINDOW message
@@ -29,20 +29,21 @@ struct RequestDeviceListWindowMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::REQUEST_DEVICE_LIST_WINDOW;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "RequestDeviceListWindow";
 
     uint8_t deviceStartIndex;
+    uint8_t windowSize;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 25;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 2;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 25;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 2;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -56,13 +57,8 @@ struct RequestDeviceListWindowMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, deviceStartIndex);
+        Encoder::encodeUint8(ptr, windowSize);
 
         return ptr - buffer;
     }
@@ -82,17 +78,13 @@ struct RequestDeviceListWindowMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t deviceStartIndex;
         if (!Decoder::decodeUint8(ptr, remaining, deviceStartIndex)) return std::nullopt;
+        uint8_t windowSize;
+        if (!Decoder::decodeUint8(ptr, remaining, windowSize)) return std::nullopt;
 
-        return RequestDeviceListWindowMessage{deviceStartIndex};
+        return RequestDeviceListWindowMessage{deviceStartIndex, windowSize};
     }
 
 };
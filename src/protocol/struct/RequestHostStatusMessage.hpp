@@ -1,7 +1,7 @@
 /**
  * RequestHostStatusMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: REQUEST_HOST_STATUS message
@@ -29,22 +29,23 @@ struct RequestHostStatusMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::REQUEST_HOST_STATUS;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "RequestHostStatus";
 
+    bool compactFrames;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 18;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 1;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 18;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 1;
 
     /**
-     * Encode struct to MIDI-safe bytes (message name only, no fields)
+     * Encode struct to MIDI-safe bytes
      *
      * @param buffer Output buffer (must have >= MAX_PAYLOAD_SIZE bytes)
      * @param bufferSize Size of output buffer
@@ -55,29 +56,31 @@ struct RequestHostStatusMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
+        Encoder::encodeBool(ptr, compactFrames);
 
         return ptr - buffer;
     }
 
     /**
-     * Decode struct from MIDI-safe bytes (empty message with name prefix)
-     * @return Always returns empty struct after skipping name prefix
+     * Decode struct from MIDI-safe bytes
+     *
+     * @param data Input buffer with encoded data
+     * @param len Length of input buffer
+     * @return Decoded struct, or std::nullopt if invalid/insufficient data
      */
-    static std::optional<RequestHostStatusMessage> decode(const uint8_t* data, uint16_t len) {
+    static std::optional<RequestHostStatusMessage> decode(
+        const uint8_t* data, uint16_t len) {
+
         if (len < MIN_PAYLOAD_SIZE) return std::nullopt;
+
         const uint8_t* ptr = data;
         size_t remaining = len;
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-        return RequestHostStatusMessage{};
+
+        // Decode fields
+        bool compactFrames;
+        if (!Decoder::decodeBool(ptr, remaining, compactFrames)) return std::nullopt;
+
+        return RequestHostStatusMessage{compactFrames};
     }
 
 };
@@ -1,7 +1,7 @@
 /**
  * SendDestinationsListMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: SEND_DESTINATIONS_LIST message
@@ -21,7 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -31,7 +31,7 @@ namespace Protocol {
 
 struct SendDestinations {
     uint8_t sendIndex;
-    std::string sendDestinationName;
+    std::string_view sendDestinationName;
 };
 
 #endif // PROTOCOL_SENDDESTINATIONS_STRUCT
@@ -40,7 +40,7 @@ struct SendDestinationsListMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::SEND_DESTINATIONS_LIST;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "SendDestinationsList";
 
     uint8_t sendCount;
@@ -49,12 +49,12 @@ struct SendDestinationsListMessage {
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 295;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 274;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 23;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 2;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -68,12 +68,6 @@ struct SendDestinationsListMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, sendCount);
         Encoder::encodeUint8(ptr, sendDestinations.size());
         for (const auto& item : sendDestinations) {
@@ -90,6 +84,8 @@ struct SendDestinationsListMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<SendDestinationsListMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -99,12 +95,6 @@ struct SendDestinationsListMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t sendCount;
         if (!Decoder::decodeUint8(ptr, remaining, sendCount)) return std::nullopt;
@@ -114,7 +104,7 @@ struct SendDestinationsListMessage {
         for (uint8_t i = 0; i < count_sendDestinations && i < 8; ++i) {
             SendDestinations item;
             if (!Decoder::decodeUint8(ptr, remaining, item.sendIndex)) return std::nullopt;
-            if (!Decoder::decodeString(ptr, remaining, item.sendDestinationName)) return std::nullopt;
+            if (!Decoder::decodeStringView(ptr, remaining, item.sendDestinationName)) return std::nullopt;
             sendDestinations_data[i] = item;
         }
 
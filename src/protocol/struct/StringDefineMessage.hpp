@@ -0,0 +1,95 @@
+/**
+ * StringDefineMessage.hpp - Auto-generated Protocol Struct
+ *
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
+ * Generated from: types.yaml
+ *
+ * Description: STRING_DEFINE message
+ *
+ * This struct uses encode/decode functions from Protocol namespace.
+ * All encoding is 8-bit binary (Binary). Performance is identical to inline
+ * code due to static inline + compiler optimization.
+ */
+
+#pragma once
+
+#include "../Encoder.hpp"
+#include "../Decoder.hpp"
+#include "../MessageID.hpp"
+#include "../ProtocolConstants.hpp"
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+namespace Protocol {
+
+
+
+struct StringDefineMessage {
+    // Auto-detected MessageID for protocol.send()
+    static constexpr MessageID MESSAGE_ID = MessageID::STRING_DEFINE;
+
+    // Message name for logging (framed by the protocol layer, not the codec)
+    static constexpr const char* MESSAGE_NAME = "StringDefine";
+
+    uint16_t stringId;
+    std::string_view text;
+
+    /**
+     * Maximum payload size in bytes (8-bit encoded)
+     */
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 35;
+
+    /**
+     * Minimum payload size in bytes (with empty strings)
+     */
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 3;
+
+    /**
+     * Encode struct to MIDI-safe bytes
+     *
+     * @param buffer Output buffer (must have >= MAX_PAYLOAD_SIZE bytes)
+     * @param bufferSize Size of output buffer
+     * @return Number of bytes written, or 0 if buffer too small
+     */
+    uint16_t encode(uint8_t* buffer, uint16_t bufferSize) const {
+        if (bufferSize < MAX_PAYLOAD_SIZE) return 0;
+
+        uint8_t* ptr = buffer;
+
+        Encoder::encodeUint16(ptr, stringId);
+        Encoder::encodeString(ptr, text);
+
+        return ptr - buffer;
+    }
+
+    /**
+     * Decode struct from MIDI-safe bytes
+     *
+     * @param data Input buffer with encoded data
+     * @param len Length of input buffer
+     * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
+     */
+    static std::optional<StringDefineMessage> decode(
+        const uint8_t* data, uint16_t len) {
+
+        if (len < MIN_PAYLOAD_SIZE) return std::nullopt;
+
+        const uint8_t* ptr = data;
+        size_t remaining = len;
+
+        // Decode fields
+        uint16_t stringId;
+        if (!Decoder::decodeUint16(ptr, remaining, stringId)) return std::nullopt;
+        std::string_view text;
+        if (!Decoder::decodeStringView(ptr, remaining, text)) return std::nullopt;
+
+        return StringDefineMessage{stringId, text};
+    }
+
+};
+
+}  // namespace Protocol
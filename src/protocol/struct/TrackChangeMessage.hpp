@@ -1,7 +1,7 @@
 /**
  * TrackChangeMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRACK_CHANGE message
@@ -21,7 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -31,10 +31,10 @@ struct TrackChangeMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::TRACK_CHANGE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "TrackChange";
 
-    std::string trackName;
+    std::string_view trackName;
     uint32_t color;
     uint8_t trackIndex;
     TrackType trackType;
@@ -44,19 +44,19 @@ struct TrackChangeMessage {
     bool isMutedBySolo;
     bool isArm;
     float volume;
-    std::string volumeDisplay;
+    std::string_view volumeDisplay;
     float pan;
-    std::string panDisplay;
+    std::string_view panDisplay;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 130;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 118;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 34;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 22;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -70,12 +70,6 @@ struct TrackChangeMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeString(ptr, trackName);
         Encoder::encodeUint32(ptr, color);
         Encoder::encodeUint8(ptr, trackIndex);
@@ -99,6 +93,8 @@ struct TrackChangeMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<TrackChangeMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -108,15 +104,9 @@ struct TrackChangeMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
-        std::string trackName;
-        if (!Decoder::decodeString(ptr, remaining, trackName)) return std::nullopt;
+        std::string_view trackName;
+        if (!Decoder::decodeStringView(ptr, remaining, trackName)) return std::nullopt;
         uint32_t color;
         if (!Decoder::decodeUint32(ptr, remaining, color)) return std::nullopt;
         uint8_t trackIndex;
@@ -136,12 +126,12 @@ struct TrackChangeMessage {
         if (!Decoder::decodeBool(ptr, remaining, isArm)) return std::nullopt;
         float volume;
         if (!Decoder::decodeFloat32(ptr, remaining, volume)) return std::nullopt;
-        std::string volumeDisplay;
-        if (!Decoder::decodeString(ptr, remaining, volumeDisplay)) return std::nullopt;
+        std::string_view volumeDisplay;
+        if (!Decoder::decodeStringView(ptr, remaining, volumeDisplay)) return std::nullopt;
         float pan;
         if (!Decoder::decodeFloat32(ptr, remaining, pan)) return std::nullopt;
-        std::string panDisplay;
-        if (!Decoder::decodeString(ptr, remaining, panDisplay)) return std::nullopt;
+        std::string_view panDisplay;
+        if (!Decoder::decodeStringView(ptr, remaining, panDisplay)) return std::nullopt;
 
         return TrackChangeMessage{trackName, color, trackIndex, trackType, isActivated, isMute, isSolo, isMutedBySolo, isArm, volume, volumeDisplay, pan, panDisplay};
     }
@@ -1,7 +1,7 @@
 /**
  * TrackListWindowMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRACK_LIST_WINDOW message
@@ -17,12 +17,13 @@
 #include "../Decoder.hpp"
 #include "../MessageID.hpp"
 #include "../ProtocolConstants.hpp"
+#include "../BoundedList.hpp"
 #include "../TrackType.hpp"
 #include <array>
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -32,7 +33,7 @@ namespace Protocol {
 
 struct Tracks {
     uint8_t trackIndex;
-    std::string trackName;
+    std::string_view trackName;
     uint32_t color;
     bool isActivated;
     bool isMute;
@@ -51,25 +52,26 @@ struct TrackListWindowMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::TRACK_LIST_WINDOW;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "TrackListWindow";
 
     uint8_t trackCount;
     uint8_t trackStartIndex;
     uint8_t trackIndex;
     bool isNested;
-    std::string parentGroupName;
+    std::string_view parentGroupName;
     std::array<Tracks, 16> tracks;
+    BoundedList<uint8_t, 16> trackNamePrefixes;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 902;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 903;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 22;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 7;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -83,12 +85,6 @@ struct TrackListWindowMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, trackCount);
         Encoder::encodeUint8(ptr, trackStartIndex);
         Encoder::encodeUint8(ptr, trackIndex);
@@ -109,6 +105,10 @@ struct TrackListWindowMessage {
             Encoder::encodeFloat32(ptr, item.volume);
             Encoder::encodeFloat32(ptr, item.pan);
         }
+        Encoder::encodeUint8(ptr, trackNamePrefixes.size());
+        for (const auto& item : trackNamePrefixes) {
+            Encoder::encodeUint8(ptr, item);
+        }
 
         return ptr - buffer;
     }
@@ -119,6 +119,8 @@ struct TrackListWindowMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<TrackListWindowMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -128,12 +130,6 @@ struct TrackListWindowMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t trackCount;
         if (!Decoder::decodeUint8(ptr, remaining, trackCount)) return std::nullopt;
@@ -143,15 +139,15 @@ struct TrackListWindowMessage {
         if (!Decoder::decodeUint8(ptr, remaining, trackIndex)) return std::nullopt;
         bool isNested;
         if (!Decoder::decodeBool(ptr, remaining, isNested)) return std::nullopt;
-        std::string parentGroupName;
-        if (!Decoder::decodeString(ptr, remaining, parentGroupName)) return std::nullopt;
+        std::string_view parentGroupName;
+        if (!Decoder::decodeStringView(ptr, remaining, parentGroupName)) return std::nullopt;
         uint8_t count_tracks;
         if (!Decoder::decodeUint8(ptr, remaining, count_tracks)) return std::nullopt;
         std::array<Tracks, 16> tracks_data;
         for (uint8_t i = 0; i < count_tracks && i < 16; ++i) {
             Tracks item;
             if (!Decoder::decodeUint8(ptr, remaining, item.trackIndex)) return std::nullopt;
-            if (!Decoder::decodeString(ptr, remaining, item.trackName)) return std::nullopt;
+            if (!Decoder::decodeStringView(ptr, remaining, item.trackName)) return std::nullopt;
             if (!Decoder::decodeUint32(ptr, remaining, item.color)) return std::nullopt;
             if (!Decoder::decodeBool(ptr, remaining, item.isActivated)) return std::nullopt;
             if (!Decoder::decodeBool(ptr, remaining, item.isMute)) return std::nullopt;
@@ -166,8 +162,16 @@ struct TrackListWindowMessage {
             if (!Decoder::decodeFloat32(ptr, remaining, item.pan)) return std::nullopt;
             tracks_data[i] = item;
         }
+        BoundedList<uint8_t, 16> trackNamePrefixes_data;
+        uint8_t count_trackNamePrefixes;
+        if (!Decoder::decodeUint8(ptr, remaining, count_trackNamePrefixes)) return std::nullopt;
+        for (uint8_t i = 0; i < count_trackNamePrefixes && i < 16; ++i) {
+            uint8_t temp_item;
+            if (!Decoder::decodeUint8(ptr, remaining, temp_item)) return std::nullopt;
+            trackNamePrefixes_data.push_back(temp_item);
+        }
 
-        return TrackListWindowMessage{trackCount, trackStartIndex, trackIndex, isNested, parentGroupName, tracks_data};
+        return TrackListWindowMessage{trackCount, trackStartIndex, trackIndex, isNested, parentGroupName, tracks_data, trackNamePrefixes_data};
     }
 
 };
@@ -1,7 +1,7 @@
 /**
  * TrackSendListMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRACK_SEND_LIST message
@@ -21,7 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -31,12 +31,12 @@ namespace Protocol {
 
 struct Sends {
     uint8_t sendIndex;
-    std::string sendName;
+    std::string_view sendName;
     uint32_t color;
     float sendValue;
-    std::string sendDisplayValue;
+    std::string_view sendDisplayValue;
     bool sendIsEnabled;
-    std::string sendMode;
+    std::string_view sendMode;
     bool sendIsPreFader;
 };
 
@@ -46,7 +46,7 @@ struct TrackSendListMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::TRACK_SEND_LIST;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "TrackSendList";
 
     uint8_t trackIndex;
@@ -56,12 +56,12 @@ struct TrackSendListMessage {
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 897;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 883;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 17;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 3;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -75,12 +75,6 @@ struct TrackSendListMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, trackIndex);
         Encoder::encodeUint8(ptr, sendCount);
         Encoder::encodeUint8(ptr, sends.size());
@@ -104,6 +98,8 @@ struct TrackSendListMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<TrackSendListMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -113,12 +109,6 @@ struct TrackSendListMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t trackIndex;
         if (!Decoder::decodeUint8(ptr, remaining, trackIndex)) return std::nullopt;
@@ -130,12 +120,12 @@ struct TrackSendListMessage {
         for (uint8_t i = 0; i < count_sends && i < 8; ++i) {
             Sends item;
             if (!Decoder::decodeUint8(ptr, remaining, item.sendIndex)) return std::nullopt;
-            if (!Decoder::decodeString(ptr, remaining, item.sendName)) return std::nullopt;
+            if (!Decoder::decodeStringView(ptr, remaining, item.sendName)) return std::nullopt;
             if (!Decoder::decodeUint32(ptr, remaining, item.color)) return std::nullopt;
             if (!Decoder::decodeFloat32(ptr, remaining, item.sendValue)) return std::nullopt;
-            if (!Decoder::decodeString(ptr, remaining, item.sendDisplayValue)) return std::nullopt;
+            if (!Decoder::decodeStringView(ptr, remaining, item.sendDisplayValue)) return std::nullopt;
             if (!Decoder::decodeBool(ptr, remaining, item.sendIsEnabled)) return std::nullopt;
-            if (!Decoder::decodeString(ptr, remaining, item.sendMode)) return std::nullopt;
+            if (!Decoder::decodeStringView(ptr, remaining, item.sendMode)) return std::nullopt;
             if (!Decoder::decodeBool(ptr, remaining, item.sendIsPreFader)) return std::nullopt;
             sends_data[i] = item;
         }
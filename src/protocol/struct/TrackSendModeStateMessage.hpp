@@ -1,7 +1,7 @@
 /**
  * TrackSendModeStateMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRACK_SEND_MODE_STATE message
@@ -20,7 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -30,22 +30,22 @@ struct TrackSendModeStateMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::TRACK_SEND_MODE_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "TrackSendModeState";
 
     uint8_t trackIndex;
     uint8_t sendIndex;
-    std::string sendMode;
+    std::string_view sendMode;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 54;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 35;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 22;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 3;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -59,12 +59,6 @@ struct TrackSendModeStateMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, trackIndex);
         Encoder::encodeUint8(ptr, sendIndex);
         Encoder::encodeString(ptr, sendMode);
@@ -78,6 +72,8 @@ struct TrackSendModeStateMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<TrackSendModeStateMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -87,19 +83,13 @@ struct TrackSendModeStateMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t trackIndex;
         if (!Decoder::decodeUint8(ptr, remaining, trackIndex)) return std::nullopt;
         uint8_t sendIndex;
         if (!Decoder::decodeUint8(ptr, remaining, sendIndex)) return std::nullopt;
-        std::string sendMode;
-        if (!Decoder::decodeString(ptr, remaining, sendMode)) return std::nullopt;
+        std::string_view sendMode;
+        if (!Decoder::decodeStringView(ptr, remaining, sendMode)) return std::nullopt;
 
         return TrackSendModeStateMessage{trackIndex, sendIndex, sendMode};
     }
@@ -1,7 +1,7 @@
 /**
  * TrackSendValueStateMessage.hpp - Auto-generated Protocol Struct
  *
- * AUTO-GENERATED - DO NOT EDIT
+ * MANUAL - DO NOT REGENERATE (generated, then edited by hand)
  * Generated from: types.yaml
  *
  * Description: TRACK_SEND_VALUE_STATE message
@@ -20,7 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
-#include <string>
+#include <string_view>
 
 namespace Protocol {
 
@@ -30,23 +30,23 @@ struct TrackSendValueStateMessage {
     // Auto-detected MessageID for protocol.send()
     static constexpr MessageID MESSAGE_ID = MessageID::TRACK_SEND_VALUE_STATE;
 
-    // Message name for logging (encoded in payload)
+    // Message name for logging (framed by the protocol layer, not the codec)
     static constexpr const char* MESSAGE_NAME = "TrackSendValueState";
 
     uint8_t trackIndex;
     uint8_t sendIndex;
     float sendValue;
-    std::string sendDisplayValue;
+    std::string_view sendDisplayValue;
 
     /**
      * Maximum payload size in bytes (8-bit encoded)
      */
-    static constexpr uint16_t MAX_PAYLOAD_SIZE = 59;
+    static constexpr uint16_t MAX_PAYLOAD_SIZE = 39;
 
     /**
      * Minimum payload size in bytes (with empty strings)
      */
-    static constexpr uint16_t MIN_PAYLOAD_SIZE = 27;
+    static constexpr uint16_t MIN_PAYLOAD_SIZE = 7;
 
     /**
      * Encode struct to MIDI-safe bytes
@@ -60,12 +60,6 @@ struct TrackSendValueStateMessage {
 
         uint8_t* ptr = buffer;
 
-        // Encode message name (length-prefixed string for bridge logging)
-        Encoder::encodeUint8(ptr, static_cast<uint8_t>(strlen(MESSAGE_NAME)));
-        for (size_t i = 0; i < strlen(MESSAGE_NAME); ++i) {
-            *ptr++ = static_cast<uint8_t>(MESSAGE_NAME[i]);
-        }
-
         Encoder::encodeUint8(ptr, trackIndex);
         Encoder::encodeUint8(ptr, sendIndex);
         Encoder::encodeFloat32(ptr, sendValue);
@@ -80,6 +74,8 @@ struct TrackSendValueStateMessage {
      * @param data Input buffer with encoded data
      * @param len Length of input buffer
      * @return Decoded struct, or std::nullopt if invalid/insufficient data
+     *
+     * String fields are views into @p data: copy them before the buffer is released.
      */
     static std::optional<TrackSendValueStateMessage> decode(
         const uint8_t* data, uint16_t len) {
@@ -89,12 +85,6 @@ struct TrackSendValueStateMessage {
         const uint8_t* ptr = data;
         size_t remaining = len;
 
-        // Skip MESSAGE_NAME prefix
-        uint8_t nameLen;
-        if (!Decoder::decodeUint8(ptr, remaining, nameLen)) return std::nullopt;
-        ptr += nameLen;
-        remaining -= nameLen;
-
         // Decode fields
         uint8_t trackIndex;
         if (!Decoder::decodeUint8(ptr, remaining, trackIndex)) return std::nullopt;
@@ -102,8 +92,8 @@ struct TrackSendValueStateMessage {
         if (!Decoder::decodeUint8(ptr, remaining, sendIndex)) return std::nullopt;
         float sendValue;
         if (!Decoder::decodeFloat32(ptr, remaining, sendValue)) return std::nullopt;
-        std::string sendDisplayValue;
-        if (!Decoder::decodeString(ptr, remaining, sendDisplayValue)) return std::nullopt;
+        std::string_view sendDisplayValue;
+        if (!Decoder::decodeStringView(ptr, remaining, sendDisplayValue)) return std::nullopt;
 
         return TrackSendValueStateMessage{trackIndex, sendIndex, sendValue, sendDisplayValue};
     }
@@ -31,8 +31,8 @@ constexpr uint8_t MAX_CHILD_TYPES = 4;
 // Windowed List Constants
 // =============================================================================
 
-constexpr uint8_t LIST_WINDOW_SIZE = 16;     // Items per window request (devices, tracks, pages)
-constexpr uint8_t PREFETCH_THRESHOLD = 8;    // Prefetch when cursor >= loadedUpTo - threshold
+constexpr uint8_t LIST_WINDOW_SIZE = 16;     // Items per window message (requests are sized by LinkMeter)
+constexpr uint8_t PREFETCH_THRESHOLD = 8;    // Minimum lookahead of WindowPrefetcher (items ahead of the cursor)
 
 // =============================================================================
 // UI Text Constants
@@ -0,0 +1,175 @@
+#pragma once
+
+/**
+ * @file DeviceChainCache.hpp
+ * @brief LRU of device lists of recently visited chains, with version stamps
+ *
+ * Switching tracks replaces the device chain, and the selector list used to
+ * be rebuilt from DEVICE_LIST_WINDOW every time. The host now announces each
+ * chain with DEVICE_CHAIN_STAMP:
+ *
+ * - chainIdentity: which chain (track + nesting, 0 = do not cache)
+ * - chainStamp: which version of its device list (names, types, enabled
+ *   states, child flags)
+ *
+ * activate() on each stamp: a hit (same identity, same stamp) lets restore()
+ * rebuild the selector right away. Otherwise a fresh entry is taken (least
+ * recently used one recycled) and put() records the devices of the windows
+ * that follow, in order.
+ *
+ * The host mirrors this LRU (same CAPACITY) to decide whether it must push
+ * the first window after a stamp (DeviceHost.sentChains).
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "protocol/DeviceType.hpp"
+
+namespace bitwig::state {
+
+class DeviceChainCache {
+public:
+    static constexpr size_t CAPACITY = 4;        // Chains, must match DeviceHost.CHAIN_CACHE_SIZE
+    static constexpr size_t TEXT_BYTES = 1024;   // Length-prefixed names per chain
+    static constexpr size_t MAX_DEVICES = 64;    // Matches state MAX_DEVICES
+
+    struct Device {
+        std::string_view name;
+        DeviceType deviceType;
+        bool isEnabled;
+        uint8_t childFlags;  // CHILD_TYPE_* bits
+    };
+
+    struct Stats {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        uint32_t stale = 0;  // Chain known, device list changed
+    };
+
+    /**
+     * @brief Make @p identity the chain the next put() calls belong to
+     * @return true if the cached list of this chain is current (restore() it)
+     */
+    bool activate(uint32_t identity, uint32_t stamp) {
+        active_ = nullptr;
+        if (identity == 0) return false;
+
+        Entry* entry = find(identity);
+        if (entry != nullptr && entry->stamp == stamp) {
+            ++stats_.hits;
+            entry->lastUse = ++clock_;
+            active_ = entry;
+            return true;
+        }
+
+        if (entry != nullptr) {
+            ++stats_.stale;
+        } else {
+            ++stats_.misses;
+            entry = leastRecentlyUsed();
+        }
+        entry->identity = identity;
+        entry->stamp = stamp;
+        entry->lastUse = ++clock_;
+        entry->count = 0;
+        entry->used = 0;
+        entry->full = false;
+        active_ = entry;
+        return false;
+    }
+
+    void deactivate() { active_ = nullptr; }
+
+    /**
+     * @brief Hand the devices of the active chain to fn(index, device), in order
+     * @return Number of devices restored (names [0, count) are contiguous)
+     */
+    template <typename Fn>
+    uint8_t restore(Fn&& fn) const {
+        if (active_ == nullptr) return 0;
+
+        size_t offset = 0;
+        for (uint8_t i = 0; i < active_->count; ++i) {
+            uint8_t length = static_cast<uint8_t>(active_->text[offset]);
+            fn(i, Device{std::string_view(active_->text + offset + 1, length), active_->deviceTypes[i],
+                         active_->enabled[i], active_->childFlags[i]});
+            offset += 1 + length;
+        }
+        return active_->count;
+    }
+
+    /**
+     * @brief Record the device at @p index of the active chain
+     *
+     * Only the next index in sequence is kept (no gaps); devices beyond
+     * TEXT_BYTES of names are dropped and loaded through the usual prefetch.
+     */
+    void put(uint8_t index, const Device& device) {
+        if (active_ == nullptr || active_->full || index != active_->count || index >= MAX_DEVICES) return;
+
+        size_t length = device.name.size() > 255 ? 255 : device.name.size();
+        if (active_->used + 1 + length > TEXT_BYTES) {
+            active_->full = true;
+            return;
+        }
+        active_->text[active_->used] = static_cast<char>(length);
+        std::memcpy(active_->text + active_->used + 1, device.name.data(), length);
+        active_->used = static_cast<uint16_t>(active_->used + 1 + length);
+        active_->deviceTypes[index] = device.deviceType;
+        active_->enabled[index] = device.isEnabled;
+        active_->childFlags[index] = device.childFlags;
+        ++active_->count;
+    }
+
+    /// DEVICE_ENABLED_STATE for the active chain
+    void setEnabled(uint8_t index, bool enabled) {
+        if (active_ != nullptr && index < active_->count) active_->enabled[index] = enabled;
+    }
+
+    void clear() {
+        for (auto& entry : entries_) entry.identity = 0;
+        active_ = nullptr;
+    }
+
+    const Stats& stats() const { return stats_; }
+
+private:
+    struct Entry {
+        uint32_t identity = 0;  // 0 = free
+        uint32_t stamp = 0;
+        uint32_t lastUse = 0;
+        uint16_t used = 0;
+        uint8_t count = 0;
+        bool full = false;
+        DeviceType deviceTypes[MAX_DEVICES];
+        bool enabled[MAX_DEVICES];
+        uint8_t childFlags[MAX_DEVICES];
+        char text[TEXT_BYTES];
+    };
+
+    Entry* find(uint32_t identity) {
+        for (auto& entry : entries_) {
+            if (entry.identity == identity) return &entry;
+        }
+        return nullptr;
+    }
+
+    Entry* leastRecentlyUsed() {
+        Entry* oldest = &entries_[0];
+        for (auto& entry : entries_) {
+            if (entry.identity == 0) return &entry;
+            if (entry.lastUse < oldest->lastUse) oldest = &entry;
+        }
+        return oldest;
+    }
+
+    Entry entries_[CAPACITY];
+    Entry* active_ = nullptr;
+    uint32_t clock_ = 0;
+    Stats stats_;
+};
+
+}  // namespace bitwig::state
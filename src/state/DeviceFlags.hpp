@@ -0,0 +1,34 @@
+#pragma once
+
+/**
+ * @file DeviceFlags.hpp
+ * @brief Per-device flags of the device selector (enabled + child types)
+ *
+ * The selector needs four booleans per device: enabled, has slots, has
+ * layers, has drum pads. They are packed in FlagMasks, using the
+ * CHILD_TYPE_* bits plus DEVICE_FLAG_ENABLED, so the child flags of
+ * DEVICE_LIST_WINDOW and DeviceChainCache go in unchanged.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "FlagMasks.hpp"
+#include "protocol/ChildType.hpp"
+
+namespace bitwig::state {
+
+constexpr uint8_t DEVICE_FLAG_SLOTS = CHILD_TYPE_SLOTS;
+constexpr uint8_t DEVICE_FLAG_LAYERS = CHILD_TYPE_LAYERS;
+constexpr uint8_t DEVICE_FLAG_DRUMS = CHILD_TYPE_DRUMS;
+constexpr uint8_t DEVICE_FLAG_ENABLED = 0x08;
+constexpr uint8_t DEVICE_FLAG_CHILDREN =
+    DEVICE_FLAG_SLOTS | DEVICE_FLAG_LAYERS | DEVICE_FLAG_DRUMS;
+
+class DeviceFlags : public FlagMasks<4> {
+public:
+    bool enabled(size_t index) const { return has(index, DEVICE_FLAG_ENABLED); }
+    bool hasChildren(size_t index) const { return has(index, DEVICE_FLAG_CHILDREN); }
+};
+
+}  // namespace bitwig::state
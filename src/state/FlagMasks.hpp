@@ -0,0 +1,100 @@
+#pragma once
+
+/**
+ * @file FlagMasks.hpp
+ * @brief Per-item boolean flags of a selector list, packed in 64-bit masks
+ *
+ * Selector lists carry a few booleans per item (device enabled, track
+ * mute/solo, ...). Instead of one Signal<bool> per item and flag, FlagMasks
+ * keeps one 64-bit mask per flag (bit i = item at display index i). An
+ * item's flags read and write as one byte, bit f being flag f.
+ *
+ * Mutators return the mask of items whose flags changed, so callers can
+ * publish a single change notification per update (see SignalFlags).
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bitwig::state {
+
+template <size_t FlagCount>
+class FlagMasks {
+public:
+    static_assert(FlagCount > 0 && FlagCount <= 8, "Flags are read and written as one byte");
+
+    static constexpr size_t CAPACITY = 64;  // One bit per item in a uint64_t
+    static constexpr size_t FLAG_COUNT = FlagCount;
+
+    size_t size() const { return count_; }
+
+    /// Flags byte of the item at @p index (0 if out of range)
+    uint8_t at(size_t index) const {
+        if (index >= count_) return 0;
+        uint8_t flags = 0;
+        for (size_t f = 0; f < FlagCount; ++f) {
+            if ((masks_[f] >> index) & 1u) flags |= static_cast<uint8_t>(1u << f);
+        }
+        return flags;
+    }
+
+    /// True if the item at @p index has any of the @p flags bits
+    bool has(size_t index, uint8_t flags) const { return (at(index) & flags) != 0; }
+
+    /// Items that have @p flag (a single flag bit)
+    uint64_t mask(uint8_t flag) const {
+        for (size_t f = 0; f < FlagCount; ++f) {
+            if (flag == (1u << f)) return masks_[f];
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Replace the flags of the item at @p index (list grows to index + 1)
+     * @return Bit of @p index if its flags changed, else 0
+     */
+    uint64_t set(size_t index, uint8_t flags) {
+        if (index >= CAPACITY) return 0;
+        if (index >= count_) count_ = static_cast<uint8_t>(index + 1);
+
+        uint64_t bit = uint64_t{1} << index;
+        uint64_t changed = 0;
+        for (size_t f = 0; f < FlagCount; ++f) {
+            uint64_t wanted = (flags >> f) & 1u ? bit : 0;
+            changed |= (masks_[f] & bit) ^ wanted;
+            masks_[f] = (masks_[f] & ~bit) | wanted;
+        }
+        return changed;
+    }
+
+    /// Set or clear one flag bit of the item at @p index
+    uint64_t setFlag(size_t index, uint8_t flag, bool on) {
+        if (index >= count_) return 0;
+        uint8_t flags = at(index);
+        return set(index, on ? flags | flag : flags & ~flag);
+    }
+
+    /**
+     * @brief Set the list size (items past it lose their flags)
+     * @return Items whose flags were dropped
+     */
+    uint64_t resize(size_t count) {
+        if (count > CAPACITY) count = CAPACITY;
+        uint64_t keep = count == CAPACITY ? ~uint64_t{0} : (uint64_t{1} << count) - 1;
+        uint64_t changed = 0;
+        for (auto& m : masks_) {
+            changed |= m & ~keep;
+            m &= keep;
+        }
+        count_ = static_cast<uint8_t>(count);
+        return changed;
+    }
+
+    uint64_t clear() { return resize(0); }
+
+private:
+    uint64_t masks_[FlagCount] = {};  // masks_[f]: items with flag 1 << f
+    uint8_t count_ = 0;
+};
+
+}  // namespace bitwig::state
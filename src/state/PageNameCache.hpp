@@ -0,0 +1,149 @@
+#pragma once
+
+/**
+ * @file PageNameCache.hpp
+ * @brief LRU of page name lists, keyed by a host-supplied device identity
+ *
+ * DEVICE_CHANGE_HEADER resets the page selector, and page names are then
+ * downloaded window by window. Flipping between two plugins with 100+ pages
+ * would re-download every list on every visit. The header carries two
+ * hashes computed by the host:
+ *
+ * - deviceIdentity: which device (the cache key, 0 = do not cache)
+ * - pageNamesHash: which version of its page list (the validator)
+ *
+ * activate() on each header: a hit (same identity, same hash) hands back the
+ * names held for the device, so the selector is filled without any request.
+ * Otherwise a fresh entry is taken (least recently used one recycled) and
+ * put() records the names of the windows that follow, in order.
+ *
+ * Memory is fixed: CAPACITY entries of TEXT_BYTES. A device whose names do
+ * not fit is cached up to the last name that fits; the rest is loaded
+ * through the usual prefetch.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace bitwig::state {
+
+class PageNameCache {
+public:
+    static constexpr size_t CAPACITY = 4;        // Devices
+    static constexpr size_t TEXT_BYTES = 2048;   // Length-prefixed names per device
+    static constexpr size_t MAX_NAMES = 128;     // Matches MAX_PAGES
+
+    struct Stats {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        uint32_t stale = 0;  // Identity known, page list changed
+    };
+
+    /**
+     * @brief Make @p identity the device the next put() calls belong to
+     *
+     * @param fn Called as fn(index, name) for each cached name on a hit
+     * @return Number of names handed to @p fn (0 on a miss or if uncacheable)
+     */
+    template <typename Fn>
+    uint8_t activate(uint32_t identity, uint32_t namesHash, Fn&& fn) {
+        active_ = nullptr;
+        if (identity == 0) return 0;
+
+        Entry* entry = find(identity);
+        if (entry != nullptr && entry->namesHash == namesHash) {
+            ++stats_.hits;
+            entry->lastUse = ++clock_;
+            active_ = entry;
+
+            size_t offset = 0;
+            for (uint8_t i = 0; i < entry->count; ++i) {
+                uint8_t length = static_cast<uint8_t>(entry->text[offset]);
+                fn(i, std::string_view(entry->text + offset + 1, length));
+                offset += 1 + length;
+            }
+            return entry->count;
+        }
+
+        if (entry != nullptr) {
+            ++stats_.stale;
+        } else {
+            ++stats_.misses;
+            entry = leastRecentlyUsed();
+        }
+        entry->identity = identity;
+        entry->namesHash = namesHash;
+        entry->lastUse = ++clock_;
+        entry->count = 0;
+        entry->used = 0;
+        entry->full = false;
+        active_ = entry;
+        return 0;
+    }
+
+    /// Stop recording (names that follow belong to no cached device)
+    void deactivate() { active_ = nullptr; }
+
+    /**
+     * @brief Record the name at @p index for the active device
+     *
+     * Only the next index in sequence is kept, so the entry always holds
+     * names [0, count) with no gaps. Names beyond TEXT_BYTES are dropped.
+     */
+    void put(uint8_t index, std::string_view name) {
+        if (active_ == nullptr || active_->full || index != active_->count || index >= MAX_NAMES) return;
+
+        size_t length = name.size() > 255 ? 255 : name.size();
+        if (active_->used + 1 + length > TEXT_BYTES) {
+            active_->full = true;
+            return;
+        }
+        active_->text[active_->used] = static_cast<char>(length);
+        std::memcpy(active_->text + active_->used + 1, name.data(), length);
+        active_->used = static_cast<uint16_t>(active_->used + 1 + length);
+        ++active_->count;
+    }
+
+    void clear() {
+        for (auto& entry : entries_) entry.identity = 0;
+        active_ = nullptr;
+    }
+
+    const Stats& stats() const { return stats_; }
+
+private:
+    struct Entry {
+        uint32_t identity = 0;  // 0 = free
+        uint32_t namesHash = 0;
+        uint32_t lastUse = 0;
+        uint16_t used = 0;
+        uint8_t count = 0;
+        bool full = false;
+        char text[TEXT_BYTES];
+    };
+
+    Entry* find(uint32_t identity) {
+        for (auto& entry : entries_) {
+            if (entry.identity == identity) return &entry;
+        }
+        return nullptr;
+    }
+
+    Entry* leastRecentlyUsed() {
+        Entry* oldest = &entries_[0];
+        for (auto& entry : entries_) {
+            if (entry.identity == 0) return &entry;
+            if (entry.lastUse < oldest->lastUse) oldest = &entry;
+        }
+        return oldest;
+    }
+
+    Entry entries_[CAPACITY];
+    Entry* active_ = nullptr;
+    uint32_t clock_ = 0;
+    Stats stats_;
+};
+
+}  // namespace bitwig::state
@@ -0,0 +1,94 @@
+#pragma once
+
+/**
+ * @file ParameterHotBlock.hpp
+ * @brief Per-frame numeric state of the remote control slots, in one dense block
+ *
+ * DEVICE_REMOTE_CONTROLS_BATCH arrives up to once per controller frame and
+ * touches values, modulation offsets, list indices and automation flags of
+ * the 8 slots. Stored one slot at a time next to names, discrete value
+ * strings and per-field signals, that path walked most of ParameterState.
+ *
+ * The hot fields of all slots live here as parallel arrays plus one bit mask
+ * per flag (bit i = slot i): 75 bytes of fields, padded to 96 by
+ * alignas(32), i.e. exactly three 32-byte Cortex-M7 cache lines (two
+ * 64-byte lines on the native build). Cold metadata (name, type, discrete
+ * values) stays in ParameterSlot.
+ *
+ * Mutators return the bit of the slot if it changed (0 otherwise), so the
+ * caller can publish one notification for all changed slots.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bitwig::state {
+
+template <size_t Slots>
+struct alignas(32) ParameterHotBlock {
+    static_assert(Slots > 0 && Slots <= 8, "Slot flags are stored on 8 bits");
+
+    static constexpr size_t SLOTS = Slots;
+
+    float values[Slots] = {};
+    float modulationOffsets[Slots] = {};  // modulatedValue = value + offset
+    uint8_t currentValueIndex[Slots] = {};
+    uint8_t modulatedMask = 0;            // Modulation active (automation, LFO, ...)
+    uint8_t automationMask = 0;           // Parameter has automation data
+    uint8_t showModulationMask = 0;       // Parameter button held
+
+    float value(size_t i) const { return values[i]; }
+    float modulationOffset(size_t i) const { return modulationOffsets[i]; }
+    uint8_t valueIndex(size_t i) const { return currentValueIndex[i]; }
+    bool isModulated(size_t i) const { return bit(modulatedMask, i); }
+    bool hasAutomation(size_t i) const { return bit(automationMask, i); }
+    bool showModulation(size_t i) const { return bit(showModulationMask, i); }
+
+    uint8_t setValue(size_t i, float v) { return assign(values[i], v, i); }
+    uint8_t setModulationOffset(size_t i, float v) { return assign(modulationOffsets[i], v, i); }
+    uint8_t setValueIndex(size_t i, uint8_t idx) { return assign(currentValueIndex[i], idx, i); }
+    uint8_t setModulated(size_t i, bool on) { return setBit(modulatedMask, i, on); }
+    uint8_t setAutomation(size_t i, bool on) { return setBit(automationMask, i, on); }
+    uint8_t setShowModulation(size_t i, bool on) { return setBit(showModulationMask, i, on); }
+
+    /// Replace the automation flags of all slots; returns the slots that changed
+    uint8_t setAutomationMask(uint8_t mask) {
+        mask &= ALL;
+        uint8_t changed = automationMask ^ mask;
+        automationMask = mask;
+        return changed;
+    }
+
+    /// Back to defaults; returns the slots that changed
+    uint8_t reset() {
+        uint8_t changed = 0;
+        for (size_t i = 0; i < Slots; ++i) {
+            changed |= setValue(i, 0.0f) | setModulationOffset(i, 0.0f) | setValueIndex(i, 0);
+        }
+        changed |= modulatedMask | automationMask | showModulationMask;
+        modulatedMask = automationMask = showModulationMask = 0;
+        return changed;
+    }
+
+private:
+    static constexpr uint8_t ALL = static_cast<uint8_t>((1u << Slots) - 1);
+
+    static bool bit(uint8_t mask, size_t i) { return (mask >> i) & 1u; }
+
+    template <typename T>
+    static uint8_t assign(T& field, T v, size_t i) {
+        if (field == v) return 0;
+        field = v;
+        return static_cast<uint8_t>(1u << i);
+    }
+
+    static uint8_t setBit(uint8_t& mask, size_t i, bool on) {
+        uint8_t b = static_cast<uint8_t>(1u << i);
+        uint8_t next = on ? mask | b : mask & ~b;
+        if (next == mask) return 0;
+        mask = next;
+        return b;
+    }
+};
+
+}  // namespace bitwig::state
@@ -4,7 +4,11 @@
  * @file ParameterState.hpp
  * @brief Signal-based state for device parameters (8 macros)
  *
- * Each parameter has reactive signals for value, name, display value, etc.
+ * Split hot/cold:
+ * - hot: values, modulation and automation of all slots in one dense block
+ *   (ParameterHotBlock), written by the per-frame batch, one change signal
+ * - slots: per-slot metadata signals (name, type, discrete values, ...),
+ *   written on page change
  * UI components subscribe to these signals for automatic updates.
  */
 
@@ -16,6 +20,8 @@
 #include <oc/state/SignalVector.hpp>
 
 #include "Constants.hpp"
+#include "ParameterHotBlock.hpp"
+#include "StateTransaction.hpp"
 
 namespace bitwig::state {
 
@@ -25,26 +31,69 @@ using oc::state::SignalTiny;
 using oc::state::SignalVector;
 
 /**
- * @brief State for a single device parameter
+ * @brief Hot numeric state of the 8 parameters, with one change signal
  *
- * Contains all reactive properties for one of the 8 macro parameters.
+ * Writes go to the dense ParameterHotBlock and collect the changed slots;
+ * revision() is bumped once per StateTransaction (i.e. once per host
+ * message) and changedMask() holds the slots changed in that revision.
+ */
+class ParameterHotState final : public Deferred {
+public:
+    using Block = ParameterHotBlock<PARAMETER_COUNT>;
+
+    const Block& get() const { return block_; }
+
+    void setValue(size_t i, float v) { touch(block_.setValue(i, v)); }
+    void setModulationOffset(size_t i, float v) { touch(block_.setModulationOffset(i, v)); }
+    void setValueIndex(size_t i, uint8_t index) { touch(block_.setValueIndex(i, index)); }
+    void setModulated(size_t i, bool on) { touch(block_.setModulated(i, on)); }
+    void setAutomation(size_t i, bool on) { touch(block_.setAutomation(i, on)); }
+    void setAutomationMask(uint8_t mask) { touch(block_.setAutomationMask(mask)); }
+    void setShowModulation(size_t i, bool on) { touch(block_.setShowModulation(i, on)); }
+    void reset() { touch(block_.reset()); }
+
+    /// Bumped once per notification
+    Signal<uint16_t, 4>& revision() { return revision_; }
+
+    /// Slots changed in the current revision
+    uint8_t changedMask() const { return changed_mask_; }
+
+private:
+    void touch(uint8_t changed) {
+        if (changed == 0) return;
+        pending_ |= changed;
+        schedule();
+    }
+
+    void publish() override {
+        if (pending_ == 0) return;
+        changed_mask_ = pending_;
+        pending_ = 0;
+        revision_.set(static_cast<uint16_t>(revision_.get() + 1));
+    }
+
+    Block block_;
+    uint8_t pending_ = 0;
+    uint8_t changed_mask_ = 0;
+    Signal<uint16_t, 4> revision_{0};
+};
+
+/**
+ * @brief Cold metadata of a single device parameter
+ *
+ * Reactive properties of one of the 8 macro parameters that change with the
+ * page, not per frame (hot values live in ParameterHotState).
  * Handlers update these signals, views subscribe to them.
  */
 struct ParameterSlot {
-    // Value and display
-    Signal<float> value{0.0f};
-    Signal<float> origin{0.0f};           // Bipolar center point
-    Signal<float> modulationOffset{0.0f}; // Offset from value (modulatedValue = value + offset)
-    Signal<bool> isModulated{false};      // True when modulation is active (automation, LFO, etc.)
-    Signal<bool> hasAutomation{false};    // True when parameter has automation data
-    Signal<bool> showModulation{false};   // True while the parameter button is held
+    // Display
+    Signal<float> origin{0.0f};  // Bipolar center point
     SignalLabel name;
     SignalTiny displayValue;
 
     // Metadata
     Signal<ParameterType> type{ParameterType::KNOB};
     Signal<int16_t> discreteCount{-1};  // -1=continuous, N=steps
-    Signal<uint8_t> currentValueIndex{0};
     SignalVector<std::string, MAX_DISCRETE_VALUES> discreteValues;
 
     // Visibility and state
@@ -53,17 +102,11 @@ struct ParameterSlot {
     Signal<bool> metadataSet{false};
 
     void reset() {
-        value.set(0.0f);
         origin.set(0.0f);
-        modulationOffset.set(0.0f);
-        isModulated.set(false);
-        hasAutomation.set(false);
-        showModulation.set(false);
         name.set("");
         displayValue.set("");
         type.set(ParameterType::KNOB);
         discreteCount.set(-1);
-        currentValueIndex.set(0);
         discreteValues.clear();
         visible.set(true);
         loading.set(false);
@@ -75,12 +118,14 @@ struct ParameterSlot {
  * @brief State for all 8 device parameters
  */
 struct ParameterState {
+    ParameterHotState hot;
     std::array<ParameterSlot, PARAMETER_COUNT> slots;
 
     ParameterSlot& operator[](size_t i) { return slots[i]; }
     const ParameterSlot& operator[](size_t i) const { return slots[i]; }
 
     void resetAll() {
+        hot.reset();
         for (auto& slot : slots) {
             slot.reset();
         }
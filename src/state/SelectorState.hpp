@@ -5,17 +5,21 @@
  * @brief Signal-based state for selectors (pages, devices, tracks)
  *
  * Design rationale:
- * - SignalVector: for lists replaced in bulk (names, types, colors)
- * - std::array<Signal<T>>: for per-element reactivity (mute, solo, enabled states)
+ * - SignalStringList: for name lists (fixed arena, no heap string per name)
+ * - SignalVector: for other lists replaced in bulk (types, colors)
+ * - SignalFlags: per-item booleans packed in masks, one change signal
  */
 
-#include <array>
-#include <string>
-
 #include <oc/state/SignalString.hpp>
 #include <oc/state/SignalVector.hpp>
 
 #include "Constants.hpp"
+#include "DeviceChainCache.hpp"
+#include "PageNameCache.hpp"
+#include "DeviceFlags.hpp"
+#include "SignalFlags.hpp"
+#include "SignalStringList.hpp"
+#include "TrackFlags.hpp"
 #include "protocol/DeviceType.hpp"
 #include "protocol/TrackType.hpp"
 
@@ -36,9 +40,10 @@ using oc::state::SignalVector;
  * - names: accumulated cache of page names (up to MAX_PAGES)
  * - totalCount: absolute total number of pages from host
  * - loadedUpTo: highest index loaded so far (for prefetch trigger)
+ * - cache: names of recently visited devices (see PageNameCache)
  */
 struct PageSelectorState {
-    SignalVector<std::string, MAX_PAGES> names;  // Accumulated cache
+    SignalStringList<MAX_PAGES> names;  // Accumulated cache
     Signal<int, 4> selectedIndex{0};
     Signal<bool, 6> visible{false};
 
@@ -46,8 +51,12 @@ struct PageSelectorState {
     Signal<uint8_t, 4> totalCount{0};   // Total pages (absolute, from host)
     Signal<uint8_t, 4> loadedUpTo{0};   // Highest loaded index (for prefetch)
 
+    PageNameCache cache;
+    static_assert(PageNameCache::MAX_NAMES >= MAX_PAGES, "Page name cache must hold MAX_PAGES names");
+
     void reset() {
         names.clear();
+        cache.clear();
         selectedIndex.set(0);
         visible.set(false);
         totalCount.set(0);
@@ -66,20 +75,18 @@ struct PageSelectorState {
  * - names: accumulated cache of device names (up to MAX_DEVICES)
  * - totalCount: absolute total number of devices from host
  * - loadedUpTo: highest index loaded so far (for prefetch trigger)
+ * - cache: lists of recently visited chains (see DeviceChainCache)
  */
 struct DeviceSelectorState {
-    // Bulk-replaced lists (SignalVector) - accumulated cache for windowed loading
-    SignalVector<std::string, MAX_DEVICES> names;
+    // Bulk-replaced lists - accumulated cache for windowed loading
+    SignalStringList<MAX_DEVICES> names;
     SignalVector<DeviceType, MAX_DEVICES> deviceTypes;
-    SignalVector<bool, MAX_DEVICES> hasSlots;
-    SignalVector<bool, MAX_DEVICES> hasLayers;
-    SignalVector<bool, MAX_DEVICES> hasDrums;
 
-    // Per-element reactive state (updated individually by host)
-    std::array<Signal<bool>, MAX_DEVICES> deviceStates{};
+    // Enabled + child type flags, one bit per device (see DeviceFlags)
+    SignalFlags<DeviceFlags> flags;
 
     // Child devices (slots/layers/drums) - bulk replaced
-    SignalVector<std::string, MAX_CHILDREN> childrenNames;
+    SignalStringList<MAX_CHILDREN> childrenNames;
     SignalVector<uint8_t, MAX_CHILDREN> childrenTypes;
 
     Signal<int, 4> currentIndex{0};
@@ -94,13 +101,16 @@ struct DeviceSelectorState {
     Signal<uint8_t, 4> loadedUpTo{0};   // Highest loaded index (for prefetch)
     Signal<bool, 4> loading{false};     // True while waiting for host response
 
+    DeviceChainCache cache;
+    static_assert(DeviceChainCache::MAX_DEVICES >= MAX_DEVICES, "Device chain cache must hold MAX_DEVICES devices");
+    static_assert(DeviceFlags::CAPACITY >= MAX_DEVICES, "Device flags must hold MAX_DEVICES devices");
+
     void reset() {
         names.clear();
+        cache.clear();
         deviceTypes.clear();
-        hasSlots.clear();
-        hasLayers.clear();
-        hasDrums.clear();
-        for (auto& s : deviceStates) s.set(false);
+        flags.clear();
+        flags.commit();
         childrenNames.clear();
         childrenTypes.clear();
         currentIndex.set(0);
@@ -128,14 +138,14 @@ struct DeviceSelectorState {
  * - loadedUpTo: highest index loaded so far (for prefetch trigger)
  */
 struct TrackSelectorState {
-    // Bulk-replaced lists (SignalVector) - accumulated cache for windowed loading
-    SignalVector<std::string, MAX_TRACKS> names;
+    // Bulk-replaced lists - accumulated cache for windowed loading
+    SignalStringList<MAX_TRACKS> names;
     SignalVector<TrackType, MAX_TRACKS> trackTypes;
     SignalVector<uint32_t, MAX_TRACKS> trackColors;
 
-    // Per-element reactive state (updated individually by host)
-    std::array<Signal<bool>, MAX_TRACKS> muteStates{};
-    std::array<Signal<bool>, MAX_TRACKS> soloStates{};
+    // Mute, solo, muted-by-solo and arm, one bit per track (see TrackFlags)
+    SignalFlags<TrackFlags> flags;
+    static_assert(TrackFlags::CAPACITY >= MAX_TRACKS, "Track flags must hold MAX_TRACKS tracks");
 
     Signal<int, 4> currentIndex{0};
     Signal<int, 4> activeTrackIndex{0};
@@ -150,8 +160,8 @@ struct TrackSelectorState {
         names.clear();
         trackTypes.clear();
         trackColors.clear();
-        for (auto& s : muteStates) s.set(false);
-        for (auto& s : soloStates) s.set(false);
+        flags.clear();
+        flags.commit();
         currentIndex.set(0);
         activeTrackIndex.set(0);
         isNested.set(false);
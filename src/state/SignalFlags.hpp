@@ -0,0 +1,62 @@
+#pragma once
+
+/**
+ * @file SignalFlags.hpp
+ * @brief Reactive FlagMasks with one change signal for the whole list
+ *
+ * Writes are staged: set(), setFlag() and resize() update the masks and
+ * collect the changed-item bits; commit() publishes them once by bumping
+ * revision(), so a 16-item window is a single notification. Inside a
+ * StateTransaction, commits merge into one notification at its end.
+ * Subscribers read changedMask(): display indices whose flags changed in
+ * that revision.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <oc/state/Signal.hpp>
+
+#include "StateTransaction.hpp"
+
+namespace bitwig::state {
+
+template <typename Flags>
+class SignalFlags final : public Deferred {
+public:
+    const Flags& get() const { return flags_; }
+    size_t size() const { return flags_.size(); }
+
+    void set(size_t index, uint8_t flags) { pending_ |= flags_.set(index, flags); }
+    void setFlag(size_t index, uint8_t flag, bool on) {
+        pending_ |= flags_.setFlag(index, flag, on);
+    }
+    void resize(size_t count) { pending_ |= flags_.resize(count); }
+    void clear() { pending_ |= flags_.clear(); }
+
+    /// Publish the items changed since the last commit (no-op if none)
+    void commit() {
+        if (pending_ != 0) schedule();
+    }
+
+    /// Bumped once per published commit
+    oc::state::Signal<uint16_t, 4>& revision() { return revision_; }
+
+    /// Display indices changed in the current revision
+    uint64_t changedMask() const { return changed_mask_; }
+
+private:
+    void publish() override {
+        if (pending_ == 0) return;
+        changed_mask_ = pending_;
+        pending_ = 0;
+        revision_.set(static_cast<uint16_t>(revision_.get() + 1));
+    }
+
+    Flags flags_;
+    uint64_t pending_ = 0;
+    uint64_t changed_mask_ = 0;
+    oc::state::Signal<uint16_t, 4> revision_{0};
+};
+
+}  // namespace bitwig::state
@@ -0,0 +1,77 @@
+#pragma once
+
+/**
+ * @file SignalStringList.hpp
+ * @brief Reactive selector name list backed by a StringPool
+ *
+ * Drop-in for SignalVector<std::string, N> in the selector states: same
+ * mutators (setAt, resize, set, clear), but names live in the fixed arena
+ * of a StringPool instead of one heap string each. UI props read them in
+ * place through view().
+ *
+ * Observers watch revision(), bumped once per effective change (writing the
+ * name already stored does not notify), or once per StateTransaction.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <oc/state/Signal.hpp>
+
+#include "StateTransaction.hpp"
+#include "StringListView.hpp"
+#include "StringPool.hpp"
+
+namespace bitwig::state {
+
+template <size_t Slots>
+class SignalStringList final : public Deferred {
+public:
+    using Pool = StringPool<Slots>;
+
+    size_t size() const { return pool_.size(); }
+    bool empty() const { return pool_.empty(); }
+    std::string_view operator[](size_t index) const { return pool_[index]; }
+    const char* c_str(size_t index) const { return pool_.c_str(index); }
+
+    void setAt(size_t index, std::string_view text) {
+        if (pool_.setAt(index, text)) touch();
+    }
+
+    void resize(size_t count) {
+        if (count == pool_.size()) return;
+        pool_.resize(count);
+        touch();
+    }
+
+    /// Replace the whole list (one notification)
+    void set(const std::string_view* items, size_t count) {
+        pool_.resize(count);
+        for (size_t i = 0; i < pool_.size(); ++i) pool_.setAt(i, items[i]);
+        touch();
+    }
+
+    void clear() {
+        if (pool_.empty()) return;
+        pool_.clear();
+        touch();
+    }
+
+    /// Changes counter, for SignalWatcher groups and subscriptions
+    oc::state::Signal<uint16_t, 4>& revision() { return revision_; }
+
+    /// Names for UI props, read in place (no copy)
+    StringListView view() const { return StringListView(pool_); }
+
+    const Pool& pool() const { return pool_; }
+
+private:
+    void touch() { schedule(); }
+    void publish() override { revision_.set(static_cast<uint16_t>(revision_.get() + 1)); }
+
+    Pool pool_;
+    oc::state::Signal<uint16_t, 4> revision_{0};
+};
+
+}  // namespace bitwig::state
@@ -0,0 +1,134 @@
+#pragma once
+
+/**
+ * @file StateTransaction.hpp
+ * @brief Defers and deduplicates state notifications until the end of a message
+ *
+ * A host message touches many signals: a device list window writes 16 names,
+ * types and flags, a page change rewrites every parameter slot. Publishers
+ * that derive from Deferred (SignalStringList, SignalFlags, view-side
+ * DeferredCall) notify through schedule():
+ *
+ * - no transaction open: publish() runs now (same as before)
+ * - transaction open: the publisher is queued once, publish() runs at commit
+ *
+ * so a message handled inside a transaction yields at most one notification
+ * per publisher, whatever the number of writes.
+ *
+ * BitwigContext opens one transaction per inbound frame (BitwigProtocol
+ * onFrameBegin / onFrameEnd). Transactions nest; only the outermost commit
+ * publishes. Publishers scheduled while publishing (a subscriber writing
+ * state) run immediately.
+ *
+ * Single-threaded by design (controller main loop), hence the static queue.
+ * Queued publishers must outlive the transaction (state lives as long as the
+ * context).
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "protocol/InlineCallback.hpp"
+
+namespace bitwig::state {
+
+class StateTransaction;
+
+/// Notification source that can be deferred to the end of a transaction
+class Deferred {
+public:
+    /// Publish now, or once at commit if a transaction is open
+    void schedule();
+
+protected:
+    ~Deferred() = default;
+
+    /// Send the notification (runs at most once per transaction)
+    virtual void publish() = 0;
+
+private:
+    friend class StateTransaction;
+    bool queued_ = false;
+};
+
+class StateTransaction {
+public:
+    /// Distinct publishers per transaction; beyond this they publish immediately
+    static constexpr size_t CAPACITY = 32;
+
+    /// RAII transaction: begin() on construction, commit() on destruction
+    class Scope {
+    public:
+        Scope() { begin(); }
+        ~Scope() { commit(); }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    static void begin() { ++depth_; }
+
+    /// Close the transaction; the outermost commit publishes queued notifications
+    static void commit() {
+        if (depth_ == 0 || --depth_ > 0) return;
+        for (size_t i = 0; i < count_; ++i) {
+            Deferred* deferred = queue_[i];
+            deferred->queued_ = false;
+            deferred->publish();
+        }
+        count_ = 0;
+    }
+
+    static bool isOpen() { return depth_ > 0; }
+
+    /// Publishers queued in the open transaction
+    static size_t pending() { return count_; }
+
+    /// Notifications merged into an already queued one (since startup)
+    static uint32_t merged() { return merged_; }
+
+private:
+    friend class Deferred;
+
+    /// Queue @p deferred; false if it must publish now
+    static bool defer(Deferred& deferred) {
+        if (depth_ == 0) return false;
+        if (deferred.queued_) {
+            ++merged_;
+            return true;
+        }
+        if (count_ == CAPACITY) return false;
+        deferred.queued_ = true;
+        queue_[count_++] = &deferred;
+        return true;
+    }
+
+    static inline Deferred* queue_[CAPACITY] = {};
+    static inline size_t count_ = 0;
+    static inline uint8_t depth_ = 0;
+    static inline uint32_t merged_ = 0;
+};
+
+inline void Deferred::schedule() {
+    if (!StateTransaction::defer(*this)) publish();
+}
+
+/**
+ * @brief Deferred callback for views and handlers
+ *
+ * For reactions that must not run once per write (e.g. widget rebuild on
+ * parameter type change): the owner accumulates what changed and calls
+ * schedule(); the callback runs once at commit.
+ */
+class DeferredCall final : public Deferred {
+public:
+    explicit DeferredCall(Protocol::InlineCallback<void()> callback) : callback_(callback) {}
+
+private:
+    void publish() override {
+        if (callback_) callback_();
+    }
+
+    Protocol::InlineCallback<void()> callback_;
+};
+
+}  // namespace bitwig::state
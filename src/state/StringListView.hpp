@@ -0,0 +1,52 @@
+#pragma once
+
+/**
+ * @file StringListView.hpp
+ * @brief Non-owning view of a selector name list, for UI props
+ *
+ * Selector props used to take a std::vector<std::string> copy of their
+ * SignalStringList on every render: one heap string per name. The view reads
+ * the names in place instead, from any list with size() and c_str(index)
+ * (SignalStringList, StringPool, whatever its capacity).
+ *
+ * It holds a pointer to the list, so it is valid as long as the list is
+ * (selector states live as long as the views rendering them).
+ */
+
+#include <cstddef>
+#include <string_view>
+
+namespace bitwig::state {
+
+class StringListView {
+public:
+    StringListView() = default;
+
+    template <typename List>
+    explicit StringListView(const List& list)
+        : list_(&list), size_(&sizeOf<List>), c_str_(&cStrOf<List>) {}
+
+    size_t size() const { return list_ ? size_(list_) : 0; }
+    bool empty() const { return size() == 0; }
+
+    /// Null-terminated string at @p index ("" if out of range)
+    const char* c_str(size_t index) const { return list_ ? c_str_(list_, index) : ""; }
+    std::string_view operator[](size_t index) const { return c_str(index); }
+
+private:
+    template <typename List>
+    static size_t sizeOf(const void* list) {
+        return static_cast<const List*>(list)->size();
+    }
+
+    template <typename List>
+    static const char* cStrOf(const void* list, size_t index) {
+        return static_cast<const List*>(list)->c_str(index);
+    }
+
+    const void* list_ = nullptr;
+    size_t (*size_)(const void*) = nullptr;
+    const char* (*c_str_)(const void*, size_t) = nullptr;
+};
+
+}  // namespace bitwig::state
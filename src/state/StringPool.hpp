@@ -0,0 +1,172 @@
+#pragma once
+
+/**
+ * @file StringPool.hpp
+ * @brief Fixed-capacity list of short strings packed in one arena
+ *
+ * Selector name lists (pages, devices, tracks, children) are filled one
+ * window at a time and rebuilt on every device or track change. Holding
+ * them as std::string meant a heap allocation per name longer than the
+ * small-string buffer, on every setAt() of every window.
+ *
+ * StringPool keeps up to Slots strings in a single char arena:
+ *
+ *   offsets_[i] / lengths_[i] -> arena_[offset, offset + length) + '\0'
+ *
+ * A string is written in place when it fits over the previous one,
+ * otherwise appended at the tail; when the tail is full the live strings
+ * are moved to the front (compact()). Strings are cut to MaxLength, so
+ * with the default ArenaBytes every slot can hold a full-length string and
+ * a write never fails. A smaller arena trades that guarantee for RAM:
+ * strings that do not fit even after compaction are truncated.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "protocol/ProtocolConstants.hpp"
+
+namespace bitwig::state {
+
+template <size_t Slots, size_t MaxLength = Protocol::STRING_MAX_LENGTH,
+          size_t ArenaBytes = Slots * (MaxLength + 1)>
+class StringPool {
+public:
+    static_assert(Slots > 0 && Slots <= 255, "Slot count must fit the 8-bit list sizes");
+    static_assert(MaxLength <= 255, "Lengths are stored on 8 bits");
+    static_assert(ArenaBytes < 0xFFFF, "Offsets are stored on 16 bits");
+
+    static constexpr size_t CAPACITY = Slots;
+    static constexpr size_t MAX_LENGTH = MaxLength;
+    static constexpr size_t ARENA_BYTES = ArenaBytes;
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /// String at @p index (empty view if out of range)
+    std::string_view operator[](size_t index) const {
+        if (index >= count_ || lengths_[index] == 0) return {};
+        return {arena_ + offsets_[index], lengths_[index]};
+    }
+
+    /// Null-terminated string at @p index ("" if out of range)
+    const char* c_str(size_t index) const {
+        if (index >= count_ || lengths_[index] == 0) return "";
+        return arena_ + offsets_[index];
+    }
+
+    /**
+     * @brief Store @p text at @p index, growing the list to index + 1 if needed
+     * @return false if @p index is beyond capacity or @p text equals the stored string
+     */
+    bool setAt(size_t index, std::string_view text) {
+        if (index >= Slots) return false;
+        if (index >= count_) grow(index + 1);
+        if (text.size() > MaxLength) text = text.substr(0, MaxLength);
+        if ((*this)[index] == text) return false;
+
+        size_t length = text.size();
+        if (length == 0) {
+            release(index);
+            return true;
+        }
+
+        // Fits over the previous string: no arena growth
+        if (length <= lengths_[index]) {
+            live_ -= lengths_[index] - length;
+            write(index, offsets_[index], text.data(), length);
+            return true;
+        }
+
+        release(index);
+        if (tail_ + length + 1 > ArenaBytes) compact();
+        if (tail_ + length + 1 > ArenaBytes) {
+            if (tail_ + 1 >= ArenaBytes) return true;  // Arena full: stays empty
+            length = ArenaBytes - tail_ - 1;
+        }
+        live_ += length + 1;
+        write(index, static_cast<uint16_t>(tail_), text.data(), length);
+        tail_ += length + 1;
+        return true;
+    }
+
+    /// Set the list size (new slots are empty strings)
+    void resize(size_t count) {
+        if (count > Slots) count = Slots;
+        if (count > count_) {
+            grow(count);
+            return;
+        }
+        for (size_t i = count; i < count_; ++i) release(i);
+        count_ = static_cast<uint8_t>(count);
+        if (count_ == 0) tail_ = 0;
+    }
+
+    void clear() { resize(0); }
+
+    /// Arena bytes held by live strings (terminators included)
+    size_t bytesUsed() const { return live_; }
+
+    /// Times the arena was compacted (allocation-free stand-in for heap churn)
+    uint32_t compactions() const { return compactions_; }
+
+private:
+    static constexpr uint16_t NO_OFFSET = 0xFFFF;
+
+    void grow(size_t count) {
+        for (size_t i = count_; i < count; ++i) {
+            offsets_[i] = NO_OFFSET;
+            lengths_[i] = 0;
+        }
+        count_ = static_cast<uint8_t>(count);
+    }
+
+    void release(size_t index) {
+        if (lengths_[index] != 0) live_ -= lengths_[index] + 1;
+        offsets_[index] = NO_OFFSET;
+        lengths_[index] = 0;
+    }
+
+    void write(size_t index, uint16_t offset, const char* text, size_t length) {
+        std::memcpy(arena_ + offset, text, length);
+        arena_[offset + length] = '\0';
+        offsets_[index] = offset;
+        lengths_[index] = static_cast<uint8_t>(length);
+    }
+
+    /// Move live strings to the front of the arena, keeping their order
+    void compact() {
+        ++compactions_;
+        size_t write_pos = 0;
+        uint16_t floor = 0;  // Strings below this offset are already in place
+        for (;;) {
+            // Next live string by offset (no scratch array: Slots is small)
+            size_t next = Slots;
+            for (size_t i = 0; i < count_; ++i) {
+                if (lengths_[i] == 0 || offsets_[i] < floor) continue;
+                if (next == Slots || offsets_[i] < offsets_[next]) next = i;
+            }
+            if (next == Slots) break;
+
+            uint16_t from = offsets_[next];
+            size_t bytes = lengths_[next] + 1u;
+            floor = static_cast<uint16_t>(from + bytes);
+            std::memmove(arena_ + write_pos, arena_ + from, bytes);
+            offsets_[next] = static_cast<uint16_t>(write_pos);
+            write_pos += bytes;
+        }
+        tail_ = write_pos;
+    }
+
+    uint16_t offsets_[Slots];
+    uint8_t lengths_[Slots];
+    char arena_[ArenaBytes];
+    size_t tail_ = 0;   // First free arena byte
+    size_t live_ = 0;   // Bytes held by live strings
+    uint8_t count_ = 0;
+    uint32_t compactions_ = 0;
+};
+
+}  // namespace bitwig::state
@@ -0,0 +1,39 @@
+#pragma once
+
+/**
+ * @file TrackFlags.hpp
+ * @brief Per-track flags of the track selector (mute, solo, arm)
+ *
+ * Mute, solo, muted-by-solo and arm of up to 64 tracks packed in
+ * FlagMasks, indexed by display index like the other track lists.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "FlagMasks.hpp"
+
+namespace bitwig::state {
+
+constexpr uint8_t TRACK_FLAG_MUTE = 0x01;
+constexpr uint8_t TRACK_FLAG_SOLO = 0x02;
+constexpr uint8_t TRACK_FLAG_MUTED_BY_SOLO = 0x04;
+constexpr uint8_t TRACK_FLAG_ARM = 0x08;
+
+class TrackFlags : public FlagMasks<4> {
+public:
+    bool muted(size_t index) const { return has(index, TRACK_FLAG_MUTE); }
+    bool soloed(size_t index) const { return has(index, TRACK_FLAG_SOLO); }
+    bool mutedBySolo(size_t index) const { return has(index, TRACK_FLAG_MUTED_BY_SOLO); }
+    bool armed(size_t index) const { return has(index, TRACK_FLAG_ARM); }
+
+    /// Flags byte of a track from its protocol booleans
+    static uint8_t pack(bool isMute, bool isSolo, bool isMutedBySolo, bool isArm) {
+        return static_cast<uint8_t>((isMute ? TRACK_FLAG_MUTE : 0) |
+                                    (isSolo ? TRACK_FLAG_SOLO : 0) |
+                                    (isMutedBySolo ? TRACK_FLAG_MUTED_BY_SOLO : 0) |
+                                    (isArm ? TRACK_FLAG_ARM : 0));
+    }
+};
+
+}  // namespace bitwig::state
@@ -87,8 +87,8 @@ void DeviceSelector::render(const DeviceSelectorProps &props) {
 }
 
 void DeviceSelector::updateDeviceState(int displayIndex, bool enabled) {
-    if (displayIndex >= 0 && displayIndex < static_cast<int>(current_props_.deviceStates.size())) {
-        current_props_.deviceStates[displayIndex] = enabled;
+    if (displayIndex >= 0) {
+        current_props_.flags.setFlag(displayIndex, state::DEVICE_FLAG_ENABLED, enabled);
     }
 
     list_->invalidateIndex(displayIndex);
@@ -285,8 +285,8 @@ void DeviceSelector::renderFooter(const DeviceSelectorProps &props) {
     if (!footer_) return;
 
     int idx = props.selectedIndex;
-    bool is_enabled = idx >= 0 && idx < static_cast<int>(props.deviceStates.size())
-                          ? props.deviceStates[idx]
+    bool is_enabled = idx >= 0 && idx < static_cast<int>(props.flags.size())
+                          ? props.flags.enabled(idx)
                           : true;
 
     if (footer_state_) {
@@ -363,13 +363,13 @@ void DeviceSelector::populateSlotForDevice(DeviceSlotWidgets &widgets, int index
     const auto &names = current_props_.names;
     if (index < 0 || index >= static_cast<int>(names.size())) return;
 
-    const std::string &name = names[index];
+    std::string_view name = names[index];
     bool isBack = (index == 0) && (name == icons::UI_ARROW_LEFT);
 
     // Label (toujours visible) - will be moved to correct position below
     if (widgets.label) {
         lv_obj_clear_flag(widgets.label, LV_OBJ_FLAG_HIDDEN);
-        lv_label_set_text(widgets.label, name.c_str());
+        lv_label_set_text(widgets.label, names.c_str(index));
         lv_obj_set_style_text_font(widgets.label,
                                    isBack ? bitwig_fonts.icons_14 : bitwig_fonts.device_label,
                                    LV_STATE_DEFAULT);
@@ -398,8 +398,8 @@ void DeviceSelector::populateSlotForDevice(DeviceSlotWidgets &widgets, int index
 
     // State icon (index 1)
     if (isDevice && widgets.stateIcon) {
-        bool enabled = index < static_cast<int>(current_props_.deviceStates.size())
-                           ? current_props_.deviceStates[index]
+        bool enabled = index < static_cast<int>(current_props_.flags.size())
+                           ? current_props_.flags.enabled(index)
                            : true;
         icons::set(widgets.stateIcon, enabled ? icons::DEVICE_ON : icons::DEVICE_OFF);
         style::apply(widgets.stateIcon).textColor(enabled ? color::DEVICE_STATE_ENABLED
@@ -440,13 +440,13 @@ void DeviceSelector::populateSlotForChild(DeviceSlotWidgets &widgets, int index)
     const auto &names = current_props_.childrenNames;
     if (index < 0 || index >= static_cast<int>(names.size())) return;
 
-    const std::string &name = names[index];
+    std::string_view name = names[index];
     bool isBack = (index == 0) && (name == icons::UI_ARROW_LEFT);
 
     // Label (toujours visible)
     if (widgets.label) {
         lv_obj_clear_flag(widgets.label, LV_OBJ_FLAG_HIDDEN);
-        lv_label_set_text(widgets.label, name.c_str());
+        lv_label_set_text(widgets.label, names.c_str(index));
         lv_obj_set_style_text_font(widgets.label,
                                    isBack ? bitwig_fonts.icons_14 : bitwig_fonts.device_label,
                                    LV_STATE_DEFAULT);
@@ -540,15 +540,12 @@ lv_obj_t *DeviceSelector::createLabel(lv_obj_t *parent) {
 // Static Helpers
 // ══════════════════════════════════════════════════════════════════
 
-bool DeviceSelector::isNonDeviceItem(const std::string &name) {
+bool DeviceSelector::isNonDeviceItem(std::string_view name) {
     return name == icons::UI_ARROW_LEFT || (!name.empty() && name[0] == '[');
 }
 
 bool DeviceSelector::hasChildren(const DeviceSelectorProps &props, size_t index) {
-    bool hasSlots = index < props.hasSlots.size() && props.hasSlots[index];
-    bool hasLayers = index < props.hasLayers.size() && props.hasLayers[index];
-    bool hasDrums = index < props.hasDrums.size() && props.hasDrums[index];
-    return hasSlots || hasLayers || hasDrums;
+    return props.flags.hasChildren(index);
 }
 
 }  // namespace bitwig::ui
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <lvgl.h>
@@ -30,6 +31,8 @@
 
 #include "protocol/DeviceType.hpp"
 #include "protocol/TrackType.hpp"
+#include "state/DeviceFlags.hpp"
+#include "state/StringListView.hpp"
 #include "ui/track/TrackTitleItem.hpp"
 #include "ui/widget/HintBar.hpp"
 
@@ -42,15 +45,12 @@ using oc::ui::lvgl::widget::ScrollMode;
 
 struct DeviceSelectorProps {
     // Device list mode
-    std::vector<std::string> names;
+    state::StringListView names;
     std::vector<DeviceType> deviceTypes;
-    std::vector<bool> deviceStates;
-    std::vector<bool> hasSlots;
-    std::vector<bool> hasLayers;
-    std::vector<bool> hasDrums;
+    state::DeviceFlags flags;  // Enabled + child types, by display index
 
     // Children mode
-    std::vector<std::string> childrenNames;
+    state::StringListView childrenNames;
     std::vector<uint8_t> childrenTypes;
 
     // Track header
@@ -132,7 +132,7 @@ private:
     lv_obj_t *createLabel(lv_obj_t *parent);
 
     // Helpers
-    static bool isNonDeviceItem(const std::string &name);
+    static bool isNonDeviceItem(std::string_view name);
     static bool hasChildren(const DeviceSelectorProps &props, size_t index);
 
     // Overlay
@@ -162,9 +162,7 @@ void RemoteControlsPageSelector::bindSlot(VirtualSlot& slot, int index, bool isS
 
     // Get page name for this index
     const auto& props = current_props_;
-    const char* name = index < static_cast<int>(props.names.size())
-                           ? props.names[index].c_str()
-                           : "";
+    const char* name = props.names.c_str(index);
 
     // Update label
     if (widgets.label) {
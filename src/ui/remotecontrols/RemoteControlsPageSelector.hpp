@@ -26,6 +26,8 @@
 #include <oc/ui/lvgl/widget/Label.hpp>
 #include <oc/ui/lvgl/widget/VirtualList.hpp>
 
+#include "state/StringListView.hpp"
+
 namespace bitwig::ui {
 
 // Import VirtualList types from shared component
@@ -34,7 +36,7 @@ using oc::ui::lvgl::widget::VirtualSlot;
 using oc::ui::lvgl::widget::ScrollMode;
 
 struct RemoteControlsPageSelectorProps {
-    std::vector<std::string> names;
+    state::StringListView names;
     int selectedIndex = 0;
     int totalCount = 0;  // Total pages (for windowed loading)
     bool visible = false;
@@ -90,8 +90,9 @@ void RemoteControlsView::onDeactivate() {
 // Two binding patterns are used intentionally:
 //
 // 1. bind(subs_).on() - IMMEDIATE execution, used for:
-//    - Parameter type changes → must recreate widget immediately before
-//      other signals (value, name) fire, otherwise widget would be wrong type
+//    - Parameter type changes → must recreate widget before the coalesced
+//      value/name updates run, otherwise widget would be wrong type. Applied
+//      at the end of the host message (StateTransaction), once per slot
 //
 // 2. watcher_.watchAll() / watcher_.group() - COALESCED execution, used for:
 //    - Multiple signals that update the same UI component
@@ -127,30 +128,32 @@ void RemoteControlsView::setupBindings() {
         // Type change triggers widget creation/recreation (IMMEDIATE via bind)
         // Must execute before value/name signals to ensure correct widget type
         bind(subs_).on(slot.type, [this, i](ParameterType) {
-            ensureWidgetForType(i);
-            markParameterDirty(i);
+            pendingTypes_ |= static_cast<uint8_t>(1u << i);
+            typeChanges_.schedule();  // Once per host message (StateTransaction)
         });
 
-        // Value/display changes - coalesced per parameter slot
+        // Metadata/display changes - coalesced per parameter slot
         auto& paramGroup = watcher_.group([this, i]() { markParameterDirty(i); });
-        paramGroup.watch(slot.value);
         paramGroup.watch(slot.name);
         paramGroup.watch(slot.displayValue);
         paramGroup.watch(slot.visible);
-        paramGroup.watch(slot.currentValueIndex);
         paramGroup.watch(slot.discreteValues);
         paramGroup.watch(slot.origin);
-        paramGroup.watch(slot.modulationOffset);
-        paramGroup.watch(slot.isModulated);
-        paramGroup.watch(slot.showModulation);
-        paramGroup.watch(slot.hasAutomation);
     }
 
+    // Hot values/modulation/automation of all slots: one mask per host message
+    bind(subs_).on(state_.parameters.hot.revision(), [this](uint16_t) {
+        uint8_t changed = state_.parameters.hot.changedMask();
+        for (uint8_t i = 0; i < PARAMETER_COUNT; i++) {
+            if (changed & (1u << i)) markParameterDirty(i);
+        }
+    });
+
     // =========================================================================
     // Page Selector (coalesced with group - same pattern as DeviceSelector)
     // =========================================================================
     auto& pageSelectorGroup = watcher_.group([this]() { updatePageSelector(); });
-    pageSelectorGroup.watch(state_.pageSelector.names);
+    pageSelectorGroup.watch(state_.pageSelector.names.revision());
     pageSelectorGroup.watch(state_.pageSelector.selectedIndex);
     pageSelectorGroup.watch(state_.pageSelector.totalCount);
     pageSelectorGroup.watch(state_.pageSelector.visible);
@@ -159,28 +162,30 @@ void RemoteControlsView::setupBindings() {
     // Device Selector (coalesced with array signals)
     // =========================================================================
     auto& deviceSelectorGroup = watcher_.group([this]() { updateDeviceSelector(); });
-    deviceSelectorGroup.watch(state_.deviceSelector.names);
+    deviceSelectorGroup.watch(state_.deviceSelector.names.revision());
     deviceSelectorGroup.watch(state_.deviceSelector.visible);
     deviceSelectorGroup.watch(state_.deviceSelector.currentIndex);
     deviceSelectorGroup.watch(state_.deviceSelector.showingChildren);
     deviceSelectorGroup.watch(state_.deviceSelector.showFooter);
-    deviceSelectorGroup.watch(state_.deviceSelector.childrenNames);
+    deviceSelectorGroup.watch(state_.deviceSelector.childrenNames.revision());
     deviceSelectorGroup.watch(state_.deviceSelector.loading);
-    for (auto& s : state_.deviceSelector.deviceStates) {
-        deviceSelectorGroup.watch(s);
-    }
+    deviceSelectorGroup.watch(state_.deviceSelector.flags.revision());
 
     // =========================================================================
     // Track Selector (coalesced with array signals)
     // =========================================================================
     auto& trackSelectorGroup = watcher_.group([this]() { updateTrackSelector(); });
-    trackSelectorGroup.watch(state_.trackSelector.names);
+    trackSelectorGroup.watch(state_.trackSelector.names.revision());
     trackSelectorGroup.watch(state_.trackSelector.visible);
     trackSelectorGroup.watch(state_.trackSelector.currentIndex);
-    for (size_t i = 0; i < state_.trackSelector.muteStates.size(); i++) {
-        trackSelectorGroup.watch(state_.trackSelector.muteStates[i]);
-        trackSelectorGroup.watch(state_.trackSelector.soloStates[i]);
-    }
+
+    // Mute/solo/arm: only the rows whose bits changed are rebound (IMMEDIATE)
+    bind(subs_).on(state_.trackSelector.flags.revision(), [this](uint16_t) {
+        if (initialized_ && track_selector_) {
+            const auto& flags = state_.trackSelector.flags;
+            track_selector_->updateFlags(flags.get(), flags.changedMask());
+        }
+    });
 
     OC_LOG_DEBUG("[RemoteControlsView] Bound {} subscriptions ({} coalesced groups)",
                  subs_.size() + watcher_.subscriptionCount(), watcher_.groupCount());
@@ -203,6 +208,16 @@ void RemoteControlsView::updateDeviceInfo() {
     });
 }
 
+void RemoteControlsView::applyTypeChanges() {
+    uint8_t pending = pendingTypes_;
+    pendingTypes_ = 0;
+    for (uint8_t i = 0; i < state::PARAMETER_COUNT; i++) {
+        if (!(pending & (1u << i))) continue;
+        ensureWidgetForType(i);
+        markParameterDirty(i);
+    }
+}
+
 void RemoteControlsView::ensureWidgetForType(uint8_t index) {
     if (index >= state::PARAMETER_COUNT || !body_container_) return;
 
@@ -270,25 +285,26 @@ void RemoteControlsView::updateParameter(uint8_t index) {
     }
 
     auto& slot = state_.parameters.slots[index];
+    const auto& hot = state_.parameters.hot.get();
     auto type = slot.type.get();
     bool visible = slot.visible.get();
 
     // Update name and value
     widgets_[index]->setName(slot.name.get());
-    widgets_[index]->setValueWithDisplay(slot.value.get(), slot.displayValue.get());
+    widgets_[index]->setValueWithDisplay(hot.value(index), slot.displayValue.get());
 
     // Update automation indicator (all widget types)
-    widgets_[index]->setHasAutomation(slot.hasAutomation.get());
+    widgets_[index]->setHasAutomation(hot.hasAutomation(index));
 
     // Update origin, modulated value, and modulation state for knob widgets
     if (type == ParameterType::KNOB) {
         auto* knob = static_cast<ParameterKnobWidget*>(widgets_[index].get());
         knob->setOrigin(slot.origin.get());
-        const bool showModulation = slot.showModulation.get();
-        knob->setIsModulated(slot.isModulated.get() && showModulation);
+        const bool showModulation = hot.showModulation(index);
+        knob->setIsModulated(hot.isModulated(index) && showModulation);
         if (showModulation) {
             // Ribbon = value + offset (follows optimistic updates)
-            knob->setModulatedValue(slot.value.get() + slot.modulationOffset.get());
+            knob->setModulatedValue(hot.value(index) + hot.modulationOffset(index));
         }
     }
 
@@ -296,7 +312,7 @@ void RemoteControlsView::updateParameter(uint8_t index) {
     // Uses static_cast as all widgets inherit from BaseParameterWidget
     if (type == ParameterType::BUTTON || type == ParameterType::LIST) {
         static_cast<BaseParameterWidget*>(widgets_[index].get())->setDiscreteMetadata(
-            slot.discreteCount.get(), slot.discreteValues.toVector(), slot.currentValueIndex.get());
+            slot.discreteCount.get(), slot.discreteValues.toVector(), hot.valueIndex(index));
     }
 
     // Update visibility
@@ -325,7 +341,7 @@ void RemoteControlsView::updatePageSelector() {
                 totalCount, namesSize, state_.pageSelector.selectedIndex.get());
 
     page_selector_->render({
-        .names = state_.pageSelector.names,  // SignalVector converts to std::vector
+        .names = state_.pageSelector.names.view(),
         .selectedIndex = state_.pageSelector.selectedIndex.get(),
         .totalCount = totalCount,
         .visible = true
@@ -341,17 +357,11 @@ void RemoteControlsView::updateDeviceSelector() {
         return;
     }
 
-    // Device states: convert array of Signals to vector using helper
-    size_t count = state_.deviceSelector.names.size();
-
     device_selector_->render({
-        .names = state_.deviceSelector.names,
+        .names = state_.deviceSelector.names.view(),
         .deviceTypes = state_.deviceSelector.deviceTypes,
-        .deviceStates = oc::state::toVector(state_.deviceSelector.deviceStates, count),
-        .hasSlots = state_.deviceSelector.hasSlots,
-        .hasLayers = state_.deviceSelector.hasLayers,
-        .hasDrums = state_.deviceSelector.hasDrums,
-        .childrenNames = state_.deviceSelector.childrenNames,
+        .flags = state_.deviceSelector.flags.get(),
+        .childrenNames = state_.deviceSelector.childrenNames.view(),
         .childrenTypes = state_.deviceSelector.childrenTypes,
         .trackName = state_.currentTrack.name.get(),
         .trackColor = state_.currentTrack.color.get(),
@@ -375,13 +385,9 @@ void RemoteControlsView::updateTrackSelector() {
         return;
     }
 
-    // Mute/Solo states: convert array of Signals to vector using helper
-    size_t count = state_.trackSelector.names.size();
-
     track_selector_->render({
-        .names = state_.trackSelector.names,
-        .muteStates = oc::state::toVector(state_.trackSelector.muteStates, count),
-        .soloStates = oc::state::toVector(state_.trackSelector.soloStates, count),
+        .names = state_.trackSelector.names.view(),
+        .flags = state_.trackSelector.flags.get(),
         .trackTypes = state_.trackSelector.trackTypes,
         .trackColors = state_.trackSelector.trackColors,
         .selectedIndex = state_.trackSelector.currentIndex.get(),
@@ -24,6 +24,7 @@
 #include "protocol/ParameterType.hpp"
 #include "RemoteControlsPageSelector.hpp"
 #include "state/BitwigState.hpp"
+#include "state/StateTransaction.hpp"
 #include "ui/device/DeviceSelector.hpp"
 #include "ui/device/DeviceStateBar.hpp"
 #include "ui/track/TrackSelector.hpp"
@@ -98,6 +99,11 @@ private:
 
     void markParameterDirty(uint8_t index);
     void processDirtyParameters();
+
+    // Parameter type changes, applied once per host message
+    uint8_t pendingTypes_{0};  // Bit i = slot i changed type
+    bitwig::state::DeferredCall typeChanges_{[this]() { applyTypeChanges(); }};
+    void applyTypeChanges();
     static void onUpdateTimer(lv_timer_t* timer);
 
     // =========================================================================
@@ -87,6 +87,16 @@ void TrackSelector::render(const TrackSelectorProps &props) {
     renderFooter(props);
 }
 
+void TrackSelector::updateFlags(const state::TrackFlags &flags, uint64_t changed) {
+    current_props_.flags = flags;
+    if (!visible_) return;
+
+    for (int index = 0; changed != 0; ++index, changed >>= 1) {
+        if (changed & 1u) list_->invalidateIndex(index);
+    }
+    renderFooter(current_props_);
+}
+
 // ══════════════════════════════════════════════════════════════════
 // IComponent
 // ══════════════════════════════════════════════════════════════════
@@ -171,12 +181,8 @@ void TrackSelector::renderFooter(const TrackSelectorProps &props) {
     if (!footer_) return;
 
     int idx = props.selectedIndex;
-    bool is_muted = idx >= 0 && idx < static_cast<int>(props.muteStates.size())
-                        ? props.muteStates[idx]
-                        : false;
-    bool is_soloed = idx >= 0 && idx < static_cast<int>(props.soloStates.size())
-                         ? props.soloStates[idx]
-                         : false;
+    bool is_muted = idx >= 0 && props.flags.muted(idx);
+    bool is_soloed = idx >= 0 && props.flags.soloed(idx);
 
     if (footer_mute_)
         lv_obj_set_style_text_opa(footer_mute_, is_muted ? opacity::FULL : opacity::FADED,
@@ -201,12 +207,10 @@ void TrackSelector::bindSlot(VirtualSlot& slot, int index, bool isSelected) {
 
     // Get data for this index
     const auto &props = current_props_;
-    const char *name = index < static_cast<int>(props.names.size())
-                           ? props.names[index].c_str()
-                           : "";
+    const char *name = props.names.c_str(index);
 
     // Check if this is the back button
-    bool isBack = (index == 0) && (std::string(name) == icons::UI_ARROW_LEFT);
+    bool isBack = (index == 0) && (std::string_view(name) == icons::UI_ARROW_LEFT);
 
     if (isBack) {
         // Show back button, hide TrackTitleItem
@@ -232,12 +236,8 @@ void TrackSelector::bindSlot(VirtualSlot& slot, int index, bool isSelected) {
         TrackType trackType = index < static_cast<int>(props.trackTypes.size())
                                   ? props.trackTypes[index]
                                   : TrackType::AUDIO;
-        bool isMuted = index < static_cast<int>(props.muteStates.size())
-                           ? props.muteStates[index]
-                           : false;
-        bool isSoloed = index < static_cast<int>(props.soloStates.size())
-                            ? props.soloStates[index]
-                            : false;
+        bool isMuted = props.flags.muted(index);
+        bool isSoloed = props.flags.soloed(index);
 
         slot_items_[slotIndex]->render({
             .name = name,
@@ -283,12 +283,10 @@ void TrackSelector::applyHighlightStyle(int slotIndex, bool isSelected) {
     int logicalIndex = list_->getWindowStart() + slotIndex;
     const auto &props = current_props_;
 
-    const char *name = logicalIndex < static_cast<int>(props.names.size())
-                           ? props.names[logicalIndex].c_str()
-                           : "";
+    const char *name = props.names.c_str(logicalIndex);
 
     // Check if this is the back button
-    bool isBack = (logicalIndex == 0) && (std::string(name) == icons::UI_ARROW_LEFT);
+    bool isBack = (logicalIndex == 0) && (std::string_view(name) == icons::UI_ARROW_LEFT);
 
     if (isBack) {
         // Update back button highlight
@@ -305,12 +303,8 @@ void TrackSelector::applyHighlightStyle(int slotIndex, bool isSelected) {
         TrackType trackType = logicalIndex < static_cast<int>(props.trackTypes.size())
                                   ? props.trackTypes[logicalIndex]
                                   : TrackType::AUDIO;
-        bool isMuted = logicalIndex < static_cast<int>(props.muteStates.size())
-                           ? props.muteStates[logicalIndex]
-                           : false;
-        bool isSoloed = logicalIndex < static_cast<int>(props.soloStates.size())
-                            ? props.soloStates[logicalIndex]
-                            : false;
+        bool isMuted = props.flags.muted(logicalIndex);
+        bool isSoloed = props.flags.soloed(logicalIndex);
 
         slot_items_[slotIndex]->render({
             .name = name,
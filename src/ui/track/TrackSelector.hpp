@@ -29,6 +29,8 @@
 #include <oc/ui/lvgl/widget/VirtualList.hpp>
 
 #include "protocol/TrackType.hpp"
+#include "state/StringListView.hpp"
+#include "state/TrackFlags.hpp"
 #include "ui/widget/BackButton.hpp"
 #include "ui/widget/HintBar.hpp"
 
@@ -40,9 +42,8 @@ using oc::ui::lvgl::widget::VirtualSlot;
 using oc::ui::lvgl::widget::ScrollMode;
 
 struct TrackSelectorProps {
-    std::vector<std::string> names;
-    std::vector<bool> muteStates;
-    std::vector<bool> soloStates;
+    state::StringListView names;
+    state::TrackFlags flags;  // Mute/solo/arm, by display index
     std::vector<TrackType> trackTypes;
     std::vector<uint32_t> trackColors;
     int selectedIndex = 0;
@@ -64,6 +65,13 @@ public:
 
     void render(const TrackSelectorProps &props);
 
+    /**
+     * @brief Update track flags without a full render
+     * @param flags New flags of the whole list
+     * @param changed Display indices whose flags changed (only these rows rebind)
+     */
+    void updateFlags(const state::TrackFlags &flags, uint64_t changed);
+
     // IComponent
     void show() override;
     void hide() override;
@@ -0,0 +1,101 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../../src/protocol/Capture.hpp"
+
+namespace {
+
+using bitwig::capture::Direction;
+using bitwig::capture::Record;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void append(std::vector<uint8_t>& out, uint32_t timeMs, Direction direction, std::vector<uint8_t> frame) {
+    uint8_t header[bitwig::capture::RECORD_HEADER_SIZE];
+    bitwig::capture::writeRecordHeader(header, timeMs, direction, static_cast<uint16_t>(frame.size()));
+    out.insert(out.end(), header, header + sizeof(header));
+    out.insert(out.end(), frame.begin(), frame.end());
+}
+
+std::vector<uint8_t> capture() {
+    std::vector<uint8_t> out(bitwig::capture::MAGIC, bitwig::capture::MAGIC + sizeof(bitwig::capture::MAGIC));
+    append(out, 0, Direction::OUTBOUND, {0xC1});
+    append(out, 16, Direction::INBOUND, {0x85, 0x01, 0x02});
+    append(out, 0x01020304, Direction::INBOUND, std::vector<uint8_t>(300, 0xAB));
+    return out;
+}
+
+void test_records_round_trip() {
+    auto data = capture();
+    require(bitwig::capture::hasMagic(data.data(), data.size()), "capture should start with MAGIC");
+
+    const uint8_t* cursor = data.data() + sizeof(bitwig::capture::MAGIC);
+    const uint8_t* end = data.data() + data.size();
+    Record record;
+
+    require(bitwig::capture::readRecord(cursor, end, record), "first record should parse");
+    require(record.timeMs == 0 && record.direction == Direction::OUTBOUND && record.len == 1,
+            "first record header mismatch");
+    require(record.data[0] == 0xC1, "first record payload mismatch");
+
+    require(bitwig::capture::readRecord(cursor, end, record), "second record should parse");
+    require(record.timeMs == 16 && record.direction == Direction::INBOUND && record.len == 3,
+            "second record header mismatch");
+    require(record.data[0] == 0x85 && record.data[2] == 0x02, "second record payload mismatch");
+
+    require(bitwig::capture::readRecord(cursor, end, record), "third record should parse");
+    require(record.timeMs == 0x01020304 && record.len == 300, "wide timestamp and length should survive");
+
+    require(!bitwig::capture::readRecord(cursor, end, record), "end of capture should stop reading");
+    require(cursor == end, "cursor should stop at the end");
+
+    std::cout << "[PASS] test_records_round_trip\n";
+}
+
+void test_truncated_record_is_rejected() {
+    auto data = capture();
+    data.pop_back();
+
+    const uint8_t* cursor = data.data() + sizeof(bitwig::capture::MAGIC);
+    const uint8_t* end = data.data() + data.size();
+    Record record;
+    require(bitwig::capture::readRecord(cursor, end, record), "intact record should parse");
+    require(bitwig::capture::readRecord(cursor, end, record), "intact record should parse");
+
+    const uint8_t* before = cursor;
+    require(!bitwig::capture::readRecord(cursor, end, record), "truncated record should be rejected");
+    require(cursor == before, "cursor should not move on a truncated record");
+
+    std::cout << "[PASS] test_truncated_record_is_rejected\n";
+}
+
+void test_magic_check() {
+    const uint8_t bad[] = {'M', 'S', 'C', 'A', 'P', '0', '0', '\n'};
+    require(!bitwig::capture::hasMagic(bad, sizeof(bad)), "wrong version should be rejected");
+    require(!bitwig::capture::hasMagic(bitwig::capture::MAGIC, 4), "short buffer should be rejected");
+
+    std::cout << "[PASS] test_magic_check\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_records_round_trip();
+        test_truncated_record_is_rejected();
+        test_magic_check();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All Capture tests passed\n";
+    return 0;
+}
@@ -0,0 +1,210 @@
+#include <bitset>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../../src/protocol/DecoderRegistry.hpp"
+
+namespace {
+
+using Protocol::DecoderRegistry;
+using Protocol::DispatchResult;
+using Protocol::MessageID;
+using namespace Protocol;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+struct Callbacks : Protocol::ProtocolCallbacks {};
+
+void test_unhandled_messages_are_not_decoded() {
+    Callbacks callbacks;
+    for (uint8_t id = 0; id < Protocol::MESSAGE_COUNT; ++id) {
+        // Empty payload would fail every non-empty decoder: UNHANDLED proves it was skipped
+        DispatchResult result = DecoderRegistry::dispatch(callbacks, static_cast<MessageID>(id), nullptr, 0);
+        require(result == DispatchResult::UNHANDLED, "message without callback should be unhandled");
+    }
+
+    std::cout << "[PASS] test_unhandled_messages_are_not_decoded\n";
+}
+
+void test_table_routes_each_id_to_its_callback() {
+    Callbacks callbacks;
+    int batches = 0;
+    int tempos = 0;
+    callbacks.onDeviceRemoteControlsBatch = [&](const Protocol::DeviceRemoteControlsBatchMessage&) { ++batches; };
+    callbacks.onTransportTempoState = [&](const Protocol::TransportTempoStateMessage& msg) {
+        require(msg.tempo == 120.0f, "tempo should be decoded");
+        ++tempos;
+    };
+
+    uint8_t payload[Protocol::TransportTempoStateMessage::MAX_PAYLOAD_SIZE];
+    uint16_t len = Protocol::TransportTempoStateMessage{120.0f}.encode(payload, sizeof(payload));
+
+    require(DecoderRegistry::dispatch(callbacks, MessageID::TRANSPORT_TEMPO_STATE, payload, len) == DispatchResult::HANDLED,
+            "registered callback should be handled");
+    require(tempos == 1 && batches == 0, "only the matching callback should fire");
+    require(DecoderRegistry::dispatch(callbacks, MessageID::DEVICE_REMOTE_CONTROLS_BATCH, payload, 1) ==
+                DispatchResult::DECODE_FAILED,
+            "short payload should fail to decode");
+    require(batches == 0, "failed decode should not reach the callback");
+
+    std::cout << "[PASS] test_table_routes_each_id_to_its_callback\n";
+}
+
+// Dispatch a default T under its own ID: only the callback named here may fire
+template <typename T, InlineCallback<void(const T&)> ProtocolCallbacks::*Callback>
+void check(std::bitset<Protocol::MESSAGE_COUNT>& seen) {
+    Callbacks callbacks;
+    int fired = 0;
+    callbacks.*Callback = [&fired](const T&) { ++fired; };
+
+    std::vector<uint8_t> payload(T::MAX_PAYLOAD_SIZE);
+    uint16_t len = T{}.encode(payload.data(), static_cast<uint16_t>(payload.size()));
+
+    uint8_t id = static_cast<uint8_t>(T::MESSAGE_ID);
+    DispatchResult result =
+        DecoderRegistry::dispatch(callbacks, T::MESSAGE_ID, payload.data(), len);
+    require(result == DispatchResult::HANDLED, T::MESSAGE_NAME);
+    require(fired == 1, T::MESSAGE_NAME);
+    require(!seen.test(id), "message id checked twice");
+    seen.set(id);
+}
+
+void test_every_id_fires_its_own_callback() {
+    std::bitset<Protocol::MESSAGE_COUNT> seen;
+        check<DeviceChainStampMessage, &ProtocolCallbacks::onDeviceChainStamp>(seen);
+        check<DeviceChangeMessage, &ProtocolCallbacks::onDeviceChange>(seen);
+        check<DeviceChangeHeaderMessage, &ProtocolCallbacks::onDeviceChangeHeader>(seen);
+        check<DeviceChildrenMessage, &ProtocolCallbacks::onDeviceChildren>(seen);
+        check<DeviceEnabledStateMessage, &ProtocolCallbacks::onDeviceEnabledState>(seen);
+        check<DeviceListWindowMessage, &ProtocolCallbacks::onDeviceListWindow>(seen);
+        check<DevicePageChangeMessage, &ProtocolCallbacks::onDevicePageChange>(seen);
+        check<DevicePageNamesWindowMessage, &ProtocolCallbacks::onDevicePageNamesWindow>(seen);
+        check<DevicePageSelectMessage, &ProtocolCallbacks::onDevicePageSelect>(seen);
+        check<DeviceRemoteControlsBatchMessage, &ProtocolCallbacks::onDeviceRemoteControlsBatch>(seen);
+        check<DeviceRemoteControlDiscreteValuesMessage, &ProtocolCallbacks::onDeviceRemoteControlDiscreteValues>(seen);
+        check<DeviceRemoteControlHasAutomationChangeMessage, &ProtocolCallbacks::onDeviceRemoteControlHasAutomationChange>(seen);
+        check<DeviceRemoteControlIsModulatedChangeMessage, &ProtocolCallbacks::onDeviceRemoteControlIsModulatedChange>(seen);
+        check<DeviceRemoteControlNameChangeMessage, &ProtocolCallbacks::onDeviceRemoteControlNameChange>(seen);
+        check<DeviceRemoteControlOriginChangeMessage, &ProtocolCallbacks::onDeviceRemoteControlOriginChange>(seen);
+        check<DeviceRemoteControlRestoreAutomationMessage, &ProtocolCallbacks::onDeviceRemoteControlRestoreAutomation>(seen);
+        check<DeviceRemoteControlTouchMessage, &ProtocolCallbacks::onDeviceRemoteControlTouch>(seen);
+        check<DeviceRemoteControlUpdateMessage, &ProtocolCallbacks::onDeviceRemoteControlUpdate>(seen);
+        check<DeviceSelectMessage, &ProtocolCallbacks::onDeviceSelect>(seen);
+        check<DeviceStateMessage, &ProtocolCallbacks::onDeviceState>(seen);
+        check<EnterDeviceChildMessage, &ProtocolCallbacks::onEnterDeviceChild>(seen);
+        check<EnterTrackGroupMessage, &ProtocolCallbacks::onEnterTrackGroup>(seen);
+        check<ExitToParentMessage, &ProtocolCallbacks::onExitToParent>(seen);
+        check<ExitTrackGroupMessage, &ProtocolCallbacks::onExitTrackGroup>(seen);
+        check<FlowCreditMessage, &ProtocolCallbacks::onFlowCredit>(seen);
+        check<HostDeactivatedMessage, &ProtocolCallbacks::onHostDeactivated>(seen);
+        check<HostInitializedMessage, &ProtocolCallbacks::onHostInitialized>(seen);
+        check<LastClickedTouchMessage, &ProtocolCallbacks::onLastClickedTouch>(seen);
+        check<LastClickedUpdateMessage, &ProtocolCallbacks::onLastClickedUpdate>(seen);
+        check<LastClickedValueMessage, &ProtocolCallbacks::onLastClickedValue>(seen);
+        check<LastClickedValueStateMessage, &ProtocolCallbacks::onLastClickedValueState>(seen);
+        check<RemoteControlValueMessage, &ProtocolCallbacks::onRemoteControlValue>(seen);
+        check<RemoteControlValueStateMessage, &ProtocolCallbacks::onRemoteControlValueState>(seen);
+        check<RenderStatsMessage, &ProtocolCallbacks::onRenderStats>(seen);
+        check<RequestDeviceChildrenMessage, &ProtocolCallbacks::onRequestDeviceChildren>(seen);
+        check<RequestDeviceListWindowMessage, &ProtocolCallbacks::onRequestDeviceListWindow>(seen);
+        check<RequestDevicePageNamesWindowMessage, &ProtocolCallbacks::onRequestDevicePageNamesWindow>(seen);
+        check<RequestHostStatusMessage, &ProtocolCallbacks::onRequestHostStatus>(seen);
+        check<RequestSendDestinationsMessage, &ProtocolCallbacks::onRequestSendDestinations>(seen);
+        check<RequestTrackListWindowMessage, &ProtocolCallbacks::onRequestTrackListWindow>(seen);
+        check<RequestTrackSendListMessage, &ProtocolCallbacks::onRequestTrackSendList>(seen);
+        check<ResetAutomationOverridesMessage, &ProtocolCallbacks::onResetAutomationOverrides>(seen);
+        check<SelectMixSendMessage, &ProtocolCallbacks::onSelectMixSend>(seen);
+        check<SendDestinationsListMessage, &ProtocolCallbacks::onSendDestinationsList>(seen);
+        check<StringDefineMessage, &ProtocolCallbacks::onStringDefine>(seen);
+        check<StringMissMessage, &ProtocolCallbacks::onStringMiss>(seen);
+        check<TrackActivateMessage, &ProtocolCallbacks::onTrackActivate>(seen);
+        check<TrackArmMessage, &ProtocolCallbacks::onTrackArm>(seen);
+        check<TrackArmStateMessage, &ProtocolCallbacks::onTrackArmState>(seen);
+        check<TrackChangeMessage, &ProtocolCallbacks::onTrackChange>(seen);
+        check<TrackListWindowMessage, &ProtocolCallbacks::onTrackListWindow>(seen);
+        check<TrackMuteMessage, &ProtocolCallbacks::onTrackMute>(seen);
+        check<TrackMutedBySoloStateMessage, &ProtocolCallbacks::onTrackMutedBySoloState>(seen);
+        check<TrackMuteStateMessage, &ProtocolCallbacks::onTrackMuteState>(seen);
+        check<TrackPanMessage, &ProtocolCallbacks::onTrackPan>(seen);
+        check<TrackPanHasAutomationStateMessage, &ProtocolCallbacks::onTrackPanHasAutomationState>(seen);
+        check<TrackPanModulatedValueStateMessage, &ProtocolCallbacks::onTrackPanModulatedValueState>(seen);
+        check<TrackPanStateMessage, &ProtocolCallbacks::onTrackPanState>(seen);
+        check<TrackPanTouchMessage, &ProtocolCallbacks::onTrackPanTouch>(seen);
+        check<TrackSelectMessage, &ProtocolCallbacks::onTrackSelect>(seen);
+        check<TrackSendEnabledMessage, &ProtocolCallbacks::onTrackSendEnabled>(seen);
+        check<TrackSendEnabledStateMessage, &ProtocolCallbacks::onTrackSendEnabledState>(seen);
+        check<TrackSendHasAutomationStateMessage, &ProtocolCallbacks::onTrackSendHasAutomationState>(seen);
+        check<TrackSendListMessage, &ProtocolCallbacks::onTrackSendList>(seen);
+        check<TrackSendModeMessage, &ProtocolCallbacks::onTrackSendMode>(seen);
+        check<TrackSendModeStateMessage, &ProtocolCallbacks::onTrackSendModeState>(seen);
+        check<TrackSendModulatedValueStateMessage, &ProtocolCallbacks::onTrackSendModulatedValueState>(seen);
+        check<TrackSendPreFaderStateMessage, &ProtocolCallbacks::onTrackSendPreFaderState>(seen);
+        check<TrackSendTouchMessage, &ProtocolCallbacks::onTrackSendTouch>(seen);
+        check<TrackSendValueMessage, &ProtocolCallbacks::onTrackSendValue>(seen);
+        check<TrackSendValueStateMessage, &ProtocolCallbacks::onTrackSendValueState>(seen);
+        check<TrackSoloMessage, &ProtocolCallbacks::onTrackSolo>(seen);
+        check<TrackSoloStateMessage, &ProtocolCallbacks::onTrackSoloState>(seen);
+        check<TrackVolumeMessage, &ProtocolCallbacks::onTrackVolume>(seen);
+        check<TrackVolumeHasAutomationStateMessage, &ProtocolCallbacks::onTrackVolumeHasAutomationState>(seen);
+        check<TrackVolumeModulatedValueStateMessage, &ProtocolCallbacks::onTrackVolumeModulatedValueState>(seen);
+        check<TrackVolumeStateMessage, &ProtocolCallbacks::onTrackVolumeState>(seen);
+        check<TrackVolumeTouchMessage, &ProtocolCallbacks::onTrackVolumeTouch>(seen);
+        check<TransportArrangerAutomationWriteEnabledMessage, &ProtocolCallbacks::onTransportArrangerAutomationWriteEnabled>(seen);
+        check<TransportArrangerAutomationWriteEnabledStateMessage, &ProtocolCallbacks::onTransportArrangerAutomationWriteEnabledState>(seen);
+        check<TransportArrangerOverdubEnabledMessage, &ProtocolCallbacks::onTransportArrangerOverdubEnabled>(seen);
+        check<TransportArrangerOverdubEnabledStateMessage, &ProtocolCallbacks::onTransportArrangerOverdubEnabledState>(seen);
+        check<TransportAutomationOverrideActiveStateMessage, &ProtocolCallbacks::onTransportAutomationOverrideActiveState>(seen);
+        check<TransportAutomationWriteModeMessage, &ProtocolCallbacks::onTransportAutomationWriteMode>(seen);
+        check<TransportAutomationWriteModeStateMessage, &ProtocolCallbacks::onTransportAutomationWriteModeState>(seen);
+        check<TransportClipLauncherAutomationWriteEnabledMessage, &ProtocolCallbacks::onTransportClipLauncherAutomationWriteEnabled>(seen);
+        check<TransportClipLauncherAutomationWriteEnabledStateMessage, &ProtocolCallbacks::onTransportClipLauncherAutomationWriteEnabledState>(seen);
+        check<TransportClipLauncherOverdubEnabledMessage, &ProtocolCallbacks::onTransportClipLauncherOverdubEnabled>(seen);
+        check<TransportClipLauncherOverdubEnabledStateMessage, &ProtocolCallbacks::onTransportClipLauncherOverdubEnabledState>(seen);
+        check<TransportPlayMessage, &ProtocolCallbacks::onTransportPlay>(seen);
+        check<TransportPlayingStateMessage, &ProtocolCallbacks::onTransportPlayingState>(seen);
+        check<TransportRecordMessage, &ProtocolCallbacks::onTransportRecord>(seen);
+        check<TransportRecordingStateMessage, &ProtocolCallbacks::onTransportRecordingState>(seen);
+        check<TransportStopMessage, &ProtocolCallbacks::onTransportStop>(seen);
+        check<TransportTempoMessage, &ProtocolCallbacks::onTransportTempo>(seen);
+        check<TransportTempoStateMessage, &ProtocolCallbacks::onTransportTempoState>(seen);
+        check<ViewStateMessage, &ProtocolCallbacks::onViewState>(seen);
+
+    require(seen.all(), "every message id should be checked");
+
+    std::cout << "[PASS] test_every_id_fires_its_own_callback\n";
+}
+
+void test_unknown_ids_are_reported() {
+    Callbacks callbacks;
+    require(DecoderRegistry::dispatch(callbacks, static_cast<MessageID>(Protocol::MESSAGE_COUNT), nullptr, 0) ==
+                DispatchResult::UNKNOWN_ID,
+            "first id past the table should be unknown");
+    require(DecoderRegistry::dispatch(callbacks, static_cast<MessageID>(0x7F), nullptr, 0) == DispatchResult::UNKNOWN_ID,
+            "reserved id should be unknown");
+
+    std::cout << "[PASS] test_unknown_ids_are_reported\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_unhandled_messages_are_not_decoded();
+        test_table_routes_each_id_to_its_callback();
+        test_every_id_fires_its_own_callback();
+        test_unknown_ids_are_reported();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All DecoderRegistry tests passed\n";
+    return 0;
+}
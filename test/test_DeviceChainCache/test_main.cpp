@@ -0,0 +1,121 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../src/state/DeviceChainCache.hpp"
+
+namespace {
+
+using bitwig::state::DeviceChainCache;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+struct Restored {
+    std::vector<std::string> names;
+    std::vector<bool> enabled;
+    std::vector<uint8_t> flags;
+};
+
+Restored restore(const DeviceChainCache& cache) {
+    Restored out;
+    cache.restore([&out](uint8_t index, const DeviceChainCache::Device& dev) {
+        require(index == out.names.size(), "devices should be restored in order");
+        out.names.emplace_back(dev.name);
+        out.enabled.push_back(dev.isEnabled);
+        out.flags.push_back(dev.childFlags);
+    });
+    return out;
+}
+
+void visit(DeviceChainCache& cache, uint32_t identity, uint32_t stamp, const std::vector<std::string>& names) {
+    if (cache.activate(identity, stamp)) return;
+    for (size_t i = 0; i < names.size(); ++i) {
+        cache.put(static_cast<uint8_t>(i), {names[i], DeviceType::AUDIO_EFFECT, true, 0});
+    }
+}
+
+void test_revisit_restores_chain() {
+    DeviceChainCache cache;
+    cache.activate(1, 10);
+    cache.put(0, {"Polysynth", DeviceType::INSTRUMENT, true, 0});
+    cache.put(1, {"FX Layer", DeviceType::AUDIO_EFFECT, false, 2});
+    visit(cache, 2, 20, {"EQ+"});
+
+    require(cache.activate(1, 10), "revisited chain with the same stamp should hit");
+    Restored restored = restore(cache);
+    require(restored.names == std::vector<std::string>({"Polysynth", "FX Layer"}), "names should be restored");
+    require(restored.enabled[0] && !restored.enabled[1], "enabled states should be restored");
+    require(restored.flags[1] == 2, "child flags should be restored");
+
+    std::cout << "[PASS] test_revisit_restores_chain\n";
+}
+
+void test_new_stamp_refetches() {
+    DeviceChainCache cache;
+    visit(cache, 1, 10, {"EQ+", "Compressor"});
+
+    require(!cache.activate(1, 11), "a changed chain should miss");
+    require(cache.stats().stale == 1, "the miss should be counted as stale");
+    require(restore(cache).names.empty(), "a stale entry should start empty");
+
+    std::cout << "[PASS] test_new_stamp_refetches\n";
+}
+
+void test_enabled_updates_active_chain() {
+    DeviceChainCache cache;
+    visit(cache, 1, 10, {"EQ+", "Compressor"});
+    cache.setEnabled(1, false);
+    cache.setEnabled(5, false);  // Not cached: ignored
+
+    require(!restore(cache).enabled[1], "enabled change should reach the active entry");
+
+    std::cout << "[PASS] test_enabled_updates_active_chain\n";
+}
+
+void test_lru_and_limits() {
+    DeviceChainCache cache;
+    for (uint32_t id = 1; id <= DeviceChainCache::CAPACITY; ++id) visit(cache, id, id, {"Device"});
+    require(cache.activate(1, 1), "first chain should still be cached");
+    visit(cache, 99, 99, {"Device"});
+    require(!cache.activate(2, 2), "least recently announced chain should be evicted");
+
+    const std::string longName(100, 'x');
+    cache.activate(50, 50);
+    cache.put(0, {"A", DeviceType::UNKNOWN, true, 0});
+    cache.put(2, {"C", DeviceType::UNKNOWN, true, 0});  // Gap: not recorded
+    for (uint8_t i = 1; i < 20; ++i) cache.put(i, {longName, DeviceType::UNKNOWN, true, 0});
+    cache.activate(50, 50);
+    size_t expected = 1 + (DeviceChainCache::TEXT_BYTES - 2) / (longName.size() + 1);
+    require(restore(cache).names.size() == expected, "devices beyond the text budget should be dropped");
+
+    require(!cache.activate(0, 0), "identity 0 should not be cached");
+    cache.clear();
+    require(!cache.activate(1, 1), "clear should drop every chain");
+
+    std::cout << "[PASS] test_lru_and_limits\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_revisit_restores_chain();
+        test_new_stamp_refetches();
+        test_enabled_updates_active_chain();
+        test_lru_and_limits();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All DeviceChainCache tests passed\n";
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../../src/state/DeviceFlags.hpp"
+
+namespace {
+
+using namespace bitwig::state;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void test_set_and_read_back() {
+    DeviceFlags flags;
+    require(flags.size() == 0 && flags.at(0) == 0, "new flags should be empty");
+
+    uint64_t changed = flags.set(3, DEVICE_FLAG_ENABLED | DEVICE_FLAG_LAYERS);
+    require(changed == (uint64_t{1} << 3), "changed mask should name the device");
+    require(flags.size() == 4, "set past the end should grow the list");
+    require(flags.enabled(3) && flags.hasChildren(3), "flags should read back");
+    require(!flags.enabled(2) && !flags.hasChildren(2), "other devices should be untouched");
+    require(flags.at(3) == (DEVICE_FLAG_ENABLED | DEVICE_FLAG_LAYERS),
+            "flags byte should round trip");
+
+    require(flags.set(3, DEVICE_FLAG_ENABLED | DEVICE_FLAG_LAYERS) == 0,
+            "same flags should not count as a change");
+    require(flags.set(64, DEVICE_FLAG_ENABLED) == 0, "index beyond capacity should be ignored");
+
+    std::cout << "[PASS] test_set_and_read_back\n";
+}
+
+void test_child_type_bits_go_in_unchanged() {
+    DeviceFlags flags;
+    flags.set(0, CHILD_TYPE_SLOTS | CHILD_TYPE_DRUMS);
+    require(flags.at(0) == (DEVICE_FLAG_SLOTS | DEVICE_FLAG_DRUMS),
+            "child type bits should be device flags");
+    require(flags.mask(DEVICE_FLAG_DRUMS) == 1 && flags.mask(DEVICE_FLAG_LAYERS) == 0,
+            "masks should hold one bit per device");
+
+    std::cout << "[PASS] test_child_type_bits_go_in_unchanged\n";
+}
+
+void test_set_flag_toggles_one_bit() {
+    DeviceFlags flags;
+    flags.set(5, DEVICE_FLAG_SLOTS);
+    require(flags.setFlag(5, DEVICE_FLAG_ENABLED, true) == (uint64_t{1} << 5),
+            "enabling should change the device");
+    require(flags.at(5) == (DEVICE_FLAG_SLOTS | DEVICE_FLAG_ENABLED), "other flags should be kept");
+    require(flags.setFlag(5, DEVICE_FLAG_ENABLED, true) == 0, "no change when already enabled");
+    require(flags.setFlag(9, DEVICE_FLAG_ENABLED, true) == 0, "unknown device should be ignored");
+
+    std::cout << "[PASS] test_set_flag_toggles_one_bit\n";
+}
+
+void test_resize_drops_tail() {
+    DeviceFlags flags;
+    for (size_t i = 0; i < DeviceFlags::CAPACITY; ++i) flags.set(i, DEVICE_FLAG_ENABLED);
+    require(flags.size() == 64 && flags.enabled(63), "last bit of the mask should be usable");
+
+    uint64_t dropped = flags.resize(2);
+    require(dropped == ~uint64_t{3}, "resize should report the dropped devices");
+    require(flags.size() == 2 && flags.enabled(1) && !flags.enabled(2),
+            "kept devices should keep their flags");
+
+    flags.resize(8);
+    require(flags.at(7) == 0, "grown devices should start cleared");
+    require(flags.clear() == 3 && flags.size() == 0, "clear should drop everything");
+
+    std::cout << "[PASS] test_resize_drops_tail\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_set_and_read_back();
+        test_child_type_bits_go_in_unchanged();
+        test_set_flag_toggles_one_bit();
+        test_resize_drops_tail();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All DeviceFlags tests passed\n";
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../../src/app/FrameBudget.hpp"
+
+namespace {
+
+using bitwig::app::FrameBudget;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void test_first_call_opens_window() {
+    FrameBudget budget;
+    budget.setLoopPeriodUs(1000);
+    budget.recordLoop(500, true);
+
+    FrameBudget::Report report{};
+    require(!budget.report(5000, report), "first call should only start the window");
+    require(!budget.report(5999, report), "window should stay open before the interval");
+
+    std::cout << "[PASS] test_first_call_opens_window\n";
+}
+
+void test_report_averages_window() {
+    FrameBudget budget;
+    budget.setLoopPeriodUs(1000);
+    FrameBudget::Report report{};
+    budget.report(0, report);
+
+    // 1000 loops at 1 kHz, every 16th one refreshing the display
+    for (int i = 0; i < 1000; ++i) {
+        budget.recordLoop(i % 2 == 0 ? 200 : 400, i % 16 == 0);
+    }
+    require(budget.report(1000, report), "window should close after the interval");
+    require(report.renderHz == 63, "render rate should count refreshes per second");
+    require(report.frameTimeUs == 300, "frame time should be the average busy time");
+    require(report.headroomPercent == 70, "headroom should be the idle share of the period");
+
+    require(!budget.report(2000, report), "an empty window should not produce a report");
+
+    std::cout << "[PASS] test_report_averages_window\n";
+}
+
+void test_overloaded_loop_has_no_headroom() {
+    FrameBudget budget;
+    budget.setLoopPeriodUs(1000);
+    FrameBudget::Report report{};
+    budget.report(0, report);
+
+    budget.recordLoop(2500, true);
+    require(budget.report(1000, report), "window should close after the interval");
+    require(report.headroomPercent == 0, "loops longer than the period should clamp to zero headroom");
+    require(report.frameTimeUs == 2500, "frame time should report the overrun");
+
+    std::cout << "[PASS] test_overloaded_loop_has_no_headroom\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_first_call_opens_window();
+        test_report_averages_window();
+        test_overloaded_loop_has_no_headroom();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All FrameBudget tests passed\n";
+    return 0;
+}
@@ -0,0 +1,180 @@
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../../src/protocol/Envelope.hpp"
+#include "../../src/protocol/Framing.hpp"
+#include "../../src/protocol/MessageStructure.hpp"
+
+namespace {
+
+using Protocol::MessageID;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+template <typename T>
+size_t buildFrame(uint8_t* frame, const T& message, bool compact) {
+    size_t offset = bitwig::framing::writeHeader(frame, T::MESSAGE_ID, compact);
+    offset += message.encode(frame + offset, static_cast<uint16_t>(Protocol::MAX_MESSAGE_SIZE - offset));
+    return offset;
+}
+
+void test_named_frame_carries_message_name() {
+    uint8_t frame[64];
+    size_t len = buildFrame(frame, Protocol::TransportPlayMessage{true}, false);
+
+    require(frame[0] == static_cast<uint8_t>(MessageID::TRANSPORT_PLAY), "named frame should start with the raw MessageID");
+    require(frame[1] == std::strlen("TransportPlay"), "named frame should carry the name length");
+    require(std::memcmp(frame + 2, "TransportPlay", frame[1]) == 0, "named frame should carry the name");
+    require(len == 2u + frame[1] + 1u, "named frame should be header + 1 byte payload");
+
+    std::cout << "[PASS] test_named_frame_carries_message_name\n";
+}
+
+void test_compact_frame_drops_message_name() {
+    uint8_t frame[64];
+    size_t len = buildFrame(frame, Protocol::TransportPlayMessage{true}, true);
+
+    require(frame[0] == (static_cast<uint8_t>(MessageID::TRANSPORT_PLAY) | Protocol::COMPACT_FRAME_FLAG),
+            "compact frame should flag the MessageID byte");
+    require(len == 2, "compact frame should be MessageID + 1 byte payload");
+
+    std::cout << "[PASS] test_compact_frame_drops_message_name\n";
+}
+
+void test_parse_accepts_both_forms() {
+    for (bool compact : {false, true}) {
+        uint8_t frame[Protocol::MAX_MESSAGE_SIZE];
+        size_t len = buildFrame(frame, Protocol::TrackVolumeStateMessage{5, 0.5f, "-6 dB"}, compact);
+
+        bitwig::framing::Frame parsed{};
+        require(bitwig::framing::parse(frame, len, parsed), "frame should parse");
+        require(parsed.id == MessageID::TRACK_VOLUME_STATE, "parsed id should match");
+        require(parsed.compact == compact, "parsed form should match");
+
+        auto decoded = Protocol::TrackVolumeStateMessage::decode(parsed.payload, parsed.payloadLen);
+        require(decoded.has_value(), "payload should decode");
+        require(decoded->trackIndex == 5, "trackIndex should round-trip");
+        require(decoded->volumeDisplay == "-6 dB", "volumeDisplay should round-trip");
+    }
+
+    std::cout << "[PASS] test_parse_accepts_both_forms\n";
+}
+
+void test_parse_rejects_truncated_name_prefix() {
+    const uint8_t frame[] = {static_cast<uint8_t>(MessageID::TRANSPORT_PLAY), 13, 'T', 'r'};
+    bitwig::framing::Frame parsed{};
+
+    require(!bitwig::framing::parse(frame, sizeof(frame), parsed), "truncated name prefix should be rejected");
+    require(!bitwig::framing::parse(nullptr, 0, parsed), "null frame should be rejected");
+
+    std::cout << "[PASS] test_parse_rejects_truncated_name_prefix\n";
+}
+
+void test_message_names_match_structs() {
+    require(std::strcmp(Protocol::messageName(MessageID::DEVICE_REMOTE_CONTROLS_BATCH),
+                        Protocol::DeviceRemoteControlsBatchMessage::MESSAGE_NAME) == 0,
+            "name table should match struct MESSAGE_NAME");
+    require(std::strcmp(Protocol::messageName(MessageID::VIEW_STATE),
+                        Protocol::ViewStateMessage::MESSAGE_NAME) == 0,
+            "last table entry should match struct MESSAGE_NAME");
+    require(Protocol::messageName(static_cast<MessageID>(0x7F)) == nullptr, "unknown id should have no name");
+
+    std::cout << "[PASS] test_message_names_match_structs\n";
+}
+
+template <typename T>
+void appendRecord(bitwig::framing::Envelope& envelope, const T& message) {
+    uint8_t* record = envelope.reserve(1 + T::MAX_PAYLOAD_SIZE);
+    require(record != nullptr, "record should fit in the envelope");
+    size_t len = bitwig::framing::writeHeader(record, T::MESSAGE_ID, true);
+    len += message.encode(record + len, T::MAX_PAYLOAD_SIZE);
+    envelope.commit(len);
+}
+
+void test_envelope_packs_records_in_order() {
+    bitwig::framing::Envelope envelope;
+    for (uint8_t i = 0; i < 8; ++i) {
+        appendRecord(envelope, Protocol::DeviceRemoteControlIsModulatedChangeMessage{i, (i & 1) != 0});
+    }
+
+    const uint8_t* frame = envelope.frame();
+    size_t len = envelope.frameSize();
+    require(bitwig::framing::isEnvelope(frame, len), "several records should be sent as an envelope");
+    require(len == 1 + 8 * (1 + 3), "envelope should be type byte + 8 x [len][id][index][flag]");
+
+    uint8_t expected = 0;
+    bool complete = bitwig::framing::forEachRecord(frame, len, [&](const uint8_t* record, size_t recordLen) {
+        bitwig::framing::Frame parsed{};
+        require(bitwig::framing::parse(record, recordLen, parsed) && parsed.compact, "record should be a compact frame");
+        require(parsed.id == MessageID::DEVICE_REMOTE_CONTROL_IS_MODULATED_CHANGE, "record id should match");
+        auto decoded = Protocol::DeviceRemoteControlIsModulatedChangeMessage::decode(parsed.payload, parsed.payloadLen);
+        require(decoded.has_value() && decoded->remoteControlIndex == expected, "records should keep send order");
+        ++expected;
+    });
+    require(complete && expected == 8, "all records should be visited");
+
+    std::cout << "[PASS] test_envelope_packs_records_in_order\n";
+}
+
+void test_envelope_single_record_is_plain_frame() {
+    bitwig::framing::Envelope envelope;
+    appendRecord(envelope, Protocol::TransportPlayMessage{true});
+
+    require(!bitwig::framing::isEnvelope(envelope.frame(), envelope.frameSize()), "lone record should not be wrapped");
+    require(envelope.frameSize() == 2, "lone record should be a plain compact frame");
+    require(envelope.frame()[0] == (static_cast<uint8_t>(MessageID::TRANSPORT_PLAY) | Protocol::COMPACT_FRAME_FLAG),
+            "lone record should start with the flagged MessageID");
+
+    envelope.clear();
+    require(envelope.empty(), "clear should drop queued records");
+
+    std::cout << "[PASS] test_envelope_single_record_is_plain_frame\n";
+}
+
+void test_envelope_rejects_overflow_and_truncation() {
+    bitwig::framing::Envelope envelope;
+    size_t appended = 0;
+    while (uint8_t* record = envelope.reserve(Protocol::MAX_ENVELOPE_RECORD_SIZE)) {
+        record[0] = static_cast<uint8_t>(MessageID::TRANSPORT_PLAY) | Protocol::COMPACT_FRAME_FLAG;
+        envelope.commit(Protocol::MAX_ENVELOPE_RECORD_SIZE);
+        ++appended;
+    }
+    require(appended == (Protocol::MAX_ENVELOPE_SIZE - 1u) / (1u + Protocol::MAX_ENVELOPE_RECORD_SIZE),
+            "reserve should stop at the envelope capacity");
+
+    const uint8_t truncated[] = {Protocol::ENVELOPE_MESSAGE_ID | Protocol::COMPACT_FRAME_FLAG, 5, 0x81};
+    size_t visited = 0;
+    require(!bitwig::framing::forEachRecord(truncated, sizeof(truncated), [&](const uint8_t*, size_t) { ++visited; }),
+            "overrunning record should be rejected");
+    require(visited == 0, "overrunning record should not be delivered");
+
+    std::cout << "[PASS] test_envelope_rejects_overflow_and_truncation\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_named_frame_carries_message_name();
+        test_compact_frame_drops_message_name();
+        test_parse_accepts_both_forms();
+        test_parse_rejects_truncated_name_prefix();
+        test_message_names_match_structs();
+        test_envelope_packs_records_in_order();
+        test_envelope_single_record_is_plain_frame();
+        test_envelope_rejects_overflow_and_truncation();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All Framing tests passed\n";
+    return 0;
+}
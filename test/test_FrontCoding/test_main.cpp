@@ -0,0 +1,116 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "../../src/protocol/FrontCoding.hpp"
+#include "../../src/protocol/MessageStructure.hpp"
+
+namespace {
+
+using bitwig::frontcoding::NameDecoder;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void test_round_trip() {
+    const std::string_view names[] = {"Osc 1 Pitch", "Osc 1 Shape", "Osc 2 Pitch", "Filter", "Filter Env"};
+    std::string_view suffixes[5];
+    uint8_t prefixes[5];
+    int saved = bitwig::frontcoding::encode(names, 5, suffixes, prefixes);
+
+    require(prefixes[0] == 0 && prefixes[1] == 6 && prefixes[2] == 4, "prefixes should follow the previous name");
+    require(suffixes[1] == "Shape" && suffixes[4] == " Env", "suffixes should drop the shared prefix");
+    require(saved == 6 + 4 + 6 - 5, "savings should be net of one prefix byte per name");
+
+    NameDecoder decoder(prefixes, 5);
+    for (size_t i = 0; i < 5; ++i) {
+        require(decoder.next(suffixes[i]) == names[i], "decoded name should match the original");
+    }
+
+    std::cout << "[PASS] test_round_trip\n";
+}
+
+void test_duplicates_keep_a_suffix() {
+    const std::string_view names[] = {"Bus", "Bus", "Bus"};
+    std::string_view suffixes[3];
+    uint8_t prefixes[3];
+    bitwig::frontcoding::encode(names, 3, suffixes, prefixes);
+
+    require(suffixes[1] == "s" && suffixes[2] == "s", "a repeated name should keep one character");
+
+    NameDecoder decoder(prefixes, 3);
+    for (size_t i = 0; i < 3; ++i) {
+        require(decoder.next(suffixes[i]) == "Bus", "repeated names should decode whole");
+    }
+
+    std::cout << "[PASS] test_duplicates_keep_a_suffix\n";
+}
+
+void test_plain_window_passes_through() {
+    NameDecoder decoder(nullptr, 0);
+    std::string_view name = "Synth Bus 1";
+    require(decoder.next(name).data() == name.data(), "plain names should be returned as is");
+
+    std::cout << "[PASS] test_plain_window_passes_through\n";
+}
+
+void test_oversized_prefix_is_clamped() {
+    const uint8_t prefixes[] = {200, 50};
+    NameDecoder decoder(prefixes, 2);
+    require(decoder.next("Kick") == "Kick", "first prefix has no previous name to take from");
+    require(decoder.next(" 2") == "Kick 2", "prefix should be clamped to the previous name");
+
+    std::cout << "[PASS] test_oversized_prefix_is_clamped\n";
+}
+
+void test_message_round_trip() {
+    const std::string_view names[] = {"Synth Bus 1", "Synth Bus 2", "Synth Bus 3"};
+    std::string_view suffixes[3];
+    uint8_t prefixes[3];
+    bitwig::frontcoding::encode(names, 3, suffixes, prefixes);
+
+    Protocol::DevicePageNamesWindowMessage msg{};
+    msg.devicePageCount = 3;
+    for (size_t i = 0; i < 3; ++i) {
+        msg.pageNames[i] = suffixes[i];
+        msg.pageNamePrefixes.push_back(prefixes[i]);
+    }
+
+    uint8_t buffer[Protocol::DevicePageNamesWindowMessage::MAX_PAYLOAD_SIZE];
+    uint16_t len = msg.encode(buffer, sizeof(buffer));
+    auto decoded = Protocol::DevicePageNamesWindowMessage::decode(buffer, len);
+    require(decoded.has_value() && decoded->pageNamePrefixes.size() == 3, "prefixes should survive the codec");
+
+    NameDecoder decoder(decoded->pageNamePrefixes.begin(), decoded->pageNamePrefixes.size());
+    std::string rebuilt;
+    for (size_t i = 0; i < 3; ++i) {
+        rebuilt += std::string(decoder.next(decoded->pageNames[i])) + ";";
+    }
+    require(rebuilt == "Synth Bus 1;Synth Bus 2;Synth Bus 3;", "window should decode to the original names");
+
+    std::cout << "[PASS] test_message_round_trip\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_round_trip();
+        test_duplicates_keep_a_suffix();
+        test_plain_window_passes_through();
+        test_oversized_prefix_is_clamped();
+        test_message_round_trip();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All FrontCoding tests passed\n";
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../../src/protocol/InlineCallback.hpp"
+
+namespace {
+
+using Protocol::InlineCallback;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+struct Counter {
+    int total = 0;
+    void add(int value) { total += value; }
+};
+
+void test_empty_callback_is_false() {
+    InlineCallback<void(int)> callback;
+    require(!callback, "default callback should be empty");
+
+    callback = [](int) {};
+    require(static_cast<bool>(callback), "assigned callback should be set");
+
+    callback = nullptr;
+    require(!callback, "nullptr should clear the callback");
+
+    std::cout << "[PASS] test_empty_callback_is_false\n";
+}
+
+void test_captures_are_stored_inline() {
+    Counter counter;
+    InlineCallback<void(int)> callback = [&counter](int value) { counter.add(value); };
+    callback(3);
+    callback(4);
+    require(counter.total == 7, "callback should reach the captured object");
+
+    // Two-pointer capture fills the default capacity exactly
+    int factor = 10;
+    int* factorPtr = &factor;
+    InlineCallback<int(int)> scaled = [&counter, factorPtr](int value) { return value * *factorPtr + counter.total; };
+    require(scaled(2) == 27, "two-pointer capture should be preserved");
+
+    std::cout << "[PASS] test_captures_are_stored_inline\n";
+}
+
+void test_copies_are_independent() {
+    int calls = 0;
+    InlineCallback<void()> original = [&calls]() { ++calls; };
+    InlineCallback<void()> copy = original;
+    original = nullptr;
+
+    copy();
+    require(calls == 1, "copy should keep the callable after the original is cleared");
+
+    std::cout << "[PASS] test_copies_are_independent\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_empty_callback_is_false();
+        test_captures_are_stored_inline();
+        test_copies_are_independent();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All InlineCallback tests passed\n";
+    return 0;
+}
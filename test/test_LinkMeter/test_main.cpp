@@ -0,0 +1,122 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../../src/protocol/LinkMeter.hpp"
+
+namespace {
+
+using bitwig::LinkMeter;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+/// Window request at @p startMs answered by a @p bytes frame @p roundTripMs later
+void roundTrip(LinkMeter& meter, size_t bytes, uint32_t roundTripMs, uint32_t startMs = 0) {
+    meter.onRequest(startMs);
+    meter.onReceive(bytes);
+    meter.onReply(startMs + roundTripMs);
+}
+
+void test_default_until_measured() {
+    LinkMeter meter;
+    require(meter.bytesPerSecond() == 0, "fresh meter should have no estimate");
+    require(meter.windowItems() == LinkMeter::DEFAULT_WINDOW_ITEMS, "unmeasured link should use the default window");
+
+    // Short list: too few bytes to say anything about the link
+    roundTrip(meter, 100, 200);
+    require(meter.bytesPerSecond() == 0, "small round trip should not count as a sample");
+
+    std::cout << "[PASS] test_default_until_measured\n";
+}
+
+void test_light_traffic_keeps_default() {
+    LinkMeter meter;
+    // Sparse frames with no request outstanding (value echoes on an idle USB link)
+    for (int i = 0; i < 100; ++i) meter.onReceive(10);
+    meter.onReply(5000);  // Unsolicited window (host-side list change)
+    require(meter.bytesPerSecond() == 0, "traffic outside a request should not be measured");
+    require(meter.windowItems() == LinkMeter::DEFAULT_WINDOW_ITEMS,
+            "light traffic should keep the default window");
+
+    std::cout << "[PASS] test_light_traffic_keeps_default\n";
+}
+
+void test_fast_link_gets_large_windows() {
+    LinkMeter meter;
+    // 700-byte window back 1 ms after the request = 700 kB/s
+    roundTrip(meter, 700, 1);
+    require(meter.bytesPerSecond() >= 600000, "round trip rate should be measured");
+    require(meter.windowItems() == LinkMeter::MAX_WINDOW_ITEMS, "fast link should get the largest window");
+
+    std::cout << "[PASS] test_fast_link_gets_large_windows\n";
+}
+
+void test_slow_link_gets_small_windows() {
+    LinkMeter meter;
+    // 700-byte window back 230 ms after the request = ~3 kB/s (serial bridge)
+    roundTrip(meter, 700, 230);
+    uint32_t rate = meter.bytesPerSecond();
+    require(rate > 2500 && rate < 3500, "slow round trip should be measured as a slow link");
+    require(meter.windowItems() == LinkMeter::MIN_WINDOW_ITEMS, "slow link should get the smallest window");
+
+    std::cout << "[PASS] test_slow_link_gets_small_windows\n";
+}
+
+void test_middle_rate_rounds_down() {
+    LinkMeter meter;
+    // 30 kB/s: 30000 * 50 ms / 40 bytes = 37.5 items -> 32
+    meter.onRequest(0);
+    for (int i = 0; i < 5; ++i) meter.onReceive(300);  // Other traffic during the round trip counts
+    meter.onReply(50);
+    require(meter.windowItems() == 32, "window should round down to a multiple of the minimum");
+
+    std::cout << "[PASS] test_middle_rate_rounds_down\n";
+}
+
+void test_timeout_and_reset() {
+    LinkMeter meter;
+    roundTrip(meter, 700, 1);
+
+    // A reply after the timeout (lost request, busy host) is not a link measurement
+    roundTrip(meter, 700, LinkMeter::TIMEOUT_MS + 1, 10000);
+    require(meter.windowItems() == LinkMeter::MAX_WINDOW_ITEMS,
+            "timed out round trip should be ignored");
+
+    meter.reset();
+    require(meter.bytesPerSecond() == 0 && meter.windowItems() == LinkMeter::DEFAULT_WINDOW_ITEMS,
+            "reset should forget the link");
+
+    // A new request after a lost reply starts a new round trip
+    meter.onRequest(20000);
+    meter.onRequest(20000 + LinkMeter::TIMEOUT_MS + 1);
+    meter.onReceive(700);
+    meter.onReply(20000 + LinkMeter::TIMEOUT_MS + 2);
+    require(meter.windowItems() == LinkMeter::MAX_WINDOW_ITEMS,
+            "stale request should be restarted");
+
+    std::cout << "[PASS] test_timeout_and_reset\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_default_until_measured();
+        test_light_traffic_keeps_default();
+        test_fast_link_gets_large_windows();
+        test_slow_link_gets_small_windows();
+        test_middle_rate_rounds_down();
+        test_timeout_and_reset();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All LinkMeter tests passed\n";
+    return 0;
+}
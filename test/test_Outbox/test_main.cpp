@@ -0,0 +1,101 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../../src/protocol/Outbox.hpp"
+
+namespace {
+
+using Protocol::MessageID;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+struct Sent {
+    MessageID id;
+    std::vector<uint8_t> payload;
+};
+
+std::vector<Sent> drainAll(bitwig::Outbox& outbox) {
+    std::vector<Sent> sent;
+    outbox.drain([&](MessageID id, const uint8_t* payload, size_t len) {
+        sent.push_back({id, std::vector<uint8_t>(payload, payload + len)});
+    });
+    return sent;
+}
+
+void test_last_value_wins_per_target() {
+    bitwig::Outbox outbox;
+    for (int tick = 0; tick < 10; ++tick) {
+        for (uint8_t i = 0; i < 8; ++i) {
+            require(outbox.put(Protocol::RemoteControlValueMessage{i, tick / 10.0f}), "put should succeed");
+        }
+    }
+    require(outbox.size() == 8, "one entry per remote control");
+    require(outbox.supersededCount() == 72, "older values should be superseded");
+
+    auto sent = drainAll(outbox);
+    require(sent.size() == 8 && outbox.empty(), "drain should emit and clear every entry");
+    for (uint8_t i = 0; i < 8; ++i) {
+        auto decoded = Protocol::RemoteControlValueMessage::decode(sent[i].payload.data(),
+                                                                  static_cast<uint16_t>(sent[i].payload.size()));
+        require(decoded.has_value(), "payload should decode");
+        require(decoded->remoteControlIndex == i, "entries should keep first-insertion order");
+        require(decoded->parameterValue == 0.9f, "latest value should win");
+    }
+
+    std::cout << "[PASS] test_last_value_wins_per_target\n";
+}
+
+void test_keys_separate_messages_and_indices() {
+    bitwig::Outbox outbox;
+    outbox.put(Protocol::TrackVolumeMessage{1, 0.5f});
+    outbox.put(Protocol::TrackPanMessage{1, 0.5f});
+    outbox.put(Protocol::TrackSendValueMessage{1, 0, 0.2f});
+    outbox.put(Protocol::TrackSendValueMessage{1, 1, 0.3f});
+    outbox.put(Protocol::TrackSendValueMessage{1, 0, 0.4f});
+
+    auto sent = drainAll(outbox);
+    require(sent.size() == 4, "volume, pan and two sends should stay distinct");
+    require(sent[0].id == MessageID::TRACK_VOLUME && sent[1].id == MessageID::TRACK_PAN,
+            "message ids should be preserved");
+
+    auto send0 = Protocol::TrackSendValueMessage::decode(sent[2].payload.data(),
+                                                        static_cast<uint16_t>(sent[2].payload.size()));
+    require(send0.has_value() && send0->sendIndex == 0 && send0->sendValue == 0.4f,
+            "send 0 should carry its latest value");
+
+    std::cout << "[PASS] test_keys_separate_messages_and_indices\n";
+}
+
+void test_full_outbox_rejects_new_targets() {
+    bitwig::Outbox outbox;
+    for (uint8_t i = 0; i < bitwig::Outbox::CAPACITY; ++i) {
+        require(outbox.put(Protocol::TrackVolumeMessage{i, 0.0f}), "put should succeed until capacity");
+    }
+    require(!outbox.put(Protocol::TrackPanMessage{0, 0.0f}), "new target should be rejected when full");
+    require(outbox.put(Protocol::TrackVolumeMessage{0, 1.0f}), "existing target should still be overwritten");
+
+    std::cout << "[PASS] test_full_outbox_rejects_new_targets\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_last_value_wins_per_target();
+        test_keys_separate_messages_and_indices();
+        test_full_outbox_rejects_new_targets();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All Outbox tests passed\n";
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../src/state/PageNameCache.hpp"
+
+namespace {
+
+using bitwig::state::PageNameCache;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+struct Collected {
+    std::vector<std::string> names;
+    void operator()(uint8_t index, std::string_view name) {
+        if (names.size() <= index) names.resize(index + 1);
+        names[index] = std::string(name);
+    }
+};
+
+void visit(PageNameCache& cache, uint32_t identity, uint32_t hash, const std::vector<std::string>& pages) {
+    Collected collected;
+    if (cache.activate(identity, hash, collected) == 0) {
+        for (size_t i = 0; i < pages.size(); ++i) cache.put(static_cast<uint8_t>(i), pages[i]);
+    }
+}
+
+void test_revisit_hits() {
+    PageNameCache cache;
+    visit(cache, 1, 100, {"Osc", "Filter", "Env"});
+    visit(cache, 2, 200, {"Main"});
+
+    Collected collected;
+    require(cache.activate(1, 100, collected) == 3, "revisited device should hit");
+    require(collected.names == std::vector<std::string>({"Osc", "Filter", "Env"}), "names should come back in order");
+    require(cache.stats().hits == 1 && cache.stats().misses == 2, "stats should count hits and misses");
+
+    std::cout << "[PASS] test_revisit_hits\n";
+}
+
+void test_changed_page_list_is_stale() {
+    PageNameCache cache;
+    visit(cache, 1, 100, {"Osc", "Filter"});
+
+    Collected collected;
+    require(cache.activate(1, 101, collected) == 0, "a different page list hash should miss");
+    require(collected.names.empty() && cache.stats().stale == 1, "stale names should not be handed back");
+
+    cache.put(0, "Voice");
+    require(cache.activate(1, 101, collected) == 1 && collected.names[0] == "Voice", "entry should hold the new list");
+
+    std::cout << "[PASS] test_changed_page_list_is_stale\n";
+}
+
+void test_least_recently_used_is_evicted() {
+    PageNameCache cache;
+    for (uint32_t id = 1; id <= PageNameCache::CAPACITY; ++id) visit(cache, id, id, {"Page"});
+
+    Collected collected;
+    require(cache.activate(1, 1, collected) == 1, "first device should still be cached");
+    visit(cache, 99, 99, {"New"});
+
+    require(cache.activate(2, 2, collected) == 0, "least recently used device should be evicted");
+    require(cache.activate(1, 1, collected) == 1, "recently used device should survive");
+
+    std::cout << "[PASS] test_least_recently_used_is_evicted\n";
+}
+
+void test_gaps_and_overflow_stop_recording() {
+    PageNameCache cache;
+    Collected collected;
+    cache.activate(1, 1, collected);
+    cache.put(0, "A");
+    cache.put(2, "C");  // Gap: not recorded
+    require(cache.activate(1, 1, collected) == 1, "only names without gaps should be cached");
+
+    const std::string longName(200, 'x');
+    cache.activate(2, 2, collected);
+    for (uint8_t i = 0; i < 20; ++i) cache.put(i, longName);
+    uint8_t count = cache.activate(2, 2, collected);
+    require(count == PageNameCache::TEXT_BYTES / (longName.size() + 1), "names beyond the text budget should be dropped");
+
+    std::cout << "[PASS] test_gaps_and_overflow_stop_recording\n";
+}
+
+void test_zero_identity_and_clear() {
+    PageNameCache cache;
+    Collected collected;
+    require(cache.activate(0, 5, collected) == 0, "identity 0 should not be cached");
+    cache.put(0, "Ignored");
+    require(cache.activate(0, 5, collected) == 0, "identity 0 should never hit");
+
+    visit(cache, 3, 3, {"Page"});
+    cache.clear();
+    require(cache.activate(3, 3, collected) == 0, "clear should drop every entry");
+
+    std::cout << "[PASS] test_zero_identity_and_clear\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_revisit_hits();
+        test_changed_page_list_is_stale();
+        test_least_recently_used_is_evicted();
+        test_gaps_and_overflow_stop_recording();
+        test_zero_identity_and_clear();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All PageNameCache tests passed\n";
+    return 0;
+}
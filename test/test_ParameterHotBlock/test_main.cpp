@@ -0,0 +1,83 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../../src/state/ParameterHotBlock.hpp"
+
+namespace {
+
+using namespace bitwig::state;
+using Block = ParameterHotBlock<8>;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void test_block_is_dense() {
+    require(sizeof(Block) == 96, "hot block should be exactly three 32-byte cache lines");
+    require(alignof(Block) == 32, "hot block should start on a cache line");
+
+    std::cout << "[PASS] test_block_is_dense\n";
+}
+
+void test_setters_report_changed_slot() {
+    Block hot;
+    require(hot.setValue(3, 0.5f) == 0x08, "new value should report its slot");
+    require(hot.setValue(3, 0.5f) == 0, "same value should not count as a change");
+    require(hot.value(3) == 0.5f && hot.value(2) == 0.0f, "value should read back");
+
+    require(hot.setModulationOffset(1, -0.25f) == 0x02, "offset should report its slot");
+    require(hot.setValueIndex(7, 4) == 0x80 && hot.valueIndex(7) == 4, "index should read back");
+
+    require(hot.setModulated(2, true) == 0x04 && hot.isModulated(2), "modulated flag should set");
+    require(hot.setModulated(2, true) == 0, "same flag should not count as a change");
+    require(hot.setShowModulation(0, true) == 0x01 && hot.showModulation(0),
+            "show flag should set");
+    require(!hot.hasAutomation(0), "automation should start cleared");
+
+    std::cout << "[PASS] test_setters_report_changed_slot\n";
+}
+
+void test_automation_mask_reports_differences() {
+    Block hot;
+    hot.setAutomation(1, true);
+    require(hot.setAutomationMask(0b0000'0110) == 0b0000'0100, "only the new slot should change");
+    require(hot.hasAutomation(1) && hot.hasAutomation(2), "mask should be applied");
+    require(hot.setAutomationMask(0) == 0b0000'0110, "clearing should report both slots");
+
+    ParameterHotBlock<4> small;
+    require(small.setAutomationMask(0xFF) == 0x0F, "bits beyond the slot count should be ignored");
+
+    std::cout << "[PASS] test_automation_mask_reports_differences\n";
+}
+
+void test_reset_reports_touched_slots() {
+    Block hot;
+    hot.setValue(0, 1.0f);
+    hot.setModulated(5, true);
+    require(hot.reset() == 0b0010'0001, "reset should report the slots it cleared");
+    require(hot.value(0) == 0.0f && !hot.isModulated(5), "reset should restore defaults");
+    require(hot.reset() == 0, "second reset should change nothing");
+
+    std::cout << "[PASS] test_reset_reports_touched_slots\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_block_is_dense();
+        test_setters_report_changed_slot();
+        test_automation_mask_reports_differences();
+        test_reset_reports_touched_slots();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All ParameterHotBlock tests passed\n";
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../../src/protocol/SequenceTracker.hpp"
+
+namespace {
+
+using bitwig::SequenceTracker;
+using Verdict = bitwig::SequenceTracker::Verdict;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void test_in_order_across_wrap() {
+    SequenceTracker tracker;
+    uint8_t seq = 250;
+    for (int i = 0; i < 20; ++i) {
+        require(tracker.accept(seq++) == Verdict::IN_ORDER, "consecutive sequences should be in order");
+    }
+    const auto& stats = tracker.stats();
+    require(stats.received == 20 && stats.lost == 0 && stats.stale == 0 && stats.resyncs == 0,
+            "wrap-around should not count as loss");
+
+    std::cout << "[PASS] test_in_order_across_wrap\n";
+}
+
+void test_gap_counts_lost_frames() {
+    SequenceTracker tracker;
+    tracker.accept(10);
+    require(tracker.accept(14) == Verdict::GAP, "skipped sequences should be a gap");
+    require(tracker.accept(15) == Verdict::IN_ORDER, "stream should continue after a gap");
+    require(tracker.stats().lost == 3 && tracker.stats().gaps == 1, "three frames should be counted lost");
+
+    std::cout << "[PASS] test_gap_counts_lost_frames\n";
+}
+
+void test_stale_frames_are_dropped() {
+    SequenceTracker tracker;
+    tracker.accept(1);
+    tracker.accept(3);
+    require(tracker.accept(2) == Verdict::STALE, "late frame should be stale");
+    require(tracker.accept(3) == Verdict::STALE, "duplicate frame should be stale");
+    require(tracker.accept(4) == Verdict::IN_ORDER, "expected sequence should be unaffected by stale frames");
+    require(tracker.stats().stale == 2, "stale frames should be counted");
+
+    std::cout << "[PASS] test_stale_frames_are_dropped\n";
+}
+
+void test_counter_restart_resyncs() {
+    SequenceTracker tracker;
+    for (uint8_t seq = 0; seq < 120; ++seq) tracker.accept(seq);
+    require(tracker.accept(0) == Verdict::RESYNC, "host counter restart should resync");
+    require(tracker.accept(1) == Verdict::IN_ORDER, "stream should continue after resync");
+
+    tracker.resync();
+    require(tracker.accept(200) == Verdict::IN_ORDER, "explicit resync should accept any sequence");
+    require(tracker.stats().resyncs == 1 && tracker.stats().lost == 0, "restarts should not count as loss");
+
+    std::cout << "[PASS] test_counter_restart_resyncs\n";
+}
+
+void test_stale_frame_applies_unwritten_slots() {
+    bitwig::SlotSequences<8> slots;
+    // Batch 5 writes slots 0 and 1, batch 6 (arrived first) wrote slot 0 only
+    require(slots.apply(0, 6), "first write should apply");
+    require(!slots.apply(0, 5), "older batch should not overwrite a newer slot");
+    require(slots.apply(1, 5), "older batch should still apply slots no newer batch wrote");
+    require(slots.apply(1, 7), "newer batch should apply");
+
+    // Across the wrap-around
+    require(slots.apply(2, 255) && slots.apply(2, 0) && !slots.apply(2, 255),
+            "sequence order should hold across the wrap-around");
+
+    slots.reset();
+    require(slots.apply(0, 1), "reset should accept any sequence");
+
+    std::cout << "[PASS] test_stale_frame_applies_unwritten_slots\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_in_order_across_wrap();
+        test_gap_counts_lost_frames();
+        test_stale_frames_are_dropped();
+        test_counter_restart_resyncs();
+        test_stale_frame_applies_unwritten_slots();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All SequenceTracker tests passed\n";
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../../src/state/StateTransaction.hpp"
+
+namespace {
+
+using namespace bitwig::state;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+class Counter final : public Deferred {
+public:
+    int published = 0;
+    Counter* chained = nullptr;  // Scheduled from publish() (subscriber writing state)
+
+private:
+    void publish() override {
+        ++published;
+        if (chained) chained->schedule();
+    }
+};
+
+void test_no_transaction_publishes_now() {
+    Counter counter;
+    counter.schedule();
+    counter.schedule();
+    require(counter.published == 2, "without a transaction every schedule should publish");
+    require(!StateTransaction::isOpen(), "no transaction should be open");
+
+    std::cout << "[PASS] test_no_transaction_publishes_now\n";
+}
+
+void test_transaction_merges_until_commit() {
+    Counter names;
+    Counter flags;
+    uint32_t mergedBefore = StateTransaction::merged();
+    {
+        StateTransaction::Scope scope;
+        for (int i = 0; i < 16; ++i) names.schedule();
+        flags.schedule();
+        require(names.published == 0 && flags.published == 0,
+                "nothing should publish before commit");
+        require(StateTransaction::pending() == 2, "each publisher should be queued once");
+    }
+    require(names.published == 1 && flags.published == 1, "commit should publish once each");
+    require(StateTransaction::merged() - mergedBefore == 15, "repeated schedules should be merged");
+    require(StateTransaction::pending() == 0, "commit should empty the queue");
+
+    names.schedule();
+    require(names.published == 2, "publisher should be schedulable again after commit");
+
+    std::cout << "[PASS] test_transaction_merges_until_commit\n";
+}
+
+void test_nested_transactions_publish_at_outermost_commit() {
+    Counter counter;
+    StateTransaction::begin();
+    StateTransaction::begin();
+    counter.schedule();
+    StateTransaction::commit();
+    require(counter.published == 0 && StateTransaction::isOpen(),
+            "inner commit should not publish");
+    StateTransaction::commit();
+    require(counter.published == 1 && !StateTransaction::isOpen(), "outer commit should publish");
+
+    StateTransaction::commit();  // Unbalanced commit is ignored
+    require(!StateTransaction::isOpen(), "unbalanced commit should keep the transaction closed");
+
+    std::cout << "[PASS] test_nested_transactions_publish_at_outermost_commit\n";
+}
+
+void test_schedule_while_publishing_runs_now() {
+    Counter first;
+    Counter second;
+    first.chained = &second;
+    {
+        StateTransaction::Scope scope;
+        first.schedule();
+    }
+    require(first.published == 1 && second.published == 1,
+            "publisher scheduled during commit should publish immediately");
+
+    std::cout << "[PASS] test_schedule_while_publishing_runs_now\n";
+}
+
+void test_deferred_call_runs_once() {
+    static int calls = 0;
+    DeferredCall call([]() { ++calls; });
+    {
+        StateTransaction::Scope scope;
+        call.schedule();
+        call.schedule();
+    }
+    require(calls == 1, "deferred call should run once per transaction");
+
+    std::cout << "[PASS] test_deferred_call_runs_once\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_no_transaction_publishes_now();
+        test_transaction_merges_until_commit();
+        test_nested_transactions_publish_at_outermost_commit();
+        test_schedule_while_publishing_runs_now();
+        test_deferred_call_runs_once();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All StateTransaction tests passed\n";
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "../../src/protocol/StringDictionary.hpp"
+
+namespace {
+
+using bitwig::StringDictionary;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+std::string reference(uint16_t id) {
+    return {StringDictionary::REFERENCE_MARKER, static_cast<char>(id & 0xFF), static_cast<char>(id >> 8)};
+}
+
+void test_define_and_resolve() {
+    StringDictionary strings;
+    strings.define(0x0105, "Polysynth");
+
+    require(strings.resolve(reference(0x0105)) == "Polysynth", "reference should resolve to the defined text");
+    require(strings.stats().defined == 1 && strings.stats().resolved == 1, "stats should count the hit");
+
+    uint16_t id = 0;
+    require(!strings.takeMiss(id), "a hit should not report a miss");
+
+    std::cout << "[PASS] test_define_and_resolve\n";
+}
+
+void test_plain_text_passes_through() {
+    StringDictionary strings;
+
+    require(strings.resolve("Filter Cutoff") == "Filter Cutoff", "plain names should pass through");
+    require(strings.resolve("") == "", "empty names should pass through");
+    require(strings.resolve("ab") == "ab", "short names should pass through");
+    require(strings.stats().resolved == 0 && strings.stats().misses == 0, "plain names are not dictionary lookups");
+
+    std::cout << "[PASS] test_plain_text_passes_through\n";
+}
+
+void test_stale_generation_is_a_miss() {
+    StringDictionary strings;
+    const uint16_t slot = 5;
+    const uint16_t oldId = (1 << StringDictionary::SLOT_BITS) | slot;
+    const uint16_t newId = (2 << StringDictionary::SLOT_BITS) | slot;
+    strings.define(newId, "Delay");
+
+    require(strings.resolve(reference(oldId)).empty(), "a reference to an evicted definition should miss");
+    require(strings.resolve(reference(oldId)).empty(), "a repeated miss should still resolve to nothing");
+    require(strings.stats().misses == 2, "both lookups should count as misses");
+
+    uint16_t id = 0;
+    require(strings.takeMiss(id) && id == oldId, "the stale id should be reported");
+    require(!strings.takeMiss(id), "a repeated miss should be reported once");
+
+    std::cout << "[PASS] test_stale_generation_is_a_miss\n";
+}
+
+void test_long_text_is_truncated() {
+    StringDictionary strings;
+    const std::string text(StringDictionary::MAX_LENGTH + 10, 'x');
+    strings.define(1, text);
+
+    require(strings.resolve(reference(1)).size() == StringDictionary::MAX_LENGTH, "text should be capped to a slot");
+
+    std::cout << "[PASS] test_long_text_is_truncated\n";
+}
+
+void test_clear() {
+    StringDictionary strings;
+    strings.define(7, "Reverb");
+    strings.clear();
+
+    require(strings.resolve(reference(7)).empty(), "cleared definitions should miss");
+
+    uint16_t id = 0;
+    require(strings.takeMiss(id) && id == 7, "the miss after clear should be reported");
+
+    std::cout << "[PASS] test_clear\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_define_and_resolve();
+        test_plain_text_passes_through();
+        test_stale_generation_is_a_miss();
+        test_long_text_is_truncated();
+        test_clear();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All StringDictionary tests passed\n";
+    return 0;
+}
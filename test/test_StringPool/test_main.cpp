@@ -0,0 +1,129 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "../../src/state/StringListView.hpp"
+#include "../../src/state/StringPool.hpp"
+
+namespace {
+
+using bitwig::state::StringListView;
+using bitwig::state::StringPool;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void test_set_grow_and_read() {
+    StringPool<8> pool;
+    require(pool.empty(), "new pool should be empty");
+
+    require(pool.setAt(2, "Filter"), "first write should be a change");
+    require(pool.size() == 3, "setAt past the end should grow the list");
+    require(pool[0].empty() && pool[1].empty(), "skipped slots should be empty");
+    require(pool[2] == "Filter" && std::string(pool.c_str(2)) == "Filter", "string should read back");
+    require(std::string(pool.c_str(0)).empty() && pool[9].empty(), "empty and out of range read as empty");
+
+    require(!pool.setAt(2, "Filter"), "same string should not count as a change");
+    require(!pool.setAt(8, "Out"), "index beyond capacity should be rejected");
+
+    std::cout << "[PASS] test_set_grow_and_read\n";
+}
+
+void test_truncates_to_max_length() {
+    StringPool<4, 8> pool;
+    pool.setAt(0, "Oscillator Mix");
+    require(pool[0] == "Oscillat", "string should be cut to MaxLength");
+
+    std::cout << "[PASS] test_truncates_to_max_length\n";
+}
+
+void test_overwrite_in_place_and_compaction() {
+    StringPool<4, 8, 24> pool;  // Tight arena: rewrites force compaction
+    pool.setAt(0, "AAAAAAA");
+    pool.setAt(1, "BBBBBBB");
+    pool.setAt(2, "CC");
+
+    pool.setAt(0, "aa");  // Shorter: written in place
+    require(pool.compactions() == 0 && pool[0] == "aa", "shorter string should reuse its bytes");
+
+    pool.setAt(1, "DDDDDDDD");  // Longer: tail is full, live strings move to the front
+    require(pool.compactions() == 1, "full tail should compact the arena");
+    require(pool[0] == "aa" && pool[1] == "DDDDDDDD" && pool[2] == "CC", "compaction should keep every string");
+    require(pool.bytesUsed() == 3 + 9 + 3, "live bytes should count strings and terminators");
+
+    std::cout << "[PASS] test_overwrite_in_place_and_compaction\n";
+}
+
+void test_default_arena_never_truncates() {
+    StringPool<16> pool;
+    std::string name(StringPool<16>::MAX_LENGTH, 'x');
+    for (int round = 0; round < 50; ++round) {
+        for (size_t i = 0; i < pool.CAPACITY; ++i) {
+            name[0] = static_cast<char>('a' + (round + i) % 26);
+            name.resize(round % 2 == 0 ? StringPool<16>::MAX_LENGTH : 1 + i);
+            pool.setAt(i, name);
+            require(pool[i] == name, "every write should fit the default arena");
+        }
+    }
+    require(pool.bytesUsed() <= pool.ARENA_BYTES, "live bytes should stay within the arena");
+
+    std::cout << "[PASS] test_default_arena_never_truncates\n";
+}
+
+void test_resize_and_clear() {
+    StringPool<8> pool;
+    pool.setAt(0, "Track 1");
+    pool.setAt(1, "Track 2");
+    pool.setAt(2, "Track 3");
+
+    pool.resize(1);
+    require(pool.size() == 1 && pool.bytesUsed() == 8, "shrinking should release the dropped strings");
+    pool.resize(3);
+    require(pool[1].empty() && pool[2].empty(), "grown slots should be empty");
+
+    pool.clear();
+    require(pool.empty() && pool.bytesUsed() == 0, "clear should empty the pool");
+
+    std::cout << "[PASS] test_resize_and_clear\n";
+}
+
+void test_list_view_reads_in_place() {
+    StringListView empty;
+    require(empty.empty() && std::string(empty.c_str(0)).empty(), "default view should be empty");
+
+    StringPool<4> pool;
+    pool.setAt(0, "Osc");
+    StringListView view(pool);
+    require(view.size() == 1 && view[0] == "Osc", "view should read the pool");
+    require(view.c_str(0) == pool.c_str(0), "view should not copy names");
+
+    pool.setAt(1, "Filter");
+    require(view.size() == 2 && view[1] == "Filter", "view should see later writes");
+    require(view[5].empty(), "out of range should read empty");
+
+    std::cout << "[PASS] test_list_view_reads_in_place\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_set_grow_and_read();
+        test_truncates_to_max_length();
+        test_overwrite_in_place_and_compaction();
+        test_default_arena_never_truncates();
+        test_resize_and_clear();
+        test_list_view_reads_in_place();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All StringPool tests passed\n";
+    return 0;
+}
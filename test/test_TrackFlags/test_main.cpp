@@ -0,0 +1,68 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../../src/state/TrackFlags.hpp"
+
+namespace {
+
+using namespace bitwig::state;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+void test_pack_reads_back() {
+    TrackFlags flags;
+    flags.set(0, TrackFlags::pack(true, false, false, true));
+    flags.set(1, TrackFlags::pack(false, true, false, false));
+    flags.set(2, TrackFlags::pack(false, false, true, false));
+
+    require(flags.muted(0) && flags.armed(0) && !flags.soloed(0),
+            "track 0 should be muted + armed");
+    require(flags.soloed(1) && !flags.muted(1), "track 1 should be soloed");
+    require(flags.mutedBySolo(2) && !flags.muted(2), "muted by solo is not muted");
+    require(flags.mask(TRACK_FLAG_MUTE) == 0b001 && flags.mask(TRACK_FLAG_SOLO) == 0b010,
+            "masks should hold one bit per track");
+    require(!flags.muted(40), "unknown track should read as unmuted");
+
+    std::cout << "[PASS] test_pack_reads_back\n";
+}
+
+void test_solo_toggle_changes_one_mask() {
+    TrackFlags flags;
+    for (size_t i = 0; i < TrackFlags::CAPACITY; ++i) flags.set(i, 0);
+
+    // Solo on track 5: every other track becomes muted by solo
+    uint64_t changed = flags.setFlag(5, TRACK_FLAG_SOLO, true);
+    for (size_t i = 0; i < TrackFlags::CAPACITY; ++i) {
+        if (i != 5) changed |= flags.setFlag(i, TRACK_FLAG_MUTED_BY_SOLO, true);
+    }
+    require(changed == ~uint64_t{0}, "every track should be reported changed");
+    require(flags.mask(TRACK_FLAG_MUTED_BY_SOLO) == ~(uint64_t{1} << 5),
+            "all but the soloed track should be muted by solo");
+
+    require(flags.setFlag(5, TRACK_FLAG_SOLO, true) == 0, "repeated state should not notify");
+    require(flags.setFlag(5, TRACK_FLAG_SOLO, false) == (uint64_t{1} << 5),
+            "unsolo should change only its track");
+
+    std::cout << "[PASS] test_solo_toggle_changes_one_mask\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_pack_reads_back();
+        test_solo_toggle_changes_one_mask();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All TrackFlags tests passed\n";
+    return 0;
+}
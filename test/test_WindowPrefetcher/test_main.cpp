@@ -0,0 +1,144 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../../src/handler/WindowPrefetcher.hpp"
+
+namespace {
+
+using Prefetcher = bitwig::handler::WindowPrefetcher<8>;
+constexpr uint8_t WINDOW = 16;
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+struct Requests {
+    std::vector<uint8_t> starts;
+    std::vector<uint8_t> sizes;
+    void operator()(uint8_t start, uint8_t size) {
+        starts.push_back(start);
+        sizes.push_back(size);
+    }
+};
+
+void test_slow_scroll_matches_threshold() {
+    Prefetcher prefetcher;
+    Requests requests;
+
+    // One step every 300 ms: no speed, lead = threshold
+    prefetcher.navigate(7, 1, 16, 120, WINDOW, 0, requests);
+    require(requests.starts.empty(), "cursor far from loadedUpTo should not prefetch");
+
+    prefetcher.navigate(8, 1, 16, 120, WINDOW, 300, requests);
+    require(requests.starts == std::vector<uint8_t>({16}), "cursor within threshold should fetch the next window");
+    require(prefetcher.leadItems() == 8, "lead should be the threshold when scrolling slowly");
+
+    prefetcher.navigate(9, 1, 16, 120, WINDOW, 600, requests);
+    require(requests.starts.size() == 1, "a window already requested should not be requested again");
+
+    std::cout << "[PASS] test_slow_scroll_matches_threshold\n";
+}
+
+void test_fast_spin_looks_further_ahead() {
+    Prefetcher prefetcher;
+    Requests requests;
+
+    // 2 items every 10 ms = 200 items/s
+    int cursor = 0;
+    for (uint32_t t = 0; t <= 50; t += 10) {
+        cursor += 2;
+        prefetcher.navigate(cursor, 2, 16, 120, WINDOW, t, requests);
+    }
+    require(prefetcher.speed() > 150.0f, "speed should follow the spin");
+    require(prefetcher.leadItems() > 16, "lead should grow with speed");
+    require(requests.starts == std::vector<uint8_t>({16, 32}), "two windows should be requested ahead");
+
+    std::cout << "[PASS] test_fast_spin_looks_further_ahead\n";
+}
+
+void test_in_flight_cap_and_progress() {
+    Prefetcher prefetcher;
+    Requests requests;
+    for (uint32_t t = 0; t <= 50; t += 10) prefetcher.navigate(10, 4, 16, 120, WINDOW, t, requests);
+    require(requests.starts.size() == Prefetcher::MAX_IN_FLIGHT, "requests ahead should be capped");
+
+    // First window answered: room for one more
+    prefetcher.navigate(14, 4, 32, 120, WINDOW, 60, requests);
+    require(requests.starts.size() == 3 && requests.starts[2] == 48, "next window should follow once one lands");
+
+    std::cout << "[PASS] test_in_flight_cap_and_progress\n";
+}
+
+void test_timeout_and_reset_request_again() {
+    Prefetcher prefetcher;
+    Requests requests;
+    prefetcher.navigate(10, 1, 16, 120, WINDOW, 0, requests);
+    require(requests.starts.size() == 1, "first window should be requested");
+
+    prefetcher.navigate(10, 1, 16, 120, WINDOW, 100, requests);
+    require(requests.starts.size() == 1, "pending request should not be repeated before the timeout");
+
+    prefetcher.navigate(10, 1, 16, 120, WINDOW, 100 + Prefetcher::REQUEST_TIMEOUT_MS + 1, requests);
+    require(requests.starts.size() == 2 && requests.starts[1] == 16, "unanswered request should be sent again");
+
+    // New list (loadedUpTo back to 0)
+    prefetcher.navigate(1, 1, 0, 40, WINDOW, 1000, requests);
+    require(requests.starts.size() == 3 && requests.starts[2] == 0, "a reset list should start over from 0");
+
+    std::cout << "[PASS] test_timeout_and_reset_request_again\n";
+}
+
+void test_window_size_follows_the_link() {
+    Prefetcher prefetcher;
+    Requests requests;
+
+    // Fast link: 64-item windows, progress counted in those
+    prefetcher.navigate(10, 1, 16, 200, 64, 0, requests);
+    require(requests.starts == std::vector<uint8_t>({16}) && requests.sizes[0] == 64,
+            "request should carry the window size");
+    prefetcher.navigate(75, 1, 80, 200, 64, 300, requests);
+    require(requests.starts.size() == 2 && requests.starts[1] == 80, "next request should follow the larger window");
+
+    // Slower link: smaller windows from where loading stands
+    prefetcher.navigate(140, 1, 144, 200, 8, 600, requests);
+    require(requests.starts.size() == 3 && requests.starts[2] == 144 && requests.sizes[2] == 8,
+            "window size should change per request");
+
+    std::cout << "[PASS] test_window_size_follows_the_link\n";
+}
+
+void test_backward_wrap_fetches_up_to_cursor() {
+    Prefetcher prefetcher;
+    Requests requests;
+    prefetcher.navigate(119, -1, 16, 120, WINDOW, 0, requests);
+    require(requests.starts == std::vector<uint8_t>({16, 32}), "wrapped cursor should pull windows toward it");
+
+    prefetcher.navigate(-1, -1, 16, 120, WINDOW, 10, requests);
+    require(requests.starts.size() == 2, "non-item cursor should not request");
+
+    std::cout << "[PASS] test_backward_wrap_fetches_up_to_cursor\n";
+}
+
+}  // namespace
+
+int main() {
+    try {
+        test_slow_scroll_matches_threshold();
+        test_fast_spin_looks_further_ahead();
+        test_in_flight_cap_and_progress();
+        test_timeout_and_reset_request_again();
+        test_window_size_follows_the_link();
+        test_backward_wrap_fetches_up_to_cursor();
+    } catch (const std::exception& error) {
+        std::cerr << "[FAIL] " << error.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "All WindowPrefetcher tests passed\n";
+    return 0;
+}